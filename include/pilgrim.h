@@ -10,17 +10,29 @@
 #include "pilgrim_func_ids.h"
 #include "pilgrim_logger.h"
 #include "pilgrim_utils.h"
+#include "pilgrim_clock.h"
 #include "pilgrim_mem_hooks.h"
 #include "pilgrim_pthread_hooks.h"
 #include "pilgrim_mpi_objects.h"
 
 
 
+// Call the PMPI function without recording anything
+#define PILGRIM_PMPI_CALL(ret_type, func, func_args)                                    \
+    set_inside_mpi();                                                                   \
+    ret_type res = P##func func_args;                                                   \
+    unset_inside_mpi();
+
+
 // First call the original function and stores the elapsed time, func id, etc
 // Need to call the function first so the output arguments have the correct value
+// Before initialization, while tracing is paused (on demand mode) or if the function
+// is filtered out (PILGRIM_INCLUDE/EXCLUDE) this is only the PMPI call. Wrappers that
+// keep MPI objects consistent (comm creation, object release, request completion)
+// check logger_paused() before this.
 #define PILGRIM_TRACING_1(ret_type, func, func_args)                                    \
-    if(!logger_initialized()) {                                                         \
-        ret_type res = P##func func_args;                                               \
+    if(!logger_tracing(ID_##func)) {                                                    \
+        PILGRIM_PMPI_CALL(ret_type, func, func_args);                                   \
         return res;                                                                     \
     }                                                                                   \
     short func_id = ID_##func;                                                          \
@@ -32,7 +44,8 @@
 
 
 // Then in a Record structure and write it to log
-// Copy the arguments in case the application freed/modified the memory
+// The arguments are not copied here, write_record() encodes them into
+// the call signature right away, so they only need to stay alive until then.
 // 3rd argument comm_size is used for post-processing to determine the call's array
 // argument length, e.g., MPI_Alltoallw()
 #define PILGRIM_TRACING_2(record_arg_count, record_arg_sizes, record_args, commsize)    \
@@ -43,26 +56,62 @@
         .func_id = func_id,                                                             \
         .arg_count = record_arg_count,                                                  \
         .arg_sizes = record_arg_sizes,                                                  \
+        .args = record_args,                                                            \
         .comm_size = commsize,                                                          \
     };                                                                                  \
-    record.tid  = pilgrim_pthread_add_get_tid();                                        \
-    record.args = pilgrim_malloc(sizeof(void*) * record_arg_count);                     \
-    int i;                                                                              \
-    for(i = 0; i < record_arg_count; i++) {                                             \
-        record.args[i] = pilgrim_malloc(record_arg_sizes[i]);                           \
-        if(record_args[i])                                                              \
-            memcpy(record.args[i], record_args[i], record_arg_sizes[i]);                \
-        else                                                                            \
-            memset(record.args[i], 0, record_arg_sizes[i]);                             \
-    }                                                                                   \
-    pilgrim_free(record_args, sizeof(void*) * record_arg_count);                        \
     write_record(record);                                                               \
-                                                                                        \
-    for(i = 0; i < record_arg_count; i++)                                               \
-        pilgrim_free(record.args[i], record_arg_sizes[i]);                              \
-    pilgrim_free(record.args, sizeof(void*) * record_arg_count);                        \
-                                                                                        \
     return res;
 
 
+// Specialized version of PILGRIM_TRACING_2, used by the generated wrappers.
+// Each wrapper encodes its own call signature in place:
+// | func_id | comm_size (if not -1) | scalars | array arguments |
+// scalars is a packed struct of all fixed-size arguments (compile-time size),
+// followed by one PILGRIM_ENCODE_TAIL() for each array argument
+// (PILGRIM_ENCODE_LOCAL_TAIL() for the wrapper's own arrays, never NULL).
+#define PILGRIM_TRACING_2_BEGIN(scalars, tail_len, commsize)                            \
+    int sig_len;                                                                        \
+    void *sig = logger_get_signature_buffer(func_id, commsize,                          \
+                                    sizeof(scalars) + (tail_len), &sig_len);            \
+    void *sig_pos = sig + sig_len - (tail_len) - sizeof(scalars);                       \
+    memcpy(sig_pos, &(scalars), sizeof(scalars));                                       \
+    sig_pos += sizeof(scalars);
+
+#define PILGRIM_ENCODE_TAIL(arg, size)                                                  \
+    if(arg)                                                                             \
+        memcpy(sig_pos, arg, size);                                                     \
+    else                                                                                \
+        memset(sig_pos, 0, size);                                                       \
+    sig_pos += (size);
+
+#define PILGRIM_ENCODE_LOCAL_TAIL(arg, size)                                            \
+    memcpy(sig_pos, arg, size);                                                         \
+    sig_pos += (size);
+
+#define PILGRIM_TRACING_2_END()                                                         \
+    Record record = {                                                                   \
+        .tstart = tstart,                                                               \
+        .tend = tend,                                                                   \
+        .res = res,                                                                     \
+        .func_id = func_id,                                                             \
+    };                                                                                  \
+    write_record_signature(record, sig, sig_len);                                       \
+    return res;
+
+
+// Local queries (MPI_Comm_rank, MPI_Type_size, etc., see query_func_ids[])
+// have no communication semantics. Their signature is encoded as usual
+// but there is no timing capture, write_query_signature() only counts it.
+#define PILGRIM_QUERY_1(ret_type, func, func_args)                                      \
+    if(!logger_tracing(ID_##func)) {                                                    \
+        PILGRIM_PMPI_CALL(ret_type, func, func_args);                                   \
+        return res;                                                                     \
+    }                                                                                   \
+    short func_id = ID_##func;                                                          \
+    PILGRIM_PMPI_CALL(ret_type, func, func_args);
+
+#define PILGRIM_QUERY_2_END()                                                           \
+    write_query_signature(func_id, sig, sig_len);                                       \
+    return res;
+
 #endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_CLOCK_H_
+#define _PILGRIM_CLOCK_H_
+
+#include <stdint.h>
+#include <time.h>
+#include "mpi.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PILGRIM_HAVE_TSC
+#endif
+
+/**
+ * Clock source used by pilgrim_wtime(), set with PILGRIM_CLOCK
+ *
+ * tsc:       invariant TSC, calibrated against CLOCK_MONOTONIC at init.
+ *            Falls back to monotonic if the CPU does not have one.
+ * monotonic: clock_gettime(CLOCK_MONOTONIC), served by the vDSO.
+ * mpi:       PMPI_Wtime(), the default.
+ */
+#define PILGRIM_CLOCK_MPI           "mpi"
+#define PILGRIM_CLOCK_MONOTONIC     "monotonic"
+#define PILGRIM_CLOCK_TSC           "tsc"
+
+typedef enum ClockSource_t {
+    CLOCK_SOURCE_MPI = 0,
+    CLOCK_SOURCE_MONOTONIC,
+    CLOCK_SOURCE_TSC,
+} ClockSource;
+
+// Only written by pilgrim_clock_init()
+extern ClockSource pilgrim_clock_source;
+extern double pilgrim_tsc_seconds_per_tick;
+extern uint64_t pilgrim_tsc_base;
+
+void pilgrim_clock_init(int mpi_rank);
+const char* pilgrim_clock_name();
+double pilgrim_clock_ticks_per_second();    // 0 if the clock is not tsc
+
+
+// Called twice for every traced call, keep it inlined
+static inline double pilgrim_wtime() {
+#ifdef PILGRIM_HAVE_TSC
+    if(pilgrim_clock_source == CLOCK_SOURCE_TSC)
+        return (__rdtsc() - pilgrim_tsc_base) * pilgrim_tsc_seconds_per_tick;
+#endif
+    if(pilgrim_clock_source == CLOCK_SOURCE_MONOTONIC) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+    }
+    return PMPI_Wtime();
+}
+
+// Raw cycle counter for cheap self-measurement, always 0 without a TSC
+static inline uint64_t pilgrim_cycles() {
+#ifdef PILGRIM_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+#endif
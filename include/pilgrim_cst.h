@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_CST_H_
+#define _PILGRIM_CST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pilgrim_logger.h"
+#include "pilgrim_slab.h"
+
+
+/**
+ * Call Signature Table (CST)
+ *
+ * An open-addressing (linear probing) hash table
+ * purpose-built for call signatures:
+ *
+ * 1. Each slot caches the 64-bit hash and the key length
+ *    of its entry, so a probe only does a memcmp when both
+ *    of them match, and a resize never rehashes a key.
+ * 2. Keys are copied into a contiguous arena owned by the
+ *    table, entry->key points into the arena.
+ * 3. Entries are also kept in an array in insertion order,
+ *    which is the order CST_FOREACH visits them.
+ * 4. Entries themselves come from a slab and are released
+ *    together with the key arena.
+ *
+ * Entries can not be deleted individually.
+ */
+typedef struct CSTSlot_t {
+    uint64_t hash;
+    int key_len;
+    RecordHash *entry;              // NULL if the slot is empty
+} CSTSlot;
+
+typedef struct CSTArenaChunk_t {
+    size_t size;
+    size_t used;
+    struct CSTArenaChunk_t *next;
+    char data[];
+} CSTArenaChunk;
+
+typedef struct CallSignatureTable_t {
+    CSTSlot *slots;
+    unsigned capacity;              // number of slots, always a power of 2
+    unsigned count;                 // number of entries
+
+    RecordHash **entries;           // entries in insertion order
+    unsigned entries_capacity;
+
+    CSTArenaChunk *arena;           // key arena, the head is the current chunk
+    Slab entry_slab;                // RecordHash entries
+} CallSignatureTable;
+
+
+#define CST_COUNT(cst) ((cst)->count)
+
+// Iterate over all entries in insertion order
+#define CST_FOREACH(cst, el)                                            \
+    for(unsigned _cst_i = 0;                                            \
+        _cst_i < (cst)->count && (((el) = (cst)->entries[_cst_i]), 1);  \
+        _cst_i++)
+
+
+uint64_t cst_hash(const void *key, int key_len);
+
+void cst_init(CallSignatureTable *cst);
+void cst_cleanup(CallSignatureTable *cst);
+
+RecordHash* cst_find(CallSignatureTable *cst, const void *key, int key_len, uint64_t hash);
+
+/*
+ * Insert a new entry, the caller must make sure the key
+ * does not exist yet. The key is copied into the arena.
+ * All other fields of the returned entry are zero initialized.
+ */
+RecordHash* cst_insert(CallSignatureTable *cst, const void *key, int key_len, uint64_t hash);
+
+#endif
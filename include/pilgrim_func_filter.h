@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_FUNC_FILTER_H_
+#define _PILGRIM_FUNC_FILTER_H_
+
+#include <stdbool.h>
+
+/**
+ * Runtime filter of the traced MPI functions
+ *
+ * PILGRIM_INCLUDE: trace only these functions/classes
+ * PILGRIM_EXCLUDE: do not trace these functions/classes
+ *
+ * Both take a comma separated list of function names (with or without
+ * the MPI_ prefix) and classes: p2p, coll, rma, io, datatype, comm, tool.
+ * e.g., PILGRIM_EXCLUDE=MPI_Comm_rank,MPI_Type_size,datatype
+ *
+ * The result is a bitmap indexed by the ids in pilgrim_func_ids.h,
+ * a set bit means the function is traced.
+ */
+#define PILGRIM_MAX_FUNCS               512
+#define FUNC_FILTER_BYTES               (PILGRIM_MAX_FUNCS/8)
+
+#define FUNC_FILTER_TEST(bitmap, id)    ((bitmap)[(id)>>3] &  (1 << ((id)&7)))
+#define FUNC_FILTER_SET(bitmap, id)     ((bitmap)[(id)>>3] |= (1 << ((id)&7)))
+#define FUNC_FILTER_CLEAR(bitmap, id)   ((bitmap)[(id)>>3] &= ~(1 << ((id)&7)))
+
+// Returns true if any function is filtered out
+bool func_filter_init(unsigned char *bitmap, bool verbose);
+
+#endif
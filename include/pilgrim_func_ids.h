@@ -776,4 +776,7 @@ static char *func_names[] = {
 "free", 
 };
 
+#define NUM_QUERY_FUNCS 23
+extern const short query_func_ids[NUM_QUERY_FUNCS];
+
 #endif
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_GOVERNOR_H_
+#define _PILGRIM_GOVERNOR_H_
+
+#include <stdbool.h>
+#include "pilgrim_func_filter.h"
+#include "pilgrim_overhead.h"
+
+/**
+ * Overhead governor, enabled with PILGRIM_OVERHEAD_BUDGET=2%
+ *
+ * Only used by the timing modes that store a timing sample per
+ * call or run (LOSSLESS, TEXT, ZSTD, HIST, SZ and ZFP). Every
+ * GOVERNOR_EPOCH calls it compares pilgrim's time (measured by the
+ * overhead profiler) with the elapsed time. If the budget is exceeded,
+ * the functions with the most expensive timings are switched to
+ * aggregated statistics only: no more timing samples, but the
+ * call grammar stays lossless.
+ *
+ * Every switch is recorded with the per-function call index
+ * it starts at, so decoders know which calls have exact timings.
+ */
+#define GOVERNOR_EPOCH          65536       // calls
+
+typedef enum TimingLevel_t {
+    TIMING_LEVEL_EXACT = 0,                 // a timing sample for each call/run
+    TIMING_LEVEL_AGGREGATED,                // only the per-signature statistics
+} TimingLevel;
+
+typedef struct TimingSwitch_t {
+    int func_id;
+    int level;                              // TimingLevel from this call on
+    unsigned long call;                     // rank-local index of the first call of func_id at this level
+} TimingSwitch;
+
+typedef struct Governor_t {
+    double budget;                          // fraction of the elapsed time
+    unsigned long calls[PILGRIM_MAX_FUNCS]; // calls of each function so far
+    unsigned char level[PILGRIM_MAX_FUNCS];
+
+    double epoch_start;
+    unsigned long epoch_calls;
+    OverheadStats epoch_base[PILGRIM_MAX_FUNCS];    // profiler stats at epoch_start
+
+    TimingSwitch *switches;
+    int num_switches, capacity;
+} Governor;
+
+void governor_init(Governor *g, double budget);
+void governor_cleanup(Governor *g);
+
+// Called once an epoch is over, stats is the overhead profile of the same thread
+void governor_check(Governor *g, OverheadStats *stats, int mpi_rank, bool verbose);
+
+// Counts the call and returns true if it gets timing samples
+static inline bool governor_timed(Governor *g, int func_id) {
+    g->calls[func_id]++;
+    g->epoch_calls++;
+    return g->level[func_id] == TIMING_LEVEL_EXACT;
+}
+
+// Append the calls of a later thread, the merged switches use rank-local call indices
+void governor_merge(Governor *dst, Governor *src);
+
+// Collective, rank 0 writes the switches of all ranks
+void governor_write_switches(Governor *g, const char *path, int mpi_rank, int mpi_size);
+
+#endif
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include "mpi.h"
 #include "uthash.h"
+#include "pilgrim_func_filter.h"
 
 #define PILGRIM_TRACING_MODE_DEFAULT  "DEFAULT"
 #define PILGRIM_TRACING_MODE_ONDEMAND "DYNAMIC"
@@ -23,7 +24,6 @@ typedef struct TimingNode_t {
 typedef struct _Record {
     double tstart, tend;
     short  func_id;             // 2 bytes function id
-    int    tid;                 // symbolic id of pthread_t
     int    arg_count;
     int*   arg_sizes;           // size of each argument
     void** args;                // Store all arguments in array
@@ -34,6 +34,7 @@ typedef struct _Record {
 /*
  * Entry of the Call Signature Table
  * key: call signature
+ * The table itself is defined in pilgrim_cst.h
  */
 typedef struct RecordHash_t {
     void *key;                      // [func_id + arguments] as key
@@ -53,8 +54,6 @@ typedef struct RecordHash_t {
     // Lossless timing mode
     TimingNode *intervals;
     TimingNode *durations;
-
-    UT_hash_handle hh;
 } RecordHash;
 
 
@@ -70,6 +69,14 @@ typedef struct _GlobalMetadata {
     double time_resolution;
     int ranks;
     char timing_mode[20];
+    char clock[12];                 // clock source of pilgrim_wtime(), see pilgrim_clock.h
+    double clock_ticks_per_second;  // TSC calibration on rank 0, 0 for the other clocks
+    bool func_filtered;             // some functions were not traced, see PILGRIM_INCLUDE/EXCLUDE
+    unsigned char func_filter[FUNC_FILTER_BYTES];   // bitmap of traced function ids
+    double overhead_budget;         // PILGRIM_OVERHEAD_BUDGET as a fraction, 0 if the governor is off
+    bool query_counted;             // PILGRIM_QUERY_CALLS=count, local queries are only in the CST counts
+    unsigned char func_queries[FUNC_FILTER_BYTES];  // bitmap of local queries, they never have timings
+    bool parametric_loops;          // PILGRIM_PARAMETRIC_LOOPS, grammars.dat has the loop counts
     char* trace_dir;     // trace dir, only used during post-processing
 } GlobalMetadata;
 
@@ -77,6 +84,8 @@ typedef struct _GlobalMetadata {
 void logger_init(int mpi_rank, int mpi_size);
 void logger_exit();
 bool logger_initialized();
+bool logger_tracing(short func_id);  // initialized, recording and not filtered out
+bool logger_paused(short func_id);   // initialized, but not recording (on demand mode) or filtered out
 void logger_recording_on();
 void logger_recording_off();
 
@@ -85,7 +94,10 @@ int  logger_get_mpi_size();
 double logger_get_program_start_time();
 
 void* compose_call_signature(Record *record, int *key_len);
+void* logger_get_signature_buffer(short func_id, int comm_size, int args_len, int *key_len);
 void write_record(Record record);
+void write_record_signature(Record record, void *key, int key_len);
+void write_query_signature(short func_id, void *key, int key_len);  // local queries, no timings
 
 
 void append_offset(MPI_Offset offset);
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_OVERHEAD_H_
+#define _PILGRIM_OVERHEAD_H_
+
+#include "pilgrim_clock.h"
+
+/**
+ * Tracing overhead self-profiler, enabled with PILGRIM_PROFILE_OVERHEAD=1
+ *
+ * Per MPI function, the time spent in the PMPI call and in each
+ * part of pilgrim, all in seconds measured with pilgrim_wtime().
+ * Use PILGRIM_CLOCK=tsc to keep the profiler itself cheap.
+ *
+ * Written by rank 0 to pilgrim-logs/overhead.csv, summed over
+ * all threads and ranks.
+ */
+typedef struct OverheadStats_t {
+    double calls;
+    double pmpi;            // the PMPI call itself
+    double signature;       // wrapper setup and call signature encoding
+    double cst;             // signature cache and CST lookup/insert
+    double grammar;         // grammar update (ring push in async grammar mode)
+    double timing;          // timing codec, TimingRecorder record/record_run
+} OverheadStats;
+
+#define OVERHEAD_NUM_FIELDS     ((int) (sizeof(OverheadStats)/sizeof(double)))
+
+// Time spent in pilgrim itself, i.e., all but the PMPI call.
+// Shared by the overhead table and the governor.
+static inline double pilgrim_time(OverheadStats *s) {
+    return s->signature + s->cst + s->grammar + s->timing;
+}
+
+// Charge the time since t to the given phase, then restart t
+#define OVERHEAD_PHASE(stats, phase, t)                 \
+    if(stats) {                                         \
+        double __now = pilgrim_wtime();                 \
+        (stats)->phase += __now - (t);                  \
+        (t) = __now;                                    \
+    }
+
+void overhead_merge(OverheadStats *dst, OverheadStats *src, int num_funcs);
+
+// Collective, reduces the stats of all ranks on rank 0 and writes the table
+void overhead_write_table(OverheadStats *stats, int num_funcs, const char *path, int rank);
+
+#endif
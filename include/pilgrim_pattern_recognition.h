@@ -6,7 +6,8 @@
 #ifndef _PILGRIM_PATTERN_RECOGNITION_H_
 #define _PILGRIM_PATTERN_RECOGNITION_H_
 #include "pilgrim_logger.h"
+#include "pilgrim_cst.h"
 
-void linear_regression(RecordHash* merged_cst);
+void linear_regression(CallSignatureTable* merged_cst);
 
 #endif
@@ -7,9 +7,11 @@
 #define _PILGRIM_READER_H_
 
 #include "pilgrim_logger.h"
+#include "pilgrim_governor.h"
 
 typedef struct CallSignature_t {
     short func_id;
+    unsigned count;         // calls of all ranks
     int arg_count;
     void **args;
 
@@ -45,7 +47,9 @@ typedef struct CFG_t {
     int **unique_grammars;          // decoded unique grammars
 
     int *num_symbols;               // number of symbols of each unique grammar
-    int *grammar_ids;               // size of nprocs. each rank's grammar id
+    int *num_threads;               // size of nprocs. number of grammars (threads) of each rank
+    int **grammar_ids;              // grammar_ids[rank][thread], unique grammar id of each thread
+    int **joint_bins;               // CFG_JOINT: timing bins of each decoded symbol, otherwise NULL
 } CFG;
 
 
@@ -199,6 +203,19 @@ double* read_tstarts(GlobalMetadata* gm);
 double* read_tends(GlobalMetadata* gm);
 // free them directly use free()
 
+// CFG_JOINT, the composite terminals as | call terminal | bins | pairs
+int* read_joint_terminals(GlobalMetadata* gm, int* num_composites);
+// Values of the timing bins of a composite terminal, in seconds
+double joint_duration(int bins);
+double joint_interval(int bins);
+
+// Timing switches of the overhead governor, one array per rank,
+// NULL if the governor was off. Free with free_timing_switches()
+TimingSwitch** read_timing_switches(GlobalMetadata* gm, int** num_switches);
+void free_timing_switches(GlobalMetadata* gm, TimingSwitch** switches, int* num_switches);
+// TimingLevel of the call-th call (starting from 0) of func_id on a rank
+int timing_level(TimingSwitch* switches, int num_switches, int func_id, unsigned long call);
+
 
 
 void read_record_args(int func_id, void* buff, CallSignature *cs);
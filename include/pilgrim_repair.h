@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_REPAIR_H_
+#define _PILGRIM_REPAIR_H_
+
+#include <stddef.h>
+#include "pilgrim_sequitur.h"
+
+/**
+ * Offline grammar builder (PILGRIM_GRAMMAR_ALGO=repair)
+ *
+ * During the run the logger only appends the terminals (val, exp)
+ * to a TerminalBuffer, no grammar work per call. At finalize,
+ * repair_build() compresses the whole stream with Re-Pair: replace
+ * the most frequent pair of adjacent symbols by a new rule until no
+ * pair occurs twice. Frequencies are kept in buckets and only go
+ * down, and the occurrences of each pair are kept in position order
+ * (no sorting), so the whole build is linear in the stream length.
+ *
+ * The result is written into a normal Grammar (rules used only once
+ * are inlined, runs of the same symbol become one symbol with exp),
+ * so the merge and serialize_grammar() work as with Sequitur.
+ * The stream has to fit in memory, 8 bytes per terminal run
+ * plus about 24 bytes per terminal run during the build.
+ */
+typedef struct TerminalBuffer_t {
+    int *data;                      // val, exp, val, exp, ...
+    size_t len;                     // number of integers
+    size_t capacity;
+} TerminalBuffer;
+
+void terminal_buffer_grow(TerminalBuffer *buf);
+void terminal_buffer_free(TerminalBuffer *buf);
+
+static inline void terminal_buffer_push(TerminalBuffer *buf, int val, int exp) {
+    if(buf->len + 2 > buf->capacity)
+        terminal_buffer_grow(buf);
+    buf->data[buf->len++] = val;
+    buf->data[buf->len++] = exp;
+}
+
+// grammar must be empty (just initialized), it may be parametric
+void repair_build(Grammar *grammar, const int *terminals, size_t len);
+
+#endif
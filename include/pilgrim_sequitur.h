@@ -7,13 +7,10 @@
 #define _PILGRIM_SEQUITUR_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "utlist.h"
 #include "uthash.h"
 
-#define IS_RULE_HEAD(sym) ((!(sym)->terminal) && ((sym)->rule_head==NULL))
-#define IS_NONTERMINAL(sym) ((!(sym)->terminal) && ((sym)->rule_head!=NULL))
-#define IS_TERMINAL(sym) ((sym)->terminal)
-
 #define ERROR_ABORT(msg) {fprintf(stderr, msg);abort();}
 
 //#define DEBUG
@@ -21,103 +18,206 @@
 
 
 /**
- * There are three types of Symbols
- *
- * 1. Terminal:
- *      `rule` filed is the rule (rule head) it blongs to
- *      `rule_head`, `ref_body` and `ref` are ignored
- *
- * 2. Non-terminal:
- *      `rule` filed is the rule (rule head) it blongs to
- *      `rule_head` points to the rule_head node
- *      `ref_body` and `ref` are ignored
+ * The grammar is stored in two contiguous arrays and all links
+ * are 32-bit indices into them. Index 0 is never used and means
+ * "none" (like NULL). Arrays may be reallocated when they grow,
+ * so never hold a Symbol* or Rule* across new_symbol()/new_rule().
  *
- *  Terminals and Non-terminals are both stored in rule_body list.
+ * Symbols (terminals and non-terminals) live in grammar->symbols:
+ *      `rule` is the index of the rule it belongs to
+ *      `rule_head` is only used by non-terminals, the index of
+ *      the rule it represents, whose id is also kept in `val`
+ *      Deleted symbols have `rule` set to 0 and are reused later
  *
- * 3. Rule head:
- *      Represents a rule.  This is a special type that are stored in the rule list
- *      It will never be inserted into the rules body.
- *      `rule_body` is the right hand side
+ * Rules live in grammar->rules:
+ *      `val` is the rule id, ids are never reused
+ *      `body` is the first symbol of the right hand side
  *      `ref` is the number of usages
- *      `rule` and `rule_head` filed are ignored
+ *      Deleted rules are reused later (but with a new id)
  *
+ * Both the rule bodies and the rule list are doubly linked lists
+ * with the utlist convention: head->prev is the tail, tail->next is 0.
  */
-typedef struct Symbol_t {           // utlist node, sizeof(Symbol) = 56
+typedef uint32_t SymbolId;
+
+typedef struct Symbol_t {           // sizeof(Symbol) = 24
     int val;
     int exp;
-    bool terminal;
+    SymbolId prev, next;
+    uint32_t rule : 31;
+    uint32_t terminal : 1;
+    uint32_t rule_head;
+} Symbol;
 
-    // For terminal and non-termial this field
-    // remembers the rule (Symbol of Rule Head type) they belong to
-    struct Symbol_t *rule;
+typedef struct Rule_t {             // sizeof(Rule) = 24
+    int val;                        // rule id, a negative number
+    int ref;
+    SymbolId body;
+    uint32_t prev, next;            // rule list
+    bool params;                    // its expansion takes loop counts, see LoopCounts
+} Rule;
 
-    // Only used by non-terminals, points to the rule (Symbol of Rule Head type) it represents
-    struct Symbol_t *rule_head;
+#define SYMBOL(grammar, id)     (&(grammar)->symbols[id])
+#define RULE(grammar, idx)      (&(grammar)->rules[idx])
+#define IS_TERMINAL(sym)        ((sym)->terminal)
 
-    // if this is a rule (Rule Head type)
-    // rule_body will be a list of symbols this rule represent
-    // ref will be the number of usages of this rule
-    struct Symbol_t *rule_body;
-    int ref;
+// Iterate over the rules in the rule list, the main rule first
+#define GRAMMAR_FOREACH_RULE(grammar, r)                                            \
+    for(uint32_t _rule_i = (grammar)->rules_head;                                   \
+        _rule_i && (((r) = RULE(grammar, _rule_i)), 1); _rule_i = (r)->next)
 
-    struct Symbol_t *prev, *next;
-} Symbol;
+// Iterate over the symbols of a rule body
+#define RULE_FOREACH_SYMBOL(grammar, r, s)                                          \
+    for(SymbolId _sym_i = (r)->body;                                                \
+        _sym_i && (((s) = SYMBOL(grammar, _sym_i)), 1); _sym_i = (s)->next)
+
+
+/**
+ * Digram table
+ *
+ * Open addressing with linear probing. The key (val, exp, val, exp)
+ * of a digram is packed into two 64-bit integers and stored in the
+ * slot together with the first symbol of the digram, so lookups
+ * never allocate and never chase a pointer to compare keys.
+ * Deletion shifts the following entries back (no tombstones).
+ */
+typedef struct DigramSlot_t {       // sizeof(DigramSlot) = 24
+    uint64_t k1, k2;                // (val1, exp1), (val2, exp2)
+    SymbolId symbol;                // first symbol of the digram, 0 if the slot is empty
+} DigramSlot;
 
+typedef struct DigramTable_t {
+    DigramSlot *slots;
+    unsigned capacity;              // always a power of 2
+    unsigned count;
+} DigramTable;
 
-typedef struct Digram_t {           // uthash node, sizesof(Digram) = 72
-    void *key;                      // the key is composed of two symbol values (sym->val)
-    Symbol *symbol;                 // first symbol of the digram
-    UT_hash_handle hh;
-} Digram;
+/**
+ * Bounded grammar memory, see pilgrim_sequitur_spill.c
+ */
+typedef struct GrammarSpill_t {
+    size_t max_bytes;               // PILGRIM_MAX_GRAMMAR_MB
+    char path[300];                 // per rank (and context) spill file
+    int fd;                         // -1 until the first freeze
+    int countdown;                  // appends to wait before the next freeze
+    int segments;
+    int rules;                      // rules in the spill file, segments included
+    int symbols;                    // symbols of these rules
+} GrammarSpill;
+
+/**
+ * Parametric loops (PILGRIM_PARAMETRIC_LOOPS), see pilgrim_sequitur_loops.c
+ *
+ * A terminal appended with exp > 1, or a rule repeated at the end of
+ * the main rule, is kept as a^LOOP_PARAM and its trip count goes to
+ * the side array instead. Digrams then only see that a symbol is a
+ * loop, not how many times it runs, so a^8 b and a^9 b become the same
+ * rule. Expanding the grammar, every a^LOOP_PARAM takes the next count
+ * from the side array, in order, before its own expansion.
+ *
+ * The side array is run-length encoded: | count | repeat | ...
+ */
+#define LOOP_PARAM  0
+
+typedef struct LoopCounts_t {
+    int *runs;                      // count, repeat, count, repeat, ...
+    size_t len;                     // number of integers
+    size_t capacity;
+} LoopCounts;
+
+// Reads the counts of a LoopCounts (or a serialized copy) back in order
+typedef struct LoopCursor_t {
+    const int *runs;
+    size_t len;
+    size_t pos;
+    int left;                       // repeats left of runs[pos]
+} LoopCursor;
 
 typedef struct Grammar_t {
-    Symbol *rules;
-    Digram *digram_table;
+    Symbol *symbols;
+    uint32_t symbols_capacity;
+    uint32_t symbols_used;          // including the unused symbols[0]
+    SymbolId free_symbols;          // deleted symbols, linked by next
+
+    Rule *rules;
+    uint32_t rules_capacity;
+    uint32_t rules_used;            // including the unused rules[0]
+    uint32_t rules_head;            // the main rule
+    uint32_t free_rules;            // deleted rules, linked by next
+
+    DigramTable digram_table;
     int start_rule_id;              // first rule id, normally is -1
     int rule_id;                    // current_rule id, a negative number start from 'start_rule_id'
     bool twins_removal;             // if or not we will apply the twins-removal rule
+    GrammarSpill *spill;            // NULL if the memory is not bounded
+    bool parametric;                // loop counts are parameters, see LoopCounts
+    LoopCounts loop_counts;
 } Grammar;
 
 
-/* Only these five functions should be exposed
+/* Only these functions should be exposed
  * to the pilgrim looger code.
  * Alls the rest are used internally for the Sequitur
  * algorithm implementation.
  */
-Symbol* append_terminal(Grammar *grammar, int val, int exp);
+SymbolId append_terminal(Grammar *grammar, int val, int exp);
 void sequitur_init(Grammar *grammar);
 void sequitur_init_rule_id(Grammar *grammar, int start_rule_id, bool twins_removal);
 void sequitur_update(Grammar *grammar, int *update_terminal_id);
-double sequitur_finalize(const char* output_path, Grammar *grammar);
+void sequitur_append_grammar(Grammar *dst, Grammar *src, int *update_terminal_id);
+double sequitur_finalize(const char* output_path, Grammar *grammars, int num_grammars);  // one grammar per thread
 void sequitur_cleanup(Grammar *grammar);
 
 
 /* pilgrim_sequitur_symbol.c */
-Symbol* new_symbol(int val, int exp, bool terminal, Symbol* rule_head);
-void symbol_put(Symbol *rule, Symbol *pos, Symbol *sym);
-void symbol_delete(Symbol *rule, Symbol *sym, bool deref);
+SymbolId new_symbol(Grammar *grammar, int val, int exp, bool terminal, uint32_t rule_head);
+void symbol_put(Grammar *grammar, uint32_t rule, SymbolId pos, SymbolId sym);
+void symbol_delete(Grammar *grammar, SymbolId sym, bool deref);
 
-Symbol* new_rule(Grammar *grammar);
-void rule_put(Symbol **rules_head, Symbol *rule);
-void rule_delete(Symbol **rules_head, Symbol *rule);
-void rule_ref(Symbol *rule);
-void rule_deref(Symbol *rule);
+uint32_t new_rule(Grammar *grammar);
+void rule_put(Grammar *grammar, uint32_t rule);
+void rule_delete(Grammar *grammar, uint32_t rule);
 
 
 
 /* pilgrim_sequitur_digram.c */
-#define DIGRAM_KEY_LEN sizeof(int)*4
-Symbol* digram_get(Digram *digram_table, Symbol* sym1, Symbol* sym2);
-int digram_put(Digram **digram_table, Symbol *symbol);
-int digram_delete(Digram **digram_table, Symbol *symbol);
+void digram_table_init(DigramTable *table);
+void digram_table_cleanup(DigramTable *table);
+SymbolId digram_get(Grammar *grammar, SymbolId sym1, SymbolId sym2);
+int digram_put(Grammar *grammar, SymbolId symbol);
+int digram_delete(Grammar *grammar, SymbolId symbol);
 
 
 
 /* pilgrim_sequitur_logger.c */
-double sequitur_dump(const char *path, Grammar *grammar, int mpi_rank, int mpi_size);
+#define GRAMMAR_FILE_MAGIC      "PGRM"      // first bytes of grammars.dat, see sequitur_dump()
+#define GRAMMAR_FILE_VERSION    1
+#define GRAMMAR_FILE_ZSTD       0x1         // flag: the rest of the file is ZSTD compressed
+
+double sequitur_dump(const char *path, Grammar *grammars, int num_grammars, int mpi_rank, int mpi_size);
 int* serialize_grammar(Grammar *grammar, int *integers);
 int* compress_serialize_grammars(int mpi_rank, int mpi_size, Grammar* local_grammar, int* compressed_integers);
 
+/* pilgrim_sequitur_spill.c */
+void sequitur_set_limit(Grammar *grammar, size_t max_bytes, const char *spill_path);
+size_t sequitur_memory(Grammar *grammar);
+bool sequitur_should_freeze(Grammar *grammar);
+void sequitur_freeze(Grammar *grammar);
+int sequitur_load_spill(Grammar *grammar);
+void sequitur_spill_update(Grammar *grammar, int *update_terminal_id);
+int sequitur_spill_serialize(Grammar *grammar, int *segments_data, int *rules_data);
+void sequitur_close_spill(Grammar *grammar);
+
+/* pilgrim_sequitur_loops.c */
+void sequitur_set_parametric(Grammar *grammar);
+bool symbol_has_params(Grammar *grammar, Symbol *sym);
+int  loop_twins_exp(Grammar *grammar, SymbolId sym);
+void loop_params_update(Grammar *grammar);
+void loop_counts_push(LoopCounts *counts, int count);
+void loop_counts_free(LoopCounts *counts);
+void loop_cursor_init(LoopCursor *cursor, const int *runs, size_t len);
+int  loop_cursor_next(LoopCursor *cursor);
+
 /* pilgrim_sequitur_utils.c */
 void  sequitur_print_rules(FILE* stream, Grammar *grammar);
 void  sequitur_print_digrams(Grammar *grammar);
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_SLAB_H_
+#define _PILGRIM_SLAB_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Slab allocator for small fixed-size objects
+ * (e.g., RecordHash)
+ *
+ * 1. Objects are carved out of large chunks with a bump pointer,
+ *    so there is no per-object malloc header and objects that are
+ *    created together sit next to each other.
+ * 2. Freed objects go to an intrusive free list and are reused first.
+ * 3. slab_release() returns all chunks at once, no per-object free.
+ *
+ * Chunk sizes double from SLAB_MIN_CHUNK to SLAB_MAX_CHUNK so small
+ * tables stay small. With PILGRIM_HUGEPAGES=1, the chunks after
+ * that are 2MB aligned mmap regions advised with MADV_HUGEPAGE,
+ * which cuts the TLB misses of walking a big table.
+ *
+ * A slab is not thread-safe, each one belongs to a single
+ * call signature table.
+ */
+#define SLAB_MIN_CHUNK      (4*1024)
+#define SLAB_MAX_CHUNK      (256*1024)
+#define SLAB_HUGE_CHUNK     (2*1024*1024)
+
+typedef struct SlabChunk_t {
+    struct SlabChunk_t *next;
+    size_t size;                    // bytes, including this header
+    bool huge;                      // mmap'ed, not from pilgrim_malloc()
+} SlabChunk;
+
+typedef struct Slab_t {
+    size_t obj_size;                // rounded up to the size class
+    char *cursor, *end;             // bump region in the current chunk
+    void *free_list;
+    SlabChunk *chunks;              // the head is the current chunk
+    size_t next_chunk_size;
+    size_t bytes;                   // total bytes held by the chunks
+} Slab;
+
+
+void slab_init(Slab *slab, size_t obj_size);
+void slab_release(Slab *slab);      // free all objects at once
+void slab_grow(Slab *slab);
+
+static inline void* slab_alloc(Slab *slab) {
+    void *obj = slab->free_list;
+    if(obj) {
+        slab->free_list = *(void**)obj;
+        return obj;
+    }
+    if(slab->cursor + slab->obj_size > slab->end)
+        slab_grow(slab);
+    obj = slab->cursor;
+    slab->cursor += slab->obj_size;
+    return obj;
+}
+
+static inline void slab_free(Slab *slab, void *obj) {
+    *(void**)obj = slab->free_list;
+    slab->free_list = obj;
+}
+
+#endif
@@ -7,6 +7,7 @@
 #define _PILGRIM_TIMINGS_H_
 
 #include "pilgrim_logger.h"
+#include "pilgrim_cst.h"
 #include "pilgrim_sequitur.h"
 
 // Aggregated
@@ -19,10 +20,149 @@
 
 // Lossy
 #define TIMING_MODE_CFG             "CFG"
+#define TIMING_MODE_CFG_JOINT       "CFG_JOINT"
 #define TIMING_MODE_HIST            "HIST"
 #define TIMING_MODE_SZ              "SZ"
 #define TIMING_MODE_ZFP             "ZFP"
 
+typedef enum TimingMode_t {
+    TIMING_AGGREGATED = 0,
+    TIMING_LOSSLESS,
+    TIMING_TEXT,
+    TIMING_ZSTD,
+    TIMING_CFG,
+    TIMING_HIST,
+    TIMING_SZ,
+    TIMING_ZFP,
+    TIMING_CFG_JOINT,
+} TimingMode;
+
+// Timings are binned exponentially, bin i is BASE^i * TIME_RESOLUTION
+#define REL_ERR     (0.1)
+#define BASE        (1.0+REL_ERR)
+
+// CFG mode: the duration and interval bin of calls that have
+// no timings, i.e., local queries. Bins are capped to 2^15-2
+#define CFG_UNTIMED_BIN     32767
+
+/**
+ * CFG_JOINT mode: one grammar for the calls and their timing bins
+ *
+ * Instead of growing the call grammar and two timing grammars, the
+ * call grammar is grown over composite terminals, i.e., (call terminal,
+ * duration bin, interval bin) triples interned in this table.
+ * At logger_exit() the tables of all ranks are merged like the CSTs,
+ * grammars.dat then has global composite terminals and durations.dat
+ * the merged table, which the decoder uses to split them back apart:
+ *
+ * | #composites | call terminal | bins | call terminal | bins | ...
+ *
+ * Bins are packed as duration bin << 16 | interval bin (both are
+ * capped to 2^15-2), JOINT_UNTIMED if the run has no timings.
+ */
+#define JOINT_UNTIMED       0x7fffffff
+
+typedef struct JointTable_t {
+    uint64_t *composites;           // by composite id: call terminal << 32 | bins
+    int count;
+    int capacity;
+    int *slots;                     // open addressing, composite id + 1, 0 if empty
+    unsigned num_slots;             // always a power of 2
+    int *update_composite_id;       // set by merge_terminals() or dump_terminals()
+} JointTable;
+
+/**
+ * Per-thread timing state, embedded in each recording context.
+ * Which fields are used depends on the timing mode.
+ */
+typedef struct TimingContext_t {
+    Grammar durations_grammar;      // CFG mode
+    Grammar intervals_grammar;
+    double cfg_ts;                  // time spent on growing the two grammars
+
+    JointTable joint;               // CFG_JOINT mode
+    int *joint_merged;              // rank 0: the merged table, as written to durations.dat
+    int joint_integers;
+
+    TimingNode *g_durations;        // LOSSLESS: tends, others: durations
+    TimingNode *g_intervals;        // LOSSLESS: tstarts, others: intervals
+} TimingContext;
+
+typedef struct TimingOutput_t {
+    int mpi_rank;
+    int mpi_size;
+    double total_calls;             // in millions, summed over all ranks
+    char *dur_path;
+    char *int_path;
+} TimingOutput;
+
+/**
+ * Timings of a run of identical consecutive calls, see PendingRun
+ * in pilgrim_logger.c. The run is one terminal with exp = count in
+ * the call grammar, so codecs that keep one sample per run store
+ * the mean duration of its calls, not the time the run spans.
+ */
+typedef struct TimingRun_t {
+    int count;
+    double tstart;                  // tstart of the first call
+    double last_tstart;             // tstart of the last call
+    double duration;                // sum of the durations of the calls
+} TimingRun;
+
+/**
+ * Timing recorder, one for each timing mode
+ *
+ * The logger resolves PILGRIM_TIMING_MODE to a recorder once
+ * at logger_init(), and then only calls through it:
+ *
+ * init:     set up the timing state of a new recording context
+ * record:   store the timing of one call, entry is its CST entry
+ * record_run: store the timings of a run of identical consecutive calls
+ *           as a whole. Modes that keep every call use record instead,
+ *           either can be NULL. CFG keeps count duration bins, the timing
+ *           list modes one mean duration per run. Called for every run,
+ *           timed is false if its calls have no timings.
+ * merge:    move the timing state of src into dst (thread contexts),
+ *           NULL if the mode keeps no timing state
+ *
+ * Joint modes grow the call grammar over their own terminals, these
+ * are NULL for all other modes:
+ *
+ * terminal: the terminal to append to the call grammar for a run of
+ *           entry, run is NULL if it is not timed
+ * merge_terminals: move the terminals of src into dst before src's call
+ *           grammar is appended to dst's. Return the terminal map for it,
+ *           update_terminal_id maps src's call terminals to dst's.
+ * dump_terminals: merge the terminals of all ranks once the CSTs are
+ *           merged, update_terminal_id maps call terminals to the global
+ *           ones. Return the terminal map for the grammars, collective.
+ *           Maps are released by finalize().
+ *
+ * write:    write out the timings, called collectively at logger_exit(),
+ *           NULL if the mode writes no timing files
+ * finalize: release whatever is left in the timing state
+ *
+ * To add a new timing codec, implement these functions in
+ * pilgrim_timings.c and add a recorder to timing_recorders[].
+ */
+typedef struct TimingRecorder_t {
+    TimingMode mode;
+    const char *name;               // value of PILGRIM_TIMING_MODE
+    void (*init)(TimingContext *tc);
+    void (*record)(TimingContext *tc, RecordHash *entry, Record *record);
+    void (*record_run)(TimingContext *tc, RecordHash *entry, TimingRun *run, bool timed);
+    void (*merge)(TimingContext *dst, TimingContext *src);
+    int  (*terminal)(TimingContext *tc, RecordHash *entry, TimingRun *run);
+    int* (*merge_terminals)(TimingContext *dst, TimingContext *src, int *update_terminal_id);
+    int* (*dump_terminals)(TimingContext *tc, int *update_terminal_id);
+    void (*write)(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out);
+    void (*finalize)(TimingContext *tc);
+} TimingRecorder;
+
+// Return NULL if the mode is unknown or not supported by this build
+const TimingRecorder* timing_recorder_lookup(const char *name);
+
+
 #define microseconds    (0.000001)
 #define TIME_RESOLUTION (1*microseconds)
 
@@ -36,22 +176,25 @@
 
 
 
+TimingNode* merge_timing_list(TimingNode *earlier, TimingNode *later);
+
 void handle_aggregated_timing(RecordHash* entry, Record* record);
 void handle_cfg_timing(RecordHash* entry, Record* record, int* duration_id, int* interval_id);
 
-void write_text_timings(RecordHash* cst, int mpi_rank);
+void write_text_timings(CallSignatureTable* cst, int mpi_rank);
 void write_lossless_timings(TimingNode* tstart_nodes, TimingNode* tend_nodes, int mpi_rank, int mpi_size, char* dur_path, char* int_path);
-void write_zstd_timings(RecordHash* cst, int mpi_rank, int mpi_size, char* dur_path, char* int_path, TimingNode* g_durations);
-void write_hist_timings(RecordHash* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path);
+void write_zstd_timings(CallSignatureTable* cst, int mpi_rank, int mpi_size, char* dur_path, char* int_path, TimingNode* g_durations);
+void write_hist_timings(CallSignatureTable* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path);
 void write_cfg_timings(Grammar* duration_grammar, Grammar* interval_grammar, int mpi_rank, double total_calls, char* dur_path, char* int_path, double cfg_ts);
+void write_joint_timings(int* merged, int integers, int mpi_rank, double total_calls, char* dur_path);
 
 #ifdef WITH_ZFP
-void write_zfp_timings(RecordHash* cst, int mpi_rank, double total_size, char* dur_path, char* int_path,
+void write_zfp_timings(CallSignatureTable* cst, int mpi_rank, double total_size, char* dur_path, char* int_path,
                        TimingNode* g_durations, TimingNode* g_intervals, bool clustering);
 #endif
 
 #ifdef WITH_SZ
-void write_sz_timings(RecordHash* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
+void write_sz_timings(CallSignatureTable* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
                       TimingNode* g_durations, TimingNode* g_intervals, bool clustering);
 #endif
 
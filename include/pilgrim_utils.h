@@ -11,12 +11,13 @@ void pilgrim_free(void* ptr, size_t size);
 void pilgrim_report_memory_status();
 
 
-double pilgrim_wtime();
+/* Put multiple arguments (char *) in a list (char**)
+ * The list lives on the caller's stack, so it is only valid
+ * in the scope where it is assembled, i.e., until PILGRIM_TRACING_2 */
+#define assemble_args_list(arg_count, ...) ((void**)(const void*[]){__VA_ARGS__})
 
-/* Put multiple arguments (char *) in a list (char**) */
-void** assemble_args_list(int arg_count, ...);
-
-void* concat_function_args(short func_id, int tid, int arg_count, void** args, int* arg_sizes, int comm_size, int* key_len);
+int encode_signature_header(short func_id, int comm_size, int args_len, void** buf, int* capacity);
+int concat_function_args(short func_id, int arg_count, void** args, int* arg_sizes, int comm_size, void** buf, int* capacity);
 
 int randint();
 
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+#ifndef _PILGRIM_VARINT_H_
+#define _PILGRIM_VARINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * LEB128 varints, 7 bits per byte, the high bit is set on all
+ * bytes but the last. Zigzag maps small negative numbers to small
+ * unsigned ones: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ... (the macros
+ * evaluate their argument more than once)
+ */
+#define ZIGZAG_ENCODE(v)    ((uint32_t)((uint32_t)(v) << 1) ^ (uint32_t)((int32_t)(v) >> 31))
+#define ZIGZAG_DECODE(u)    ((int32_t)((uint32_t)(u) >> 1) ^ -(int32_t)((u) & 1))
+#define VARINT_MAX_BYTES    10
+
+size_t varint_encode(uint64_t val, unsigned char *buf);
+size_t varint_decode(const unsigned char *buf, size_t len, uint64_t *val);
+size_t varint_decode_bulk(const unsigned char *buf, size_t len, uint64_t *vals, size_t n);
+
+#endif
@@ -7,9 +7,12 @@ AM_CPPFLAGS += -I$(top_srcdir)/include -I$(ZFP_DIR)/include -I$(SZ_DIR)/include
 
 libpilgrim_la_SOURCES += \
 	src/pilgrim_wrappers.c src/pilgrim_utils.c src/pilgrim_logger.c \
+	src/pilgrim_cst.c src/pilgrim_clock.c src/pilgrim_func_filter.c src/pilgrim_overhead.c src/pilgrim_governor.c \
+	src/pilgrim_slab.c src/pilgrim_varint.c \
 	src/pilgrim_init_finalize.c src/pilgrim_wrappers_special.c \
 	src/pilgrim_sequitur.c  src/pilgrim_sequitur_digram.c \
 	src/pilgrim_sequitur_symbol.c src/pilgrim_sequitur_logger.c \
+	src/pilgrim_sequitur_spill.c src/pilgrim_sequitur_loops.c src/pilgrim_repair.c \
 	src/pilgrim_sequitur_utils.c src/pilgrim_pattern_recognition.c\
 	src/pilgrim_mem_hooks.c src/dlmalloc.c	src/pilgrim_addr_avl.c \
 	src/pilgrim_mpi_objects.c src/pilgrim_timings.c \
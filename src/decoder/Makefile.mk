@@ -12,9 +12,9 @@ pilgrim_app_generator_SOURCES += \
 	src/decoder/pilgrim_time_decoder.c \
 	src/decoder/pilgrim_read_args.c src/decoder/pilgrim_read_args_special.c \
 	src/pilgrim_sequitur.c  src/pilgrim_sequitur_digram.c \
-	src/pilgrim_sequitur_symbol.c src/pilgrim_sequitur_logger.c \
-	src/pilgrim_sequitur_utils.c src/pilgrim_utils.c src/pilgrim_pattern_recognition.c \
-	src/dlmalloc.c
+	src/pilgrim_sequitur_symbol.c src/pilgrim_sequitur_logger.c src/pilgrim_sequitur_spill.c \
+	src/pilgrim_sequitur_loops.c src/pilgrim_sequitur_utils.c src/pilgrim_utils.c src/pilgrim_pattern_recognition.c \
+	src/pilgrim_slab.c src/pilgrim_varint.c src/dlmalloc.c
 
 pilgrim2text_SOURCES += \
 	src/decoder/pilgrim2text.c \
@@ -22,4 +22,4 @@ pilgrim2text_SOURCES += \
 	src/decoder/pilgrim_cfg_decoder.c src/decoder/pilgrim_cst_decoder.c \
 	src/decoder/pilgrim_time_decoder.c \
 	src/decoder/pilgrim_read_args.c src/decoder/pilgrim_read_args_special.c \
-	src/pilgrim_utils.c src/dlmalloc.c
+	src/pilgrim_utils.c src/pilgrim_varint.c src/dlmalloc.c
@@ -27,38 +27,84 @@ int main(int argc, char** argv) {
     double *p_tstarts = tstarts;
     double *p_tends   = tends;
 
+    // Local queries and calls whose timings were dropped by the
+    // overhead governor have no timestamps, they are printed as "- -"
+    int *num_switches;
+    TimingSwitch **switches = read_timing_switches(gm, &num_switches);
+    unsigned long func_calls[PILGRIM_MAX_FUNCS];
+
     // 3. Write to text files
     char textfile_dir[256], textfile_path[256];
     sprintf(textfile_dir, "%s/_text", argv[1]);
     mkdir(textfile_dir, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
 
     for(int rank = 0; rank < gm->ranks; rank++) {
-        int ugi = cfg->grammar_ids[rank];
-
         int total_calls = 0;
-        for(int i=0; i<cfg->num_symbols[ugi]; i+=2)
-            total_calls += cfg->unique_grammars[ugi][i+1];
+        for(int t = 0; t < cfg->num_threads[rank]; t++) {
+            int ugi = cfg->grammar_ids[rank][t];
+            for(int i=0; i<cfg->num_symbols[ugi]; i+=2)
+                total_calls += cfg->unique_grammars[ugi][i+1];
+        }
         printf("Rank %d, total number of calls: %d\n", rank, total_calls);
 
+        // One section per thread, in tid order
         sprintf(textfile_path, "%s/%d.txt", textfile_dir, rank);
         FILE* f = fopen(textfile_path, "w");
-        for(int i = 0; i < cfg->num_symbols[ugi]; i+=2) {
+        int timed_calls = 0;
+        memset(func_calls, 0, sizeof(func_calls));
+        for(int t = 0; t < cfg->num_threads[rank]; t++) {
+            int ugi = cfg->grammar_ids[rank][t];
+            if(cfg->num_threads[rank] > 1)
+                fprintf(f, "# Thread %d\n", t);
+
+            for(int i = 0; i < cfg->num_symbols[ugi]; i+=2) {
 
-            int sym = cfg->unique_grammars[ugi][i];
-            int exp = cfg->unique_grammars[ugi][i+1];
-            CallSignature *cs = &(cst->cs_list[sym]);
-            for(int j = 0; j < exp; j++) {
-                if(strcmp(gm->timing_mode, TIMING_MODE_LOSSLESS)==0)
-                    fprintf(f, "%f %f ", p_tstarts[i/2], p_tends[i/2]);
-                fprintf(f, "%s()\n", func_names[cs->func_id]);
+                int sym = cfg->unique_grammars[ugi][i];
+                int exp = cfg->unique_grammars[ugi][i+1];
+                CallSignature *cs = &(cst->cs_list[sym]);
+                int bins = cfg->joint_bins ? cfg->joint_bins[ugi][i/2] : JOINT_UNTIMED;
+                for(int j = 0; j < exp; j++) {
+                    unsigned long call = func_calls[cs->func_id]++;
+                    bool timed = !FUNC_FILTER_TEST(gm->func_queries, cs->func_id) && (switches == NULL ||
+                        timing_level(switches[rank], num_switches[rank], cs->func_id, call) == TIMING_LEVEL_EXACT);
+                    if(strcmp(gm->timing_mode, TIMING_MODE_LOSSLESS)==0) {
+                        if(timed) {
+                            fprintf(f, "%f %f ", p_tstarts[timed_calls], p_tends[timed_calls]);
+                            timed_calls++;
+                        } else
+                            fprintf(f, "- - ");
+                    }
+                    // CFG_JOINT, approximate mean duration of the calls of the run,
+                    // and the interval before its first call
+                    if(cfg->joint_bins) {
+                        if(bins == JOINT_UNTIMED)
+                            fprintf(f, "- - ");
+                        else if(j == 0)
+                            fprintf(f, "%f %f ", joint_duration(bins), joint_interval(bins));
+                        else
+                            fprintf(f, "%f - ", joint_duration(bins));
+                    }
+                    fprintf(f, "%s()\n", func_names[cs->func_id]);
+                }
             }
         }
         fclose(f);
 
-        p_tstarts += total_calls;
-        p_tends   += total_calls;
+        p_tstarts += timed_calls;
+        p_tends   += timed_calls;
+    }
+
+    // With PILGRIM_QUERY_CALLS=count, local queries are
+    // only in the CST, with their call counts of all ranks
+    if(gm->query_counted) {
+        for(int i = 0; i < cst->num_css; i++) {
+            CallSignature *cs = &(cst->cs_list[i]);
+            if(FUNC_FILTER_TEST(gm->func_queries, cs->func_id))
+                printf("Counted only: %s(), %u calls\n", func_names[cs->func_id], cs->count);
+        }
     }
 
+    free_timing_switches(gm, switches, num_switches);
     free_metadata(gm);
     free_cst(cst);
     free_cfg(cfg);
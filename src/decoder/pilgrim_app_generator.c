@@ -19,6 +19,10 @@ static int grammar_splitter = 10000000;
 
 static int tmp_arr_idx = 0;
 
+// Parametric loops (PILGRIM_PARAMETRIC_LOOPS), see write_loop_counts()
+static bool parametric = false;
+static long *rule_params = NULL;    // loop counts taken by one expansion of each rule, by rule index
+
 typedef struct VariablePool_t {
     char* name;
     int symbolic_id;          // value (symbolic id in trace) as key
@@ -99,12 +103,13 @@ void write_vars_declaration_core(FILE* f, int type, int id_or_val) {
 
 void write_vars_declaration(FILE* f, Grammar *grammar, CST *cst) {
     CallSignature* cs;
-    Symbol *rule, *sym;
+    Rule *rule;
+    Symbol *sym;
 
     int max_str_len = -1;
 
-    DL_FOREACH(grammar->rules, rule) {
-        DL_FOREACH(rule->rule_body, sym) {
+    GRAMMAR_FOREACH_RULE(grammar, rule) {
+        RULE_FOREACH_SYMBOL(grammar, rule, sym) {
             if(sym->val < 0 || sym->val >= grammar_splitter)
                 continue;
             cs = &(cst->cs_list[sym->val]);
@@ -335,14 +340,29 @@ void write_call(FILE* f, CallSignature *cs) {
     }
 }
 
-void write_prologue(FILE* f, Grammar* grammar, CST* cst) {
+// True if any rank has more than one thread grammar
+bool is_multithreaded(int nprocs, CFG *cfg) {
+    for(int rank = 0; rank < nprocs; rank++)
+        if(cfg->num_threads[rank] > 1) return true;
+    return false;
+}
+
+void write_prologue(FILE* f, Grammar* grammar, CST* cst, bool multithreaded) {
     fprintf(f, "#include <stdio.h>\n");
     fprintf(f, "#include <stdlib.h>\n");
+    if(multithreaded)
+        fprintf(f, "#include <pthread.h>\n");
     fprintf(f, "#include <mpi.h>\n\n");
     fprintf(f, "static int g_mpi_rank;\n");
     fprintf(f, "static int g_mpi_size;\n");
-    fprintf(f, "static int g_ugi;\n");
-    fprintf(f, "static int g_remaining_reqs;\n\n");
+    // Each thread replays its own grammar
+    fprintf(f, multithreaded ? "static __thread int g_ugi;\n" : "static int g_ugi;\n");
+    fprintf(f, "static int g_remaining_reqs;\n");
+    if(parametric) {
+        fprintf(f, "typedef struct LoopPos_t { int run, left; } LoopPos;\n");
+        fprintf(f, multithreaded ? "static __thread LoopPos g_loop, g_loop_mark;\n" : "static LoopPos g_loop, g_loop_mark;\n");
+    }
+    fprintf(f, "\n");
 
     fprintf(f, "void mpi_user_function(void* in, void* out, int* len, MPI_Datatype* type) {}\n");
     fprintf(f, "void mpi_comm_errhandler_function(MPI_Comm* comm, int* err, ...) {}\n");
@@ -362,7 +382,58 @@ void write_prologue(FILE* f, Grammar* grammar, CST* cst) {
 }
 
 
+/*
+ * Ranks with several thread grammars replay them on
+ * as many threads, thread 0 on the main thread.
+ */
+void write_thread_epilogue(FILE* f, int nprocs, CFG *cfg) {
+    fprintf(f, "static void* replay_thread(void* ugi) {\n");
+    fprintf(f, "\tg_ugi = *(int*)ugi;\n");
+    if(parametric)
+        fprintf(f, "\tstart_loop_counts();\n");
+    fprintf(f, "\tfunc_1();\n");
+    fprintf(f, "\treturn NULL;\n}\n\n");
+
+    fprintf(f, "int main(int argc, char* argv[]) {\n");
+    fprintf(f, "\tint provided;\n");
+    fprintf(f, "\tMPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);\n");
+    fprintf(f, "\tPMPI_Comm_size(MPI_COMM_WORLD, &g_mpi_size);\n");
+    fprintf(f, "\tPMPI_Comm_rank(MPI_COMM_WORLD, &g_mpi_rank);\n");
+
+    int offset = 0;
+    fprintf(f, "\tint num_threads[] = {");
+    for(int rank = 0; rank < nprocs; rank++)
+        fprintf(f, rank == nprocs-1 ? "%d};\n" : "%d, ", cfg->num_threads[rank]);
+    fprintf(f, "\tint thread_offsets[] = {");
+    for(int rank = 0; rank < nprocs; rank++) {
+        fprintf(f, rank == nprocs-1 ? "%d};\n" : "%d, ", offset);
+        offset += cfg->num_threads[rank];
+    }
+    fprintf(f, "\tint grammar_ids[] = {");
+    for(int rank = 0; rank < nprocs; rank++)
+        for(int t = 0; t < cfg->num_threads[rank]; t++)
+            fprintf(f, (rank == nprocs-1 && t == cfg->num_threads[rank]-1) ? "%d};\n" : "%d, ", cfg->grammar_ids[rank][t]);
+
+    fprintf(f, "\tint *ugis = grammar_ids + thread_offsets[g_mpi_rank];\n");
+    fprintf(f, "\tpthread_t threads[num_threads[g_mpi_rank]];\n");
+    fprintf(f, "\tfor(int t = 1; t < num_threads[g_mpi_rank]; t++)\n");
+    fprintf(f, "\t\tpthread_create(&threads[t], NULL, replay_thread, &ugis[t]);\n");
+    fprintf(f, "\tg_ugi = ugis[0];\n");
+    if(parametric)
+        fprintf(f, "\tstart_loop_counts();\n");
+    fprintf(f, "\tfunc_1();\n");
+    fprintf(f, "\tfor(int t = 1; t < num_threads[g_mpi_rank]; t++)\n");
+    fprintf(f, "\t\tpthread_join(threads[t], NULL);\n");
+    fprintf(f, "\tMPI_Finalize();\n");
+    fprintf(f, "\treturn 0;\n}\n");
+}
+
 void write_epilogue(FILE* f, int nprocs, CFG *cfg) {
+    if(is_multithreaded(nprocs, cfg)) {
+        write_thread_epilogue(f, nprocs, cfg);
+        return;
+    }
+
     fprintf(f, "int main(int argc, char* argv[]) {\n");
     fprintf(f, "\tMPI_Init(&argc, &argv);\n");
     fprintf(f, "\tPMPI_Comm_size(MPI_COMM_WORLD, &g_mpi_size);\n");
@@ -373,13 +444,15 @@ void write_epilogue(FILE* f, int nprocs, CFG *cfg) {
     fprintf(f, "\tint grammar_ids[] = {");
 
     for(int rank = 0; rank < nprocs; rank++) {
-        int ugi = cfg->grammar_ids[rank];
+        int ugi = cfg->grammar_ids[rank][0];
         if(rank == nprocs-1)
             fprintf(f, "%d};\n", ugi);
         else
             fprintf(f, "%d, ", ugi);
     }
     fprintf(f, "\tg_ugi = grammar_ids[g_mpi_rank];\n");
+    if(parametric)
+        fprintf(f, "\tstart_loop_counts();\n");
 
     fprintf(f, "\tfunc_1();\n");
     fprintf(f, "\tMPI_Finalize();\n");
@@ -391,6 +464,8 @@ Grammar* final_sequitur(CFG* cfg, int *final_splitter) {
     int splitter = grammar_splitter;
     Grammar *grammar = malloc(sizeof(Grammar));
     sequitur_init(grammar);
+    if(parametric)
+        sequitur_set_parametric(grammar);
     for(int ugi = 0; ugi < cfg->num_grammars; ugi++) {
         for(int i = 0; i < cfg->num_symbols[ugi]; i+=2) {
             int sym = cfg->unique_grammars[ugi][i];
@@ -407,16 +482,106 @@ Grammar* final_sequitur(CFG* cfg, int *final_splitter) {
 
 
 
+// Loop counts taken by one execution of the symbol
+long symbol_params(Symbol *sym) {
+    if(sym->exp == LOOP_PARAM)
+        return 1;           // a loop never has parameters inside
+    return IS_TERMINAL(sym) ? 0 : sym->exp * rule_params[sym->rule_head];
+}
+
+long count_rule_params(Grammar *grammar, uint32_t rule) {
+    if(rule_params[rule] < 0) {
+        long n = 0;
+        Symbol *sym;
+        RULE_FOREACH_SYMBOL(grammar, RULE(grammar, rule), sym) {
+            if(!IS_TERMINAL(sym))
+                count_rule_params(grammar, sym->rule_head);
+            n += symbol_params(sym);
+        }
+        rule_params[rule] = n;
+    }
+    return rule_params[rule];
+}
+
+/*
+ * Parametric loops
+ *
+ * The final grammar is parametric as well, a^LOOP_PARAM becomes a loop
+ * over next_loop_count(). Its loop counts are g_loop_counts[] in the
+ * proxy app (run-length encoded, as in the grammar), g_loop is the
+ * position of the next count. Each unique grammar is one segment of
+ * the main rule and starts at its own position, g_loop_offsets[g_ugi].
+ */
+void write_loop_counts(FILE* f, Grammar* grammar, int num_grammars) {
+    LoopCounts *counts = &grammar->loop_counts;
+
+    fprintf(f, "static const int g_loop_counts[] = {");
+    for(size_t i = 0; i < counts->len; i += 2)
+        fprintf(f, "%s%d, %d,", (i % 16) ? " " : "\n\t", counts->runs[i], counts->runs[i+1]);
+    // (0, 0) ends the array, for unique grammars without loops
+    fprintf(f, "\n\t0, 0};\n");
+
+    // Index of the first count of each unique grammar
+    long *starts = malloc(sizeof(long) * num_grammars);
+    long taken = 0;
+    int ugi = 0;
+    Symbol *sym;
+    starts[ugi++] = 0;
+    RULE_FOREACH_SYMBOL(grammar, RULE(grammar, grammar->rules_head), sym) {
+        if(IS_TERMINAL(sym) && sym->val >= grammar_splitter) {
+            if(ugi < num_grammars)
+                starts[ugi++] = taken;
+        } else {
+            taken += symbol_params(sym);
+        }
+    }
+
+    // As positions: (run, repeats left of the run)
+    fprintf(f, "static const LoopPos g_loop_offsets[] = {");
+    size_t run = 0;
+    long before = 0;        // counts in the runs before run
+    for(ugi = 0; ugi < num_grammars; ugi++) {
+        while(run < counts->len && starts[ugi] >= before + counts->runs[run+1]) {
+            before += counts->runs[run+1];
+            run += 2;
+        }
+        int left = run < counts->len ? counts->runs[run+1] - (starts[ugi] - before) : 0;
+        fprintf(f, ugi == num_grammars-1 ? "{%ld, %d}};\n\n" : "{%ld, %d}, ", (long)run/2, left);
+    }
+    free(starts);
+
+    fprintf(f, "static void start_loop_counts() {\n");
+    fprintf(f, "\tg_loop = g_loop_offsets[g_ugi];\n}\n");
+    fprintf(f, "static int next_loop_count() {\n");
+    fprintf(f, "\twhile(g_loop.left == 0) {\n");
+    fprintf(f, "\t\tg_loop.run++;\n");
+    fprintf(f, "\t\tg_loop.left = g_loop_counts[2*g_loop.run+1];\n\t}\n");
+    fprintf(f, "\tg_loop.left--;\n");
+    fprintf(f, "\treturn g_loop_counts[2*g_loop.run];\n}\n");
+    fprintf(f, "static void skip_loop_counts(long n) {\n");
+    fprintf(f, "\twhile(n > 0) {\n");
+    fprintf(f, "\t\tif(g_loop.left == 0) {\n");
+    fprintf(f, "\t\t\tg_loop.run++;\n");
+    fprintf(f, "\t\t\tg_loop.left = g_loop_counts[2*g_loop.run+1];\n");
+    fprintf(f, "\t\t\tcontinue;\n\t\t}\n");
+    fprintf(f, "\t\tint k = n < g_loop.left ? n : g_loop.left;\n");
+    fprintf(f, "\t\tg_loop.left -= k;\n");
+    fprintf(f, "\t\tn -= k;\n\t}\n}\n\n");
+}
+
 void handle_one_symbol(FILE* f, Symbol* sym, CST* cst) {
+    bool loop = sym->exp > 1 || (parametric && sym->exp == LOOP_PARAM);
     if(sym->exp > 1)
         fprintf(f, "\tfor(int i = 0; i < %d; i++)\n", sym->exp);
+    else if(loop)
+        fprintf(f, "\tfor(int i = 0, n = next_loop_count(); i < n; i++)\n");
 
     if(sym->val >= 0) {
         CallSignature *cs = &(cst->cs_list[sym->val]);
         write_vars_initialization(f, cs);
         write_call(f, cs);
     } else {
-        fprintf(f, "\t%sfunc_%d();\n", sym->exp>1?"\t":"", -1*sym->val);
+        fprintf(f, "\t%sfunc_%d();\n", loop?"\t":"", -1*sym->val);
     }
 }
 
@@ -426,6 +591,7 @@ static int  wt_loop_count;
 static int  wt_loop_call_id;
 static bool wt_loop_first_iter;
 static int  wt_loop_syms_per_iter;
+static long wt_loop_params;         // loop counts the calls of the loop took in the trace
 typedef struct WTHanddledSym_t {
     int sym_val;          // use terminal id as key
     UT_hash_handle hh;
@@ -495,8 +661,15 @@ void init_wt_loop(FILE* f, Symbol* sym, CST *cst, int n_reqs) {
 
     wt_handled_syms = NULL;
     wt_loop_count = n_reqs;
+    wt_loop_params = 0;
+    // Every iteration takes the same loop counts, the loop as a
+    // whole skips the counts its calls took in the trace
+    if(parametric)
+        fprintf(f, "\tg_loop_mark = g_loop;\n");
     fprintf(f, "\tg_remaining_reqs = %d;\n", wt_loop_count);
     fprintf(f, "\twhile(g_remaining_reqs > 0) {\n");
+    if(parametric)
+        fprintf(f, "\t\tg_loop = g_loop_mark;\n");
 
     handle_one_symbol(f, sym, cst);
 
@@ -527,6 +700,9 @@ void handle_one_symbol_pre(FILE* f, Symbol *sym, CST *cst) {
 
     if(wt_loop) {
 
+        if(parametric)
+            wt_loop_params += symbol_params(sym);
+
         if(sym->val >= 0)
             wt_loop_count -= get_wt_completed_reqs(&(cst->cs_list[sym->val]));
 
@@ -553,6 +729,8 @@ void handle_one_symbol_pre(FILE* f, Symbol *sym, CST *cst) {
         // Now its time to quit the loop
         if(wt_loop_count == 0 && wt_loop_syms_per_iter == 0) {
             fprintf(f, "\t}\n");
+            if(parametric && wt_loop_params > 0)
+                fprintf(f, "\tg_loop = g_loop_mark;\n\tskip_loop_counts(%ld);\n", wt_loop_params);
             wt_loop = false;
 
             WTHandledSym *entry, *tmp;
@@ -565,28 +743,31 @@ void handle_one_symbol_pre(FILE* f, Symbol *sym, CST *cst) {
 
     } else {
         int n_reqs;
-        if(enter_wt_loop(sym, cst, &n_reqs))
+        if(enter_wt_loop(sym, cst, &n_reqs)) {
             init_wt_loop(f, sym, cst, n_reqs);
-        else
+            if(parametric)
+                wt_loop_params += symbol_params(sym);
+        } else
             handle_one_symbol(f, sym, cst);
     }
 }
 
 void one_func_per_rule(FILE* f, Grammar* grammar, CST *cst, int final_splitter) {
 
-    Symbol *rule, *sym;
-    DL_FOREACH(grammar->rules, rule) {
+    Rule *rule;
+    Symbol *sym;
+    GRAMMAR_FOREACH_RULE(grammar, rule) {
         fprintf(f, "void func_%d();\n", -1*rule->val);
     }
     fprintf(f, "\n");
 
-    DL_FOREACH(grammar->rules, rule) {
+    GRAMMAR_FOREACH_RULE(grammar, rule) {
         fprintf(f, "void func_%d() {\n", -1*rule->val);
 
         if(rule->val == -1)
             fprintf(f, "\tif(g_ugi == 0) {\n");
 
-        DL_FOREACH(rule->rule_body, sym) {
+        RULE_FOREACH_SYMBOL(grammar, rule, sym) {
             if(sym->val < grammar_splitter) {
                 // TODO
                 handle_one_symbol_pre(f, sym, cst);
@@ -610,30 +791,38 @@ int main(int argc, char** argv) {
     char* directory = argv[1];
     char cfg_path[256];
     char cst_path[256];
-    char metadata_path[256];
     sprintf(cfg_path, "%s/grammars.dat", directory);
     sprintf(cst_path, "%s/funcs.dat", directory);
-    sprintf(metadata_path, "%s/pilgrim.mt", directory);
 
     // 0. Read metadata
-    GlobalMetadata* gm = read_metadata(metadata_path);
+    GlobalMetadata* gm = read_metadata(directory);
 
     // 1. Read CST and CFG
     CST* cst = read_cst(gm);
     CFG* cfg = read_cfg(gm);
+    parametric = gm->parametric_loops;
 
     // 2. Sequitur
     int final_splitter;
     Grammar *grammar = final_sequitur(cfg, &final_splitter);
-    int c; Symbol *rule; DL_COUNT(grammar->rules, rule,c);
+    int c = 0; Rule *rule; GRAMMAR_FOREACH_RULE(grammar, rule) c++;
     printf("Unique grammars: %d, Total rules: %d\n", cfg->num_grammars, c);
+    if(parametric) {
+        rule_params = malloc(sizeof(long) * grammar->rules_used);
+        for(uint32_t r = 0; r < grammar->rules_used; r++)
+            rule_params[r] = -1;
+        GRAMMAR_FOREACH_RULE(grammar, rule)
+            count_rule_params(grammar, rule - grammar->rules);
+    }
 
     // 3. Generate an proxy MPI program
     char source_file_path[256];
     sprintf(source_file_path, "%s/proxy_app.c", directory);
     FILE* f = fopen(source_file_path, "w");
 
-    write_prologue(f, grammar, cst);
+    write_prologue(f, grammar, cst, is_multithreaded(gm->ranks, cfg));
+    if(parametric)
+        write_loop_counts(f, grammar, cfg->num_grammars);
 
     one_func_per_rule(f, grammar, cst, final_splitter);
 
@@ -643,6 +832,8 @@ int main(int argc, char** argv) {
 
     sequitur_cleanup(grammar);
     fclose(f);
+    if(rule_params)
+        free(rule_params);
 
     free_metadata(gm);
     free_cfg(cfg);
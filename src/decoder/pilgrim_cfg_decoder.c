@@ -7,8 +7,11 @@
 #include <stdlib.h>
 #include "pilgrim.h"
 #include "pilgrim_reader.h"
+#include "pilgrim_timings.h"
 #include "pilgrim_utils.h"
+#include "pilgrim_varint.h"
 #include "uthash.h"
+#include "zstd.h"
 
 void print_rule(RuleHash *rule) {
     printf("rule %d, symbols: %d\n\t-->", rule->rule_id, rule->symbols);
@@ -25,6 +28,36 @@ void print_grammar(RuleHash *rules_table) {
 }
 
 
+/**
+ * Loop counts of a parametric grammar (PILGRIM_PARAMETRIC_LOOPS)
+ * Every symbol with exp 0 (LOOP_PARAM in pilgrim_sequitur.h)
+ * takes the next count, in decoding order.
+ */
+typedef struct LoopRuns_t {
+    int *runs;          // count, repeat pairs
+    int num_runs;
+    int run;
+    int left;           // repeats left of the current run
+} LoopRuns;
+
+static void loop_runs_init(LoopRuns *loops, int *runs, int num_runs) {
+    loops->runs = runs;
+    loops->num_runs = num_runs;
+    loops->run = 0;
+    loops->left = num_runs > 0 ? runs[1] : 0;
+}
+
+static int next_loop_count(LoopRuns *loops) {
+    while(loops->left == 0) {
+        loops->run++;
+        assert(loops->run < loops->num_runs);
+        loops->left = loops->runs[2*loops->run+1];
+    }
+    loops->left--;
+    return loops->runs[2*loops->run];
+}
+
+
 /**
  * Decompress a CFG by recursive rule application
  *
@@ -34,9 +67,10 @@ void print_grammar(RuleHash *rules_table) {
  * rule_id: id of the current rule to decode
  * start_rule_id: the id of the first rule, not always -1 due
  *                to inter-process compression
+ * loops: loop counts, NULL if exps are stored in the rules
  *
  */
-void rule_application(RuleHash* rules, int rule_id, int start_rule_id, int* decoded_symbols, int* pos) {
+void rule_application(RuleHash* rules, int rule_id, int start_rule_id, int* decoded_symbols, int* pos, LoopRuns* loops) {
     RuleHash *rule = NULL;
     HASH_FIND_INT(rules, &rule_id, rule);
     assert(rule != NULL);
@@ -44,10 +78,12 @@ void rule_application(RuleHash* rules, int rule_id, int start_rule_id, int* deco
     for(int i = 0; i < rule->symbols; i++) {
         int sym_val = rule->rule_body[2*i+0];
         int sym_exp = rule->rule_body[2*i+1];
+        if(loops && sym_exp == 0)
+            sym_exp = next_loop_count(loops);
         // Non-terminal, i.e., a rule
         if(sym_val < start_rule_id) {
             for(int j = 0; j < sym_exp; j++)
-                rule_application(rules, sym_val, start_rule_id, decoded_symbols, pos);
+                rule_application(rules, sym_val, start_rule_id, decoded_symbols, pos, loops);
         }
         // Terminal
         else {
@@ -73,29 +109,171 @@ void clean_rules(RuleHash* rules_table) {
 void free_cfg(CFG* cfg) {
     assert(cfg);
     free(cfg->num_symbols);
+    free(cfg->grammar_ids[0]);
     free(cfg->grammar_ids);
+    free(cfg->num_threads);
     for(int i = 0; i < cfg->num_grammars; i++) {
         free(cfg->unique_grammars[i]);
         clean_rules(cfg->intra_cfgs[i]);
     }
     free(cfg->unique_grammars);
+    if(cfg->joint_bins) {
+        for(int i = 0; i < cfg->num_grammars; i++)
+            free(cfg->joint_bins[i]);
+        free(cfg->joint_bins);
+    }
     free(cfg);
 }
 
 
+// Varints of a grammars.dat, see sequitur_dump()
+typedef struct VarintReader_t {
+    const unsigned char *buf;
+    size_t len;
+    size_t pos;
+} VarintReader;
+
+static uint64_t get_varint(VarintReader *r) {
+    uint64_t val;
+    size_t bytes = varint_decode(r->buf + r->pos, r->len - r->pos, &val);
+    assert(bytes > 0);
+    r->pos += bytes;
+    return val;
+}
+
+static int get_zigzag(VarintReader *r) {
+    uint64_t val = get_varint(r);
+    return ZIGZAG_DECODE(val);
+}
+
+static void get_varints(VarintReader *r, uint64_t *vals, size_t n) {
+    size_t bytes = varint_decode_bulk(r->buf + r->pos, r->len - r->pos, vals, n);
+    assert(n == 0 || bytes > 0);
+    r->pos += bytes;
+}
+
+// Undo the run-length encoding of sequitur_dump(), n values in total
+static void get_runs(VarintReader *r, int *vals, int n, bool delta) {
+    int prev = 0;
+    for(int i = 0; i < n;) {
+        int d = get_zigzag(r);
+        int repeat = get_varint(r);
+        assert(repeat > 0 && i + repeat <= n);
+        for(int j = 0; j < repeat; j++, i++)
+            prev = vals[i] = delta ? prev + d : d;
+    }
+}
+
+static RuleHash* read_compact_grammar(const unsigned char *data, size_t size, int nprocs,
+                                      size_t* original_integers, int* start_rule_id, CFG* cfg) {
+    size_t header_bytes = 6;
+    if(data[4] > GRAMMAR_FILE_VERSION) {
+        fprintf(stderr, "Unsupported grammars.dat version %d\n", data[4]);
+        exit(1);
+    }
+
+    VarintReader r = {data, size, header_bytes};
+    unsigned char *payload = NULL;
+    if(data[5] & GRAMMAR_FILE_ZSTD) {
+        size_t payload_bytes = get_varint(&r);
+        payload = malloc(payload_bytes);
+        size_t bytes = ZSTD_decompress(payload, payload_bytes, data + r.pos, size - r.pos);
+        assert(!ZSTD_isError(bytes) && bytes == payload_bytes);
+        r.buf = payload;
+        r.len = payload_bytes;
+        r.pos = 0;
+    }
+
+    // Grammar ids of all threads, rank-major
+    get_runs(&r, cfg->num_threads, nprocs, false);
+    int total_threads = 0;
+    for(int rank = 0; rank < nprocs; rank++)
+        total_threads += cfg->num_threads[rank];
+    cfg->grammar_ids[0] = malloc(sizeof(int) * total_threads);
+    get_runs(&r, cfg->grammar_ids[0], total_threads, true);
+    for(int rank = 1; rank < nprocs; rank++)
+        cfg->grammar_ids[rank] = cfg->grammar_ids[rank-1] + cfg->num_threads[rank-1];
+
+    cfg->num_grammars = get_varint(&r);
+    *start_rule_id = get_zigzag(&r);
+    *original_integers = get_varint(&r);
+    int rules = get_varint(&r);
+    size_t symbols = get_varint(&r);
+
+    uint64_t *heads = malloc(sizeof(uint64_t) * 2 * rules);
+    uint64_t *codes = malloc(sizeof(uint64_t) * symbols);
+    get_varints(&r, heads, 2 * rules);
+    get_varints(&r, codes, symbols);
+
+    size_t num_exps = 0;
+    for(size_t i = 0; i < symbols; i++)
+        num_exps += codes[i] & 1;
+    uint64_t *exps = malloc(sizeof(uint64_t) * num_exps);
+    get_varints(&r, exps, num_exps);
+
+    RuleHash* rules_table = NULL;
+    size_t sym = 0, exp = 0;
+    for(int i = 0; i < rules; i++) {
+        RuleHash *rule = malloc(sizeof(RuleHash));
+        rule->rule_id = *start_rule_id - (int)heads[2*i];
+        rule->symbols = heads[2*i+1];
+        rule->rule_body = (int*) malloc(sizeof(int)*rule->symbols*2);
+        for(int j = 0; j < rule->symbols; j++, sym++) {
+            uint64_t code = codes[sym];
+            rule->rule_body[2*j] = (code & 2) ? *start_rule_id - (int)(code >> 2) : ZIGZAG_DECODE(code >> 2);
+            rule->rule_body[2*j+1] = (code & 1) ? (int)exps[exp++] : 1;
+        }
+        HASH_ADD_INT(rules_table, rule_id, rule);
+    }
+
+    free(heads);
+    free(codes);
+    free(exps);
+    free(payload);
+    return rules_table;
+}
+
 /**
  * Read the inter-process compressed grammar
  * And store its rules in a hash-table.
  * It will be later used for decopmression.
  *
+ * Traces written before GRAMMAR_FILE_VERSION 1 have no magic,
+ * and store everything as raw integers.
+ *
  * in: path, nprocs
  * out: original_integers, start_rule_id, cfg
  */
 RuleHash* read_inter_compressed_grammar(const char* path, int nprocs, size_t* original_integers, int* start_rule_id, CFG* cfg) {
 
     FILE* f = fopen(path, "rb");
+    assert(f);
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if(size >= 6) {
+        unsigned char *data = malloc(size);
+        fread(data, 1, size, f);
+        if(memcmp(data, GRAMMAR_FILE_MAGIC, 4) == 0) {
+            RuleHash* rules_table = read_compact_grammar(data, size, nprocs, original_integers, start_rule_id, cfg);
+            free(data);
+            fclose(f);
+            return rules_table;
+        }
+        free(data);
+        fseek(f, 0, SEEK_SET);
+    }
 
-    fread(cfg->grammar_ids, sizeof(int), nprocs, f);
+    // Grammar ids of all threads, rank-major
+    fread(cfg->num_threads, sizeof(int), nprocs, f);
+    int total_threads = 0;
+    for(int rank = 0; rank < nprocs; rank++)
+        total_threads += cfg->num_threads[rank];
+    cfg->grammar_ids[0] = malloc(sizeof(int) * total_threads);
+    fread(cfg->grammar_ids[0], sizeof(int), total_threads, f);
+    for(int rank = 1; rank < nprocs; rank++)
+        cfg->grammar_ids[rank] = cfg->grammar_ids[rank-1] + cfg->num_threads[rank-1];
     fread(&cfg->num_grammars, sizeof(int), 1, f);
 
     // Read the inter-process compressed grammar
@@ -121,6 +299,7 @@ RuleHash* read_inter_compressed_grammar(const char* path, int nprocs, size_t* or
     //printf("Unique Grammars: %d, Start_rule_id: %d, Rules: %d, Uncompressed integers: %ld\n",
     //        cfg->num_grammars, *start_rule_id, rules, *original_integers);
 
+    fclose(f);
     return rules_table;
 }
 
@@ -130,8 +309,11 @@ RuleHash* read_inter_compressed_grammar(const char* path, int nprocs, size_t* or
  *
  * This function will read the grammar (integer array) to form
  * a hash table of rules
+ *
+ * With parametric loops, the grammar ends with its loop counts:
+ * | #runs | 1 | count | repeat | ... |, loop_runs points to the first count
  */
-RuleHash* read_one_unique_grammar(int* grammar, int *size, bool last_grammar) {
+RuleHash* read_one_unique_grammar(int* grammar, int *size, bool last_grammar, bool parametric, int **loop_runs, int *num_runs) {
     int pos = 0;
     RuleHash* rules_table = NULL;
 
@@ -154,11 +336,51 @@ RuleHash* read_one_unique_grammar(int* grammar, int *size, bool last_grammar) {
         HASH_ADD_INT(rules_table, rule_id, rule);
     }
 
+    *loop_runs = NULL;
+    *num_runs = 0;
+    if(parametric) {
+        *num_runs = grammar[pos++];
+        pos++;  // skip exp
+        *loop_runs = &(grammar[pos]);
+        pos += (*num_runs)*2;
+    }
+
     *size = pos;
     return rules_table;
 }
 
 
+/**
+ * CFG_JOINT, the terminals of the grammars are composite terminals,
+ * replace them with their call terminals, and keep their timing bins
+ * in cfg->joint_bins, one for each (val, exp) pair decoded.
+ */
+static void split_joint_terminals(GlobalMetadata* gm, CFG* cfg) {
+    int num_composites;
+    int* composites = read_joint_terminals(gm, &num_composites);
+
+    cfg->joint_bins = malloc(sizeof(int*) * cfg->num_grammars);
+    for(int ugi = 0; ugi < cfg->num_grammars; ugi++) {
+        int *symbols = cfg->unique_grammars[ugi];
+        cfg->joint_bins[ugi] = malloc(sizeof(int) * (cfg->num_symbols[ugi]/2 + 1));
+        for(int i = 0; i < cfg->num_symbols[ugi]; i += 2) {
+            cfg->joint_bins[ugi][i/2] = composites[2*symbols[i]+1];
+            symbols[i] = composites[2*symbols[i]];
+        }
+
+        // Also the rules, e.g., for the app generator
+        RuleHash *rule, *tmp;
+        HASH_ITER(hh, cfg->intra_cfgs[ugi], rule, tmp) {
+            for(int i = 0; i < rule->symbols; i++) {
+                if(rule->rule_body[2*i] >= 0)
+                    rule->rule_body[2*i] = composites[2*rule->rule_body[2*i]];
+            }
+        }
+    }
+    free(composites);
+}
+
+
 /**
  * Decompress the inter-process compressed grammar
  * The grammar is read by read_compressed_grammar()
@@ -172,7 +394,8 @@ CFG* read_cfg(GlobalMetadata* gm) {
     int nprocs = gm->ranks;
 
     CFG *cfg = malloc(sizeof(CFG));
-    cfg->grammar_ids = malloc(sizeof(int) * nprocs);
+    cfg->num_threads = malloc(sizeof(int) * nprocs);
+    cfg->grammar_ids = malloc(sizeof(int*) * nprocs);
 
     // 1. Read and decompress inter-process compressed grammar
     size_t original_integers;
@@ -182,7 +405,7 @@ CFG* read_cfg(GlobalMetadata* gm) {
     //print_grammar(inter_cfg);
     int* inter_decompressed_t = malloc(sizeof(int)*original_integers);
     int* inter_decompressed = inter_decompressed_t;
-    rule_application(inter_cfg, start_rule_id, start_rule_id, inter_decompressed, &pos);
+    rule_application(inter_cfg, start_rule_id, start_rule_id, inter_decompressed, &pos, NULL);
     clean_rules(inter_cfg);
     //printf("Finsihed decopmressing inter-process compressed grammar\n");
 
@@ -194,21 +417,31 @@ CFG* read_cfg(GlobalMetadata* gm) {
     for(int ugi = 0; ugi < cfg->num_grammars; ugi++) {
         int advance = 0;
         bool last_grammar = (ugi == cfg->num_grammars-1);
-        cfg->intra_cfgs[ugi] = read_one_unique_grammar(inter_decompressed, &advance, last_grammar);
+        int *loop_runs, num_runs;
+        cfg->intra_cfgs[ugi] = read_one_unique_grammar(inter_decompressed, &advance, last_grammar,
+                                                       gm->parametric_loops, &loop_runs, &num_runs);
+
+        LoopRuns loops, *ploops = gm->parametric_loops ? &loops : NULL;
 
         // First pass to copmute the number of symbols after decompression
         cfg->num_symbols[ugi] = 0;
-        rule_application(cfg->intra_cfgs[ugi], -1, -1, NULL, &cfg->num_symbols[ugi]);
+        loop_runs_init(&loops, loop_runs, num_runs);
+        rule_application(cfg->intra_cfgs[ugi], -1, -1, NULL, &cfg->num_symbols[ugi], ploops);
 
         // Second pass to fill in the symbols
         cfg->unique_grammars[ugi] = malloc(sizeof(int) * cfg->num_symbols[ugi]);
         cfg->num_symbols[ugi] = 0;
-        rule_application(cfg->intra_cfgs[ugi], -1, -1, cfg->unique_grammars[ugi], &cfg->num_symbols[ugi]);
+        loop_runs_init(&loops, loop_runs, num_runs);
+        rule_application(cfg->intra_cfgs[ugi], -1, -1, cfg->unique_grammars[ugi], &cfg->num_symbols[ugi], ploops);
 
         inter_decompressed += advance;
     }
 
     free(inter_decompressed_t);
+
+    cfg->joint_bins = NULL;
+    if(strcmp(gm->timing_mode, TIMING_MODE_CFG_JOINT) == 0)
+        split_joint_terminals(gm, cfg);
     return cfg;
 }
 
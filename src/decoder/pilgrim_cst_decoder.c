@@ -23,7 +23,7 @@ CST* read_cst(GlobalMetadata* gm) {
 
     short func_id;
     unsigned count;
-    int tid, entries, key_len, terminal, rank, duration, interval;
+    int entries, key_len, terminal, rank, duration, interval;
     fread(&entries, sizeof(int), 1, f);
 
     CST *cst = malloc(sizeof(CST));
@@ -38,12 +38,12 @@ CST* read_cst(GlobalMetadata* gm) {
         fread(&count, sizeof(unsigned), 1, f);
 
         fread(&func_id, sizeof(short), 1, f);
-        fread(&tid, sizeof(int), 1, f);
-        fread(buff, 1, key_len-sizeof(short)-sizeof(int), f);
+        fread(buff, 1, key_len-sizeof(short), f);
         assert(func_id >= 0);
 
         assert(terminal < entries);
         cst->cs_list[terminal].func_id = func_id;
+        cst->cs_list[terminal].count = count;
         read_record_args(func_id, buff, &(cst->cs_list[terminal]));
     }
 
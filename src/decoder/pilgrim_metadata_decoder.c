@@ -20,7 +20,30 @@ GlobalMetadata* read_metadata(const char* trace_dir) {
     fclose(fh);
 
     gm->trace_dir = strdup(trace_dir);
-    printf("Total procs: %d, Time resolution: %.1fus\n\n", gm->ranks, gm->time_resolution*1000000);
+    printf("Total procs: %d, Time resolution: %.1fus, Clock: %s", gm->ranks, gm->time_resolution*1000000, gm->clock);
+    if(gm->clock_ticks_per_second > 0)
+        printf(" (%.3f GHz)", gm->clock_ticks_per_second/1e9);
+    printf("\n");
+
+    if(gm->overhead_budget > 0)
+        printf("Overhead budget: %.2f%%, see timing_switches.dat for the dropped timings\n", gm->overhead_budget*100);
+    if(gm->query_counted)
+        printf("Local queries: counted only, not in the call sequence\n");
+
+    // Calls filtered out by PILGRIM_INCLUDE/PILGRIM_EXCLUDE are missing
+    // from the trace, list the shorter of the two sets
+    if(gm->func_filtered) {
+        int id, traced = 0;
+        for(id = 0; id <= ID_free; id++)
+            if(FUNC_FILTER_TEST(gm->func_filter, id)) traced++;
+        bool list_traced = traced <= ID_free + 1 - traced;
+        printf("Traced functions: %d of %d, %s:", traced, ID_free+1, list_traced ? "only" : "except");
+        for(id = 0; id <= ID_free; id++)
+            if((FUNC_FILTER_TEST(gm->func_filter, id) != 0) == list_traced)
+                printf(" %s", func_names[id]);
+        printf("\n");
+    }
+    printf("\n");
 
     return gm;
 }
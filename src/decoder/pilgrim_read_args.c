@@ -13,14 +13,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -37,44 +37,44 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_TAG;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
@@ -103,26 +103,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Info;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Win;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -133,8 +133,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -145,14 +145,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -163,14 +163,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -193,14 +193,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -217,8 +217,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -247,8 +247,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -258,21 +258,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Comm_copy_attr_function);
-			cs->arg_types[0] = TYPE_MPI_Comm_copy_attr_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Comm_delete_attr_function);
-			cs->arg_types[1] = TYPE_MPI_Comm_delete_attr_function;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -282,6 +270,12 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Comm_copy_attr_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_MPI_Comm_delete_attr_function;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Comm_get_parent:
@@ -289,8 +283,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -301,28 +295,27 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -339,8 +332,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -356,8 +349,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -368,23 +361,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Comm;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Request;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Win_set_name:
@@ -392,14 +382,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -410,14 +400,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -427,24 +417,24 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Add_error_code:
@@ -452,14 +442,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -470,8 +460,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -488,8 +478,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -524,14 +514,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -542,29 +532,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Request;
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Get_count:
@@ -578,14 +565,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -595,36 +582,24 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
+			cs->arg_directions[3] = DIRECTION_INOUT;
+			cs->arg_types[3] = TYPE_MEM_PTR;
+			cs->arg_sizes[3] = sizeof(MemPtrAttr);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Grequest_query_function);
 			cs->arg_types[0] = TYPE_MPI_Grequest_query_function;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Grequest_free_function);
 			cs->arg_types[1] = TYPE_MPI_Grequest_free_function;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(MPI_Grequest_cancel_function);
 			cs->arg_types[2] = TYPE_MPI_Grequest_cancel_function;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_INOUT;
-			cs->arg_types[3] = TYPE_MEM_PTR;
-			cs->arg_sizes[3] = sizeof(MemPtrAttr);
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Cartdim_get:
@@ -632,14 +607,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -656,14 +631,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -674,20 +649,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -698,28 +673,27 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[2]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[2])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -730,32 +704,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Info;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -772,32 +746,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -808,14 +782,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -834,14 +808,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -851,36 +825,34 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[6] = DIRECTION_IN;
+			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
+			cs->args[6] = calloc(cs->arg_sizes[6], 1);
+			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
+			pos += cs->arg_sizes[6];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] =  comm_size;
 			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
-			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
-			cs->arg_types[6] = TYPE_MPI_Datatype;
-			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Comm;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Info_create:
@@ -888,8 +860,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -900,20 +872,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -930,8 +902,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -948,14 +920,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -966,14 +938,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -984,32 +956,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -1020,14 +992,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -1038,8 +1010,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1050,11 +1022,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Request;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_File_read_all_end:
@@ -1062,8 +1031,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1092,41 +1061,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Comm_compare:
@@ -1134,20 +1100,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Comm;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1164,14 +1130,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1182,29 +1148,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Request;
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Query_thread:
@@ -1212,8 +1175,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1223,18 +1186,18 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Allgatherv:
@@ -1250,14 +1213,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1267,36 +1230,34 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[6] = DIRECTION_IN;
+			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
+			cs->args[6] = calloc(cs->arg_sizes[6], 1);
+			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
+			pos += cs->arg_sizes[6];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] =  comm_size;
 			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
-			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
-			cs->arg_types[6] = TYPE_MPI_Datatype;
-			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Comm;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Neighbor_allgather:
@@ -1310,14 +1271,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1328,20 +1289,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -1352,22 +1313,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1378,8 +1338,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1389,24 +1349,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_User_function);
-			cs->arg_types[0] = TYPE_MPI_User_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Op;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_User_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_T_enum_get_info:
@@ -1419,23 +1376,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
-			cs->arg_types[2] = TYPE_STRING;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_INOUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[2] = DIRECTION_OUT;
+			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Ssend_init:
@@ -1449,41 +1406,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Rsend_init:
@@ -1497,41 +1451,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Igatherv:
@@ -1547,14 +1498,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1564,48 +1515,43 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_INT;
-			cs->arg_lengths[4] =  comm_size;
-			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
-			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
-			cs->arg_types[5] = TYPE_INT;
-			cs->arg_lengths[5] =  comm_size;
-			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
-			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[4] = DIRECTION_IN;
+			cs->arg_types[4] = TYPE_INT;
+			cs->arg_lengths[4] =  comm_size;
+			assert(cs->arg_lengths[4] > 0);
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[5] = DIRECTION_IN;
+			cs->arg_types[5] = TYPE_INT;
+			cs->arg_lengths[5] =  comm_size;
+			assert(cs->arg_lengths[5] > 0);
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
+			cs->args[5] = calloc(cs->arg_sizes[5], 1);
+			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
+			pos += cs->arg_sizes[5];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Mrecv:
@@ -1619,20 +1565,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_INOUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Message;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -1649,31 +1595,30 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_MPI_Group;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Group;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Comm_test_inter:
@@ -1681,14 +1626,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -1699,8 +1644,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1711,14 +1656,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -1729,8 +1674,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1753,15 +1698,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -1769,14 +1710,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -1786,6 +1727,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_File_read_ordered_end:
@@ -1793,8 +1736,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1817,14 +1760,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -1841,20 +1784,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Group;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -1865,50 +1808,47 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 7);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] = *((int*) (cs->args[1]));
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
 			cs->arg_types[5] = TYPE_MPI_Aint;
-			cs->arg_sizes[5] = sizeof(MPI_Aint);
 			cs->arg_lengths[5] = *((int*) (cs->args[2]));
-			cs->arg_sizes[5] = sizeof(MPI_Aint) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = (*((int*) (cs->args[2])))*sizeof(MPI_Aint);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
 			cs->arg_lengths[6] = *((int*) (cs->args[3]));
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = (*((int*) (cs->args[3])))*sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -1919,26 +1859,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Win;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -1949,8 +1889,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1967,8 +1907,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -1979,14 +1919,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2013,32 +1953,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -2055,32 +1995,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -2091,14 +2031,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2114,37 +2054,36 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_types[2] = TYPE_MPI_Aint;
-			cs->arg_sizes[2] = sizeof(MPI_Aint);
-			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(MPI_Aint) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_MPI_Aint;
+			cs->arg_lengths[2] = *((int*) (cs->args[0]));
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const MPI_Aint);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Keyval_free:
@@ -2152,8 +2091,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2170,8 +2109,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2188,14 +2127,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2206,61 +2145,61 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 9);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_RANK_ENCODED;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_INT;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_RANK_ENCODED;
-			cs->arg_lengths[4] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);
+			cs->arg_sizes[4] = sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
-			cs->arg_lengths[5] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);
+			cs->arg_sizes[5] = sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Info;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = (*((int*) (cs->args[1])))*sizeof(const int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_lengths[4] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);
+			cs->arg_lengths[5] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);
 			break;
 		}
 		case ID_MPI_File_write_at:
@@ -2268,15 +2207,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -2284,14 +2219,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -2301,6 +2236,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_File_close:
@@ -2308,8 +2245,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2320,14 +2257,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2338,14 +2275,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Win;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2355,18 +2292,15 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_File_errhandler_function);
-			cs->arg_types[0] = TYPE_MPI_File_errhandler_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_File_errhandler_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_Group_free:
@@ -2374,8 +2308,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2392,14 +2326,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -2410,29 +2344,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Request;
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Comm_rank:
@@ -2440,14 +2371,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2458,11 +2389,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Request;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Win_post:
@@ -2470,20 +2398,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Win;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -2494,8 +2422,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2506,8 +2434,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2518,23 +2446,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Type_get_extent_x:
@@ -2542,8 +2467,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2566,20 +2491,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_TAG;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -2596,38 +2521,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[1]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] = *((int*) (cs->args[1]));
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -2638,14 +2560,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Win;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2656,38 +2578,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -2710,26 +2632,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -2740,20 +2662,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -2776,32 +2698,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -2812,8 +2734,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2835,38 +2757,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -2877,14 +2799,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -2895,8 +2817,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2907,8 +2829,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -2919,23 +2841,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Type_create_indexed_block:
@@ -2943,55 +2862,51 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] = *((int*) (cs->args[0]));
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Wait:
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
-			cs->arg_types[0] = TYPE_MPI_Request;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
 			cs->arg_types[1] = TYPE_MPI_Status;
 			cs->arg_sizes[1] = sizeof(int)*2;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Request;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_Type_create_hindexed:
@@ -2999,39 +2914,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = (*((int*) (cs->args[0])))*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
 			cs->arg_types[2] = TYPE_MPI_Aint;
-			cs->arg_sizes[2] = sizeof(MPI_Aint);
 			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(MPI_Aint) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const MPI_Aint);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_MPI_Datatype;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Dist_graph_neighbors:
@@ -3041,44 +2954,44 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[4] = DIRECTION_IN;
+			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = comm_size*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_INT;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[5] = (*((int*) (cs->args[4])))*sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[6] = comm_size*sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -3089,23 +3002,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_File_sync:
@@ -3113,8 +3026,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3133,14 +3046,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -3150,42 +3063,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[6] = DIRECTION_IN;
+			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
+			cs->args[6] = calloc(cs->arg_sizes[6], 1);
+			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
+			pos += cs->arg_sizes[6];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] =  comm_size;
 			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
-			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
-			cs->arg_types[6] = TYPE_MPI_Datatype;
-			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Comm;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Compare_and_swap:
@@ -3211,14 +3119,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -3229,8 +3137,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Win;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -3241,8 +3149,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3253,14 +3161,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3271,8 +3179,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -3283,8 +3191,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3317,14 +3225,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3335,8 +3243,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -3363,29 +3271,29 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = strlen(buff+pos)+1;
-			cs->arg_types[3] = TYPE_STRING;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_INOUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_STRING;
+			cs->arg_sizes[3] = strlen(buff+pos)+1;
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_File_call_errhandler:
@@ -3393,14 +3301,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3411,20 +3319,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -3441,47 +3349,44 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_INOUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Message;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_T_category_get_index:
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Test_cancelled:
@@ -3495,8 +3400,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3513,8 +3418,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3525,14 +3430,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3543,20 +3448,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -3567,8 +3472,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3584,39 +3489,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[1]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_INT;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_File_iread:
@@ -3624,8 +3527,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3636,23 +3539,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Dist_graph_neighbors_count:
@@ -3660,26 +3560,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -3690,32 +3590,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 10);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -3724,30 +3618,36 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
-			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = strlen(buff+pos)+1;
-			cs->arg_types[6] = TYPE_STRING;
-			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_INOUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_INT;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[6] = DIRECTION_OUT;
+			cs->arg_types[6] = TYPE_STRING;
+			cs->arg_sizes[6] = strlen(buff+pos)+1;
+			cs->args[6] = calloc(cs->arg_sizes[6], 1);
+			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
+			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_T_pvar_read:
@@ -3777,14 +3677,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -3802,72 +3702,66 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
 			cs->arg_types[2] = TYPE_MPI_Aint;
-			cs->arg_sizes[2] = sizeof(MPI_Aint);
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(MPI_Aint) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const MPI_Aint);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
 			cs->arg_lengths[3] =  comm_size;
 			assert(cs->arg_lengths[3] > 0);
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (comm_size)*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
 			cs->arg_types[6] = TYPE_MPI_Aint;
-			cs->arg_sizes[6] = sizeof(MPI_Aint);
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(MPI_Aint) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const MPI_Aint);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Datatype;
 			cs->arg_lengths[7] =  comm_size;
 			assert(cs->arg_lengths[7] > 0);
-			cs->arg_sizes[7] = sizeof(int) * cs->arg_lengths[7];
+			cs->arg_sizes[7] = (comm_size)*sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Neighbor_alltoallv:
@@ -3882,87 +3776,83 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Datatype;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Datatype;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Publish_name:
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -3973,8 +3863,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -3997,42 +3887,42 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
-			cs->arg_lengths[3] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];
+			cs->arg_sizes[3] = sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
+			cs->arg_lengths[3] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];
 			break;
 		}
 		case ID_MPI_Put:
@@ -4046,20 +3936,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -4070,20 +3960,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Win;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
@@ -4094,20 +3984,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Comm;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Win;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -4124,41 +4014,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Win_complete:
@@ -4166,8 +4053,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -4180,36 +4067,36 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
-			cs->arg_lengths[3] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];
+			cs->arg_sizes[3] = comm_size*sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = comm_size*sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_lengths[3] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];
 			break;
 		}
 		case ID_MPI_Info_get_valuelen:
@@ -4217,29 +4104,29 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Cart_sub:
@@ -4249,26 +4136,25 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[2] = DIRECTION_OUT;
+			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_MPI_Comm;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Info_get:
@@ -4276,35 +4162,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = strlen(buff+pos)+1;
-			cs->arg_types[3] = TYPE_STRING;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_STRING;
+			cs->arg_sizes[3] = strlen(buff+pos)+1;
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_File_iwrite_at:
@@ -4312,15 +4198,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -4328,23 +4210,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Request;
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Comm_spawn:
@@ -4353,55 +4234,52 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			pos = 0;
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Info;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
 			cs->arg_lengths[7] =  comm_size;
 			assert(cs->arg_lengths[7] > 0);
-			cs->arg_sizes[7] = sizeof(int) * cs->arg_lengths[7];
+			cs->arg_sizes[7] = comm_size*sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Group_intersection:
@@ -4409,20 +4287,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Group;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -4441,14 +4319,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -4458,42 +4336,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[6] = DIRECTION_IN;
+			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
+			cs->args[6] = calloc(cs->arg_sizes[6], 1);
+			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
+			pos += cs->arg_sizes[6];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] =  comm_size;
 			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
-			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
-			cs->arg_types[6] = TYPE_MPI_Datatype;
-			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Comm;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Ibcast:
@@ -4507,35 +4380,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Request;
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_File_read_at_all_begin:
@@ -4543,15 +4413,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -4559,17 +4425,19 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Info_get_nthkey:
@@ -4577,20 +4445,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -4601,8 +4469,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -4624,20 +4492,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -4648,29 +4516,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Win;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Type_indexed:
@@ -4678,39 +4543,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = (*((int*) (cs->args[0])))*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_MPI_Datatype;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Send_init:
@@ -4724,41 +4587,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_File_write:
@@ -4766,8 +4626,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -4778,14 +4638,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -4802,14 +4662,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -4820,14 +4680,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -4838,32 +4698,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = (*((int*) (cs->args[2])))*sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -4873,21 +4733,15 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -4897,6 +4751,12 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[0] = DIRECTION_IN;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Type_create_darray:
@@ -4904,73 +4764,69 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 10);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Datatype;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
+			cs->arg_directions[9] = DIRECTION_OUT;
+			cs->arg_types[9] = TYPE_MPI_Datatype;
+			cs->arg_sizes[9] = sizeof(int);
+			cs->args[9] = calloc(cs->arg_sizes[9], 1);
+			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
+			pos += cs->arg_sizes[9];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[2]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[2])))*sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] = *((int*) (cs->args[2]));
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = (*((int*) (cs->args[2])))*sizeof(const int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] = *((int*) (cs->args[2]));
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = (*((int*) (cs->args[2])))*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] = *((int*) (cs->args[2]));
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = (*((int*) (cs->args[2])))*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_INT;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Datatype;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
-			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
-			cs->arg_types[9] = TYPE_MPI_Datatype;
-			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Win_set_errhandler:
@@ -4978,14 +4834,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -4995,21 +4851,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Type_copy_attr_function);
-			cs->arg_types[0] = TYPE_MPI_Type_copy_attr_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Type_delete_attr_function);
-			cs->arg_types[1] = TYPE_MPI_Type_delete_attr_function;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -5019,42 +4863,48 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Type_copy_attr_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_MPI_Type_delete_attr_function;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Comm_accept:
 		{
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Type_create_struct:
@@ -5062,41 +4912,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = (*((int*) (cs->args[0])))*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
 			cs->arg_types[2] = TYPE_MPI_Aint;
-			cs->arg_sizes[2] = sizeof(MPI_Aint);
 			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(MPI_Aint) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const MPI_Aint);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
 			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[0])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_MPI_Datatype;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Gather:
@@ -5110,14 +4957,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -5128,26 +4975,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
@@ -5158,8 +5005,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
 			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5170,8 +5017,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5182,53 +5029,50 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 7);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
-			cs->arg_types[1] = TYPE_INT;
-			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_INT;
-			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->arg_types[1] = TYPE_INT;
+			cs->arg_lengths[1] = *((int*) (cs->args[0]));
+			cs->arg_sizes[1] = (*((int*) (cs->args[0])))*sizeof(const int);
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] = *((int*) (cs->args[0]));
+			cs->arg_sizes[2] = (*((int*) (cs->args[0])))*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_INT;
+			cs->arg_lengths[3] = *((int*) (cs->args[0]));
+			cs->arg_sizes[3] = (*((int*) (cs->args[0])))*sizeof(const int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Win_free_keyval:
@@ -5236,8 +5080,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5248,8 +5092,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5278,14 +5122,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -5296,20 +5140,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -5320,35 +5164,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_IN;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Datatype;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
 			cs->arg_directions[10] = DIRECTION_IN;
-			cs->arg_sizes[10] = sizeof(int);
 			cs->arg_types[10] = TYPE_MPI_Op;
+			cs->arg_sizes[10] = sizeof(int);
 			cs->args[10] = calloc(cs->arg_sizes[10], 1);
 			memcpy(cs->args[10], buff+pos, cs->arg_sizes[10]);
 			pos += cs->arg_sizes[10];
 			cs->arg_directions[11] = DIRECTION_IN;
-			cs->arg_sizes[11] = sizeof(int);
 			cs->arg_types[11] = TYPE_MPI_Win;
+			cs->arg_sizes[11] = sizeof(int);
 			cs->args[11] = calloc(cs->arg_sizes[11], 1);
 			memcpy(cs->args[11], buff+pos, cs->arg_sizes[11]);
 			pos += cs->arg_sizes[11];
 			cs->arg_directions[12] = DIRECTION_OUT;
-			cs->arg_sizes[12] = sizeof(int);
 			cs->arg_types[12] = TYPE_MPI_Request;
 			cs->args[12] = calloc(cs->arg_sizes[12], 1);
-			memcpy(cs->args[12], buff+pos, cs->arg_sizes[12]);
-			pos += cs->arg_sizes[12];
 			break;
 		}
 		case ID_MPI_Waitall:
@@ -5356,24 +5197,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MPI_Status;
-			cs->arg_sizes[2] = sizeof(int)*2;
 			cs->arg_lengths[2] = *((int*) (cs->args[0]));
-			cs->arg_sizes[2] = sizeof(MPI_Status) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = sizeof(int)*2;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -5384,14 +5223,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5402,30 +5241,28 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
 			cs->arg_types[3] = TYPE_MPI_Status;
-			cs->arg_sizes[3] = sizeof(int)*2;
 			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(MPI_Status) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = sizeof(int)*2;
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5435,18 +5272,15 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Comm_errhandler_function);
-			cs->arg_types[0] = TYPE_MPI_Comm_errhandler_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Comm_errhandler_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_Barrier:
@@ -5454,8 +5288,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5466,14 +5300,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5484,8 +5318,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5496,20 +5330,18 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_sizes[2] = sizeof(MPI_Offset);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Waitsome:
@@ -5517,38 +5349,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[0])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
 			cs->arg_types[4] = TYPE_MPI_Status;
-			cs->arg_sizes[4] = sizeof(int)*2;
 			cs->arg_lengths[4] = *((int*) (cs->args[0]));
-			cs->arg_sizes[4] = sizeof(MPI_Status) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = sizeof(int)*2;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -5559,14 +5388,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Win;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5577,23 +5406,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Group_range_excl:
@@ -5601,31 +5430,30 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_MPI_Group;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = 3 * (*((int*) (cs->args[1])));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*3*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Group;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Comm_split:
@@ -5633,26 +5461,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5668,8 +5496,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5685,8 +5513,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -5697,8 +5525,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5709,14 +5537,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5727,8 +5555,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5739,14 +5567,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5763,14 +5591,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5781,14 +5609,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5799,14 +5627,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5817,14 +5645,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5835,8 +5663,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5847,14 +5675,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -5871,15 +5699,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -5887,23 +5711,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Request;
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_File_write_all_end:
@@ -5911,8 +5734,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -5935,14 +5758,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -5953,23 +5776,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_File_write_at_all:
@@ -5977,15 +5800,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -5993,14 +5812,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -6010,6 +5829,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_File_get_group:
@@ -6017,14 +5838,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6035,15 +5856,13 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_File_iread_all:
@@ -6051,8 +5870,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6063,23 +5882,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_T_cvar_write:
@@ -6104,36 +5920,34 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Group;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Group;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
 			cs->arg_lengths[4] = *((int*) (cs->args[1]));
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -6144,38 +5958,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[0])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
 			cs->arg_types[4] = TYPE_MPI_Status;
-			cs->arg_sizes[4] = sizeof(int)*2;
 			cs->arg_lengths[4] = *((int*) (cs->args[0]));
-			cs->arg_sizes[4] = sizeof(MPI_Status) * cs->arg_lengths[4];
+			cs->arg_sizes[4] = sizeof(int)*2;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -6186,14 +5997,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6204,14 +6015,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -6222,14 +6033,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6240,8 +6051,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -6252,8 +6063,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6264,26 +6075,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_TAG;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -6294,8 +6105,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Request;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6312,14 +6123,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -6330,20 +6141,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -6354,26 +6165,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_IN;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Datatype;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
 			cs->arg_directions[10] = DIRECTION_IN;
-			cs->arg_sizes[10] = sizeof(int);
 			cs->arg_types[10] = TYPE_MPI_Op;
+			cs->arg_sizes[10] = sizeof(int);
 			cs->args[10] = calloc(cs->arg_sizes[10], 1);
 			memcpy(cs->args[10], buff+pos, cs->arg_sizes[10]);
 			pos += cs->arg_sizes[10];
 			cs->arg_directions[11] = DIRECTION_IN;
-			cs->arg_sizes[11] = sizeof(int);
 			cs->arg_types[11] = TYPE_MPI_Win;
+			cs->arg_sizes[11] = sizeof(int);
 			cs->args[11] = calloc(cs->arg_sizes[11], 1);
 			memcpy(cs->args[11], buff+pos, cs->arg_sizes[11]);
 			pos += cs->arg_sizes[11];
@@ -6383,18 +6194,15 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Win_errhandler_function);
-			cs->arg_types[0] = TYPE_MPI_Win_errhandler_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Win_errhandler_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_Init_thread:
@@ -6407,14 +6215,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Win;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6425,53 +6233,53 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 8);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = strlen(buff+pos)+1;
-			cs->arg_types[3] = TYPE_STRING;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_INOUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_STRING;
+			cs->arg_sizes[3] = strlen(buff+pos)+1;
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Group_difference:
@@ -6479,20 +6287,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Group;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -6519,23 +6327,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Win_wait:
@@ -6543,8 +6351,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6562,27 +6370,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
-			cs->arg_types[1] = TYPE_INT;
-			cs->arg_lengths[1] =  comm_size;
-			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] =  comm_size;
-			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -6593,29 +6383,45 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->arg_types[1] = TYPE_INT;
+			cs->arg_lengths[1] =  comm_size;
+			assert(cs->arg_lengths[1] > 0);
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] =  comm_size;
+			assert(cs->arg_lengths[2] > 0);
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_File_write_all:
@@ -6623,8 +6429,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6635,14 +6441,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -6658,36 +6464,36 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Win_flush_all:
@@ -6695,8 +6501,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -6707,14 +6513,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6725,15 +6531,13 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Status_set_cancelled:
@@ -6747,8 +6551,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -6771,20 +6575,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -6817,26 +6621,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = (*((int*) (cs->args[2])))*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -6847,22 +6651,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -6879,14 +6682,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -6897,26 +6700,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
@@ -6939,35 +6742,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Ialltoallw:
@@ -6982,78 +6782,69 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
 			cs->arg_lengths[3] =  comm_size;
 			assert(cs->arg_lengths[3] > 0);
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (comm_size)*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Datatype;
 			cs->arg_lengths[7] =  comm_size;
 			assert(cs->arg_lengths[7] > 0);
-			cs->arg_sizes[7] = sizeof(int) * cs->arg_lengths[7];
+			cs->arg_sizes[7] = (comm_size)*sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Ialltoallv:
@@ -7068,72 +6859,65 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Datatype;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Datatype;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Comm_free:
@@ -7141,8 +6925,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -7176,14 +6960,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -7194,20 +6978,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -7224,14 +7008,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -7242,20 +7026,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -7268,62 +7052,55 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_INT;
-			cs->arg_lengths[3] = *((int*) (cs->args[0]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_MPI_Info;
-			cs->arg_lengths[4] = *((int*) (cs->args[0]));
-			cs->arg_sizes[4] = sizeof(MPI_Info) * cs->arg_lengths[4];
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_INT;
+			cs->arg_lengths[3] = *((int*) (cs->args[0]));
+			cs->arg_sizes[3] = (*((int*) (cs->args[0])))*sizeof(const int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_IN;
+			cs->arg_types[4] = TYPE_MPI_Info;
+			cs->arg_lengths[4] = *((int*) (cs->args[0]));
+			cs->arg_sizes[4] = (*((int*) (cs->args[0])))*sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
 			cs->arg_lengths[8] =  comm_size;
 			assert(cs->arg_lengths[8] > 0);
-			cs->arg_sizes[8] = sizeof(int) * cs->arg_lengths[8];
+			cs->arg_sizes[8] = comm_size*sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			cs->arg_directions[2] = DIRECTION_INOUT;
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			break;
 		}
 		case ID_MPI_Comm_dup_with_info:
@@ -7331,20 +7108,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -7376,8 +7153,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -7388,14 +7165,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7406,15 +7183,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -7422,17 +7195,19 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Comm_get_errhandler:
@@ -7440,14 +7215,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7458,26 +7233,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_TAG;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Message;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -7494,14 +7269,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7512,8 +7287,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -7524,14 +7299,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Op;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7542,67 +7317,67 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 10);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_RANK_ENCODED;
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
 			cs->arg_lengths[3] = (*(int*) cs->args[1]);
+			cs->arg_sizes[3] = sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
-			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
-			cs->arg_types[5] = TYPE_RANK_ENCODED;
-			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_RANK_ENCODED;
 			cs->arg_lengths[6] = (*(int*) cs->args[4]);
+			cs->arg_sizes[6] = sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Info;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Comm;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
+			cs->arg_directions[5] = DIRECTION_IN;
+			cs->arg_types[5] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[5] = (*((int*) (cs->args[4])))*sizeof(const int);
+			cs->args[5] = calloc(cs->arg_sizes[5], 1);
+			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
+			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Info_delete:
@@ -7610,14 +7385,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7628,15 +7403,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -7644,23 +7415,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Request;
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Cart_rank:
@@ -7670,23 +7440,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			comm_size =  *((int*) (buff+pos));
 			pos += sizeof(int);
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = comm_size*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -7697,15 +7466,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -7713,14 +7478,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -7730,6 +7495,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Iallreduce:
@@ -7749,35 +7516,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Type_size:
@@ -7785,14 +7549,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7815,14 +7579,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -7833,14 +7597,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Op;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Win;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -7863,26 +7627,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -7899,20 +7663,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -7923,29 +7687,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Win;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Win_set_attr:
@@ -7953,14 +7714,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -7977,14 +7738,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8002,27 +7763,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
-			cs->arg_types[1] = TYPE_INT;
-			cs->arg_lengths[1] =  comm_size;
-			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] =  comm_size;
-			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -8033,53 +7776,66 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->arg_types[1] = TYPE_INT;
+			cs->arg_lengths[1] =  comm_size;
+			assert(cs->arg_lengths[1] > 0);
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] =  comm_size;
+			assert(cs->arg_lengths[2] > 0);
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_File_delete:
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_File_read_all:
@@ -8087,8 +7843,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -8099,14 +7855,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -8123,14 +7879,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8141,14 +7897,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8171,14 +7927,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8189,35 +7945,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Win_start:
@@ -8225,20 +7978,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Win;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8249,8 +8002,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -8268,72 +8021,66 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
 			cs->arg_lengths[3] =  comm_size;
 			assert(cs->arg_lengths[3] > 0);
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (comm_size)*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Datatype;
 			cs->arg_lengths[7] =  comm_size;
 			assert(cs->arg_lengths[7] > 0);
-			cs->arg_sizes[7] = sizeof(int) * cs->arg_lengths[7];
+			cs->arg_sizes[7] = (comm_size)*sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Alltoallv:
@@ -8348,66 +8095,62 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Datatype;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
-			cs->arg_lengths[1] =  3; //comm_size;
+			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] =  3; //comm_size;
+			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
-			cs->arg_lengths[5] =  3; //comm_size;
+			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
-			cs->arg_lengths[6] =  3; //comm_size;
+			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Datatype;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Exscan:
@@ -8427,26 +8170,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -8457,8 +8200,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Op;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -8481,56 +8224,41 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Keyval_create:
 		{
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Copy_function);
-			cs->arg_types[0] = TYPE_MPI_Copy_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Delete_function);
-			cs->arg_types[1] = TYPE_MPI_Delete_function;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8540,6 +8268,12 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Copy_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_MPI_Delete_function;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Type_vector:
@@ -8547,32 +8281,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -8582,21 +8316,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(MPI_Win_copy_attr_function);
-			cs->arg_types[0] = TYPE_MPI_Win_copy_attr_function;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Win_delete_attr_function);
-			cs->arg_types[1] = TYPE_MPI_Win_delete_attr_function;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8606,6 +8328,12 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Win_copy_attr_function;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_MPI_Win_delete_attr_function;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Type_match_size:
@@ -8613,20 +8341,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8649,26 +8377,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -8679,16 +8407,15 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8699,21 +8426,19 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Wtime:
@@ -8727,8 +8452,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -8745,14 +8470,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8763,35 +8488,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Comm;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_OUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Request;
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			break;
 		}
 		case ID_MPI_Info_free:
@@ -8799,8 +8521,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -8811,14 +8533,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8835,20 +8557,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Info;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -8859,8 +8581,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Win;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -8871,14 +8593,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8888,21 +8610,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8913,14 +8635,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -8930,21 +8652,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -8961,32 +8683,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -9003,8 +8725,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9015,14 +8737,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Info;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9044,14 +8766,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9062,35 +8784,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Info;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_File;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_INOUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Bsend:
@@ -9104,32 +8826,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -9153,39 +8875,35 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] =  comm_size;
-			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] =  comm_size;
+			assert(cs->arg_lengths[2] > 0);
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Irecv:
@@ -9199,38 +8917,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -9247,41 +8965,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_File_iwrite_at_all:
@@ -9289,15 +9004,11 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
 			cs->arg_types[2] = TYPE_MEM_PTR;
 			cs->arg_sizes[2] = sizeof(MemPtrAttr);
@@ -9305,23 +9016,22 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Datatype;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Request;
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Abort:
@@ -9329,14 +9039,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9353,14 +9063,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -9371,20 +9081,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_INOUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -9395,8 +9105,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9407,23 +9117,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Gatherv:
@@ -9439,14 +9146,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -9456,42 +9163,40 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_INT;
-			cs->arg_lengths[4] =  comm_size;
-			assert(cs->arg_lengths[4] > 0);
-			cs->arg_sizes[4] = sizeof(int) * cs->arg_lengths[4];
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
-			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
-			cs->arg_types[5] = TYPE_INT;
-			cs->arg_lengths[5] =  comm_size;
-			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
-			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_INT;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
+			cs->arg_directions[4] = DIRECTION_IN;
+			cs->arg_types[4] = TYPE_INT;
+			cs->arg_lengths[4] =  comm_size;
+			assert(cs->arg_lengths[4] > 0);
+			cs->arg_sizes[4] = comm_size*sizeof(const int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[5] = DIRECTION_IN;
+			cs->arg_types[5] = TYPE_INT;
+			cs->arg_lengths[5] =  comm_size;
+			assert(cs->arg_lengths[5] > 0);
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
+			cs->args[5] = calloc(cs->arg_sizes[5], 1);
+			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
+			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Comm_create:
@@ -9499,20 +9204,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Group;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -9523,8 +9228,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9535,14 +9240,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -9559,14 +9264,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Comm;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9583,8 +9288,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9595,23 +9300,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Request;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_File_set_errhandler:
@@ -9619,14 +9321,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9636,36 +9338,27 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
+			cs->arg_directions[4] = DIRECTION_INOUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
 			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(MPI_Datarep_conversion_function);
 			cs->arg_types[1] = TYPE_MPI_Datarep_conversion_function;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(MPI_Datarep_conversion_function);
 			cs->arg_types[2] = TYPE_MPI_Datarep_conversion_function;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_INOUT;
-			cs->arg_sizes[3] = sizeof(MPI_Datarep_extent_function);
 			cs->arg_types[3] = TYPE_MPI_Datarep_extent_function;
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_INOUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			break;
 		}
 		case ID_MPI_Init:
@@ -9691,33 +9384,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
-			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
-			cs->arg_types[2] = TYPE_INT;
-			cs->arg_lengths[2] =  comm_size;
-			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
-			cs->args[2] = calloc(cs->arg_sizes[2], 1);
-			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
-			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[2] = DIRECTION_IN;
+			cs->arg_types[2] = TYPE_INT;
+			cs->arg_lengths[2] =  comm_size;
+			assert(cs->arg_lengths[2] > 0);
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
+			cs->args[2] = calloc(cs->arg_sizes[2], 1);
+			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
+			pos += cs->arg_sizes[2];
 			break;
 		}
 		case ID_MPI_Ibarrier:
@@ -9725,17 +9417,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			break;
 		}
 		case ID_MPI_Type_create_f90_real:
@@ -9743,20 +9432,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -9767,21 +9456,19 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_T_cvar_get_num:
@@ -9789,8 +9476,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9801,31 +9488,30 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_MPI_Group;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Group;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Get_version:
@@ -9833,14 +9519,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -9850,12 +9536,6 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 7);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
 			cs->arg_types[1] = TYPE_MEM_PTR;
 			cs->arg_sizes[1] = sizeof(MemPtrAttr);
@@ -9863,14 +9543,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -9892,6 +9572,12 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
+			cs->arg_directions[0] = DIRECTION_IN;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_File_read:
@@ -9899,8 +9585,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9911,14 +9597,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -9935,8 +9621,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -9959,45 +9645,43 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[4] = DIRECTION_IN;
+			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[5] = DIRECTION_OUT;
+			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
+			cs->args[5] = calloc(cs->arg_sizes[5], 1);
+			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
+			pos += cs->arg_sizes[5];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
 			cs->arg_lengths[3] = *((int*) (cs->args[1]));
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (*((int*) (cs->args[1])))*sizeof(const int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
-			cs->arg_types[4] = TYPE_INT;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
-			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
-			cs->arg_types[5] = TYPE_MPI_Comm;
-			cs->args[5] = calloc(cs->arg_sizes[5], 1);
-			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
-			pos += cs->arg_sizes[5];
 			break;
 		}
 		case ID_MPI_Sendrecv:
@@ -10011,26 +9695,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -10041,32 +9725,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Datatype;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_IN;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_TAG;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
 			cs->arg_directions[10] = DIRECTION_IN;
-			cs->arg_sizes[10] = sizeof(int);
 			cs->arg_types[10] = TYPE_MPI_Comm;
+			cs->arg_sizes[10] = sizeof(int);
 			cs->args[10] = calloc(cs->arg_sizes[10], 1);
 			memcpy(cs->args[10], buff+pos, cs->arg_sizes[10]);
 			pos += cs->arg_sizes[10];
@@ -10083,14 +9767,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10101,8 +9785,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -10119,14 +9803,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10149,20 +9833,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Info;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Comm;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -10173,8 +9857,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Win;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -10185,8 +9869,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Datatype;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -10215,26 +9899,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Comm;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -10244,18 +9928,18 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_OUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Info_set:
@@ -10263,20 +9947,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Info;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->arg_types[2] = TYPE_STRING;
+			cs->arg_sizes[2] = strlen(buff+pos)+1;
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10293,14 +9977,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10311,29 +9995,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Request;
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_Raccumulate:
@@ -10347,20 +10028,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -10371,35 +10052,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Op;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Win;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Pack_size:
@@ -10407,26 +10085,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -10437,20 +10115,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10461,14 +10139,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10484,18 +10162,18 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[0] = DIRECTION_OUT;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Isend:
@@ -10509,38 +10187,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -10567,11 +10245,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Request;
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Unpack:
@@ -10585,14 +10260,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10603,20 +10278,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
@@ -10627,8 +10302,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -10638,20 +10313,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = strlen(buff+pos)+1;
 			cs->arg_types[4] = TYPE_STRING;
+			cs->arg_sizes[4] = strlen(buff+pos)+1;
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -10685,47 +10360,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Unpack_external:
 		{
 			INIT_CALL_ARGS(cs, 7);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = strlen(buff+pos)+1;
-			cs->arg_types[0] = TYPE_STRING;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
 			cs->arg_types[1] = TYPE_MEM_PTR;
 			cs->arg_sizes[1] = sizeof(MemPtrAttr);
@@ -10751,17 +10417,23 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
+			cs->arg_directions[0] = DIRECTION_IN;
+			cs->arg_types[0] = TYPE_STRING;
+			cs->arg_sizes[0] = strlen(buff+pos)+1;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
+			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
+			pos += cs->arg_sizes[0];
 			break;
 		}
 		case ID_MPI_Win_unlock:
@@ -10769,14 +10441,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Win;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10786,15 +10458,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 		{
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
-			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
-			cs->arg_types[0] = TYPE_MPI_Request;
-			cs->args[0] = calloc(cs->arg_sizes[0], 1);
-			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
-			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10804,6 +10470,9 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
+			cs->arg_directions[0] = DIRECTION_INOUT;
+			cs->arg_types[0] = TYPE_MPI_Request;
+			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			break;
 		}
 		case ID_MPI_Request_get_status:
@@ -10811,14 +10480,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Request;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -10835,22 +10504,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Request;
 			cs->arg_lengths[1] = *((int*) (cs->args[0]));
-			cs->arg_sizes[1] = sizeof(MPI_Request) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10867,8 +10535,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -10891,39 +10559,37 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_IN;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_INOUT;
-			cs->arg_sizes[4] = strlen(buff+pos)+1;
-			cs->arg_types[4] = TYPE_STRING;
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Info;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
+			cs->arg_directions[4] = DIRECTION_INOUT;
+			cs->arg_types[4] = TYPE_STRING;
+			cs->arg_sizes[4] = strlen(buff+pos)+1;
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[1] = DIRECTION_IN;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			break;
 		}
 		case ID_MPI_Status_set_elements:
@@ -10937,14 +10603,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Datatype;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10955,22 +10621,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -10981,31 +10646,30 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Group;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
+			cs->arg_directions[3] = DIRECTION_OUT;
+			cs->arg_types[3] = TYPE_MPI_Group;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = 3 * (*((int*) (cs->args[1])));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*3*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Group;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
 			break;
 		}
 		case ID_MPI_Get:
@@ -11019,20 +10683,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -11043,20 +10707,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Win;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
@@ -11067,26 +10731,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_TAG;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -11103,14 +10767,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Comm;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -11121,8 +10785,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 5);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11133,14 +10797,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -11157,8 +10821,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Win;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11175,32 +10839,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 6);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_TAG;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Comm;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Message;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
@@ -11223,32 +10887,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -11266,78 +10930,69 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
 			cs->arg_types[2] = TYPE_MPI_Aint;
-			cs->arg_sizes[2] = sizeof(MPI_Aint);
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(MPI_Aint) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const MPI_Aint);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
 			cs->arg_lengths[3] =  comm_size;
 			assert(cs->arg_lengths[3] > 0);
-			cs->arg_sizes[3] = sizeof(int) * cs->arg_lengths[3];
+			cs->arg_sizes[3] = (comm_size)*sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
 			cs->arg_types[6] = TYPE_MPI_Aint;
-			cs->arg_sizes[6] = sizeof(MPI_Aint);
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(MPI_Aint) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const MPI_Aint);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Datatype;
 			cs->arg_lengths[7] =  comm_size;
 			assert(cs->arg_lengths[7] > 0);
-			cs->arg_sizes[7] = sizeof(int) * cs->arg_lengths[7];
+			cs->arg_sizes[7] = (comm_size)*sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Ineighbor_alltoallv:
@@ -11352,72 +11007,65 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
+			cs->arg_directions[3] = DIRECTION_IN;
+			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
+			cs->args[3] = calloc(cs->arg_sizes[3], 1);
+			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
+			pos += cs->arg_sizes[3];
+			cs->arg_directions[4] = DIRECTION_OUT;
+			cs->arg_types[4] = TYPE_MEM_PTR;
+			cs->arg_sizes[4] = sizeof(MemPtrAttr);
+			cs->args[4] = calloc(cs->arg_sizes[4], 1);
+			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
+			pos += cs->arg_sizes[4];
+			cs->arg_directions[7] = DIRECTION_IN;
+			cs->arg_types[7] = TYPE_MPI_Datatype;
+			cs->arg_sizes[7] = sizeof(int);
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
+			cs->arg_directions[8] = DIRECTION_IN;
+			cs->arg_types[8] = TYPE_MPI_Comm;
+			cs->arg_sizes[8] = sizeof(int);
+			cs->args[8] = calloc(cs->arg_sizes[8], 1);
+			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
+			pos += cs->arg_sizes[8];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
 			cs->arg_lengths[1] =  comm_size;
 			assert(cs->arg_lengths[1] > 0);
-			cs->arg_sizes[1] = sizeof(int) * cs->arg_lengths[1];
+			cs->arg_sizes[1] = comm_size*sizeof(const int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] =  comm_size;
 			assert(cs->arg_lengths[2] > 0);
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = comm_size*sizeof(const int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
-			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
-			cs->arg_types[3] = TYPE_MPI_Datatype;
-			cs->args[3] = calloc(cs->arg_sizes[3], 1);
-			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
-			pos += cs->arg_sizes[3];
-			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_types[4] = TYPE_MEM_PTR;
-			cs->arg_sizes[4] = sizeof(MemPtrAttr);
-			cs->args[4] = calloc(cs->arg_sizes[4], 1);
-			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
-			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
 			cs->arg_lengths[5] =  comm_size;
 			assert(cs->arg_lengths[5] > 0);
-			cs->arg_sizes[5] = sizeof(int) * cs->arg_lengths[5];
+			cs->arg_sizes[5] = comm_size*sizeof(const int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_INT;
 			cs->arg_lengths[6] =  comm_size;
 			assert(cs->arg_lengths[6] > 0);
-			cs->arg_sizes[6] = sizeof(int) * cs->arg_lengths[6];
+			cs->arg_sizes[6] = comm_size*sizeof(const int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
-			cs->arg_types[7] = TYPE_MPI_Datatype;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
-			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
-			cs->arg_types[8] = TYPE_MPI_Comm;
-			cs->args[8] = calloc(cs->arg_sizes[8], 1);
-			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
-			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_MPI_Request;
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
-			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
-			pos += cs->arg_sizes[9];
 			break;
 		}
 		case ID_MPI_Wtick:
@@ -11431,22 +11079,21 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
 			cs->arg_lengths[2] = *((int*) (cs->args[1]));
-			cs->arg_sizes[2] = sizeof(int) * cs->arg_lengths[2];
+			cs->arg_sizes[2] = (*((int*) (cs->args[1])))*sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -11457,8 +11104,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_INOUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11469,14 +11116,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -11499,41 +11146,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_MPI_Op;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Comm;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Request;
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_MPI_File_get_errhandler:
@@ -11541,14 +11185,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -11565,41 +11209,38 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_RANK_ENCODED;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_IN;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_TAG;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Comm;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_OUT;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Request;
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
-			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
-			pos += cs->arg_sizes[6];
 			break;
 		}
 		case ID_MPI_Add_error_string:
@@ -11607,14 +11248,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_INOUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -11631,20 +11272,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_MPI_Datatype;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -11655,26 +11296,26 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_IN;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_INT;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
 			cs->arg_directions[6] = DIRECTION_IN;
-			cs->arg_sizes[6] = sizeof(int);
 			cs->arg_types[6] = TYPE_MPI_Datatype;
+			cs->arg_sizes[6] = sizeof(int);
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
 			cs->arg_directions[7] = DIRECTION_IN;
-			cs->arg_sizes[7] = sizeof(int);
 			cs->arg_types[7] = TYPE_MPI_Op;
+			cs->arg_sizes[7] = sizeof(int);
 			cs->args[7] = calloc(cs->arg_sizes[7], 1);
 			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
 			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_IN;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_MPI_Win;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
@@ -11685,8 +11326,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 1);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_OUT;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11697,14 +11338,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 2);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_IN;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_MPI_Errhandler;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
@@ -11733,8 +11374,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 4);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11745,14 +11386,14 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_IN;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_IN;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_MPI_Datatype;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
@@ -11763,8 +11404,8 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_File;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
@@ -11787,20 +11428,20 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 3);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_MPI_Comm;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
 			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = sizeof(int);
 			cs->arg_types[1] = TYPE_INT;
+			cs->arg_sizes[1] = sizeof(int);
 			cs->args[1] = calloc(cs->arg_sizes[1], 1);
 			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
 			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_OUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
@@ -11811,38 +11452,32 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			INIT_CALL_ARGS(cs, 13);
 			pos = 0;
 			cs->arg_directions[0] = DIRECTION_IN;
-			cs->arg_sizes[0] = sizeof(int);
 			cs->arg_types[0] = TYPE_INT;
+			cs->arg_sizes[0] = sizeof(int);
 			cs->args[0] = calloc(cs->arg_sizes[0], 1);
 			memcpy(cs->args[0], buff+pos, cs->arg_sizes[0]);
 			pos += cs->arg_sizes[0];
-			cs->arg_directions[1] = DIRECTION_OUT;
-			cs->arg_sizes[1] = strlen(buff+pos)+1;
-			cs->arg_types[1] = TYPE_STRING;
-			cs->args[1] = calloc(cs->arg_sizes[1], 1);
-			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
-			pos += cs->arg_sizes[1];
 			cs->arg_directions[2] = DIRECTION_INOUT;
-			cs->arg_sizes[2] = sizeof(int);
 			cs->arg_types[2] = TYPE_INT;
+			cs->arg_sizes[2] = sizeof(int);
 			cs->args[2] = calloc(cs->arg_sizes[2], 1);
 			memcpy(cs->args[2], buff+pos, cs->arg_sizes[2]);
 			pos += cs->arg_sizes[2];
 			cs->arg_directions[3] = DIRECTION_OUT;
-			cs->arg_sizes[3] = sizeof(int);
 			cs->arg_types[3] = TYPE_INT;
+			cs->arg_sizes[3] = sizeof(int);
 			cs->args[3] = calloc(cs->arg_sizes[3], 1);
 			memcpy(cs->args[3], buff+pos, cs->arg_sizes[3]);
 			pos += cs->arg_sizes[3];
 			cs->arg_directions[4] = DIRECTION_OUT;
-			cs->arg_sizes[4] = sizeof(int);
 			cs->arg_types[4] = TYPE_INT;
+			cs->arg_sizes[4] = sizeof(int);
 			cs->args[4] = calloc(cs->arg_sizes[4], 1);
 			memcpy(cs->args[4], buff+pos, cs->arg_sizes[4]);
 			pos += cs->arg_sizes[4];
 			cs->arg_directions[5] = DIRECTION_OUT;
-			cs->arg_sizes[5] = sizeof(int);
 			cs->arg_types[5] = TYPE_MPI_Datatype;
+			cs->arg_sizes[5] = sizeof(int);
 			cs->args[5] = calloc(cs->arg_sizes[5], 1);
 			memcpy(cs->args[5], buff+pos, cs->arg_sizes[5]);
 			pos += cs->arg_sizes[5];
@@ -11851,42 +11486,48 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
 			cs->args[6] = calloc(cs->arg_sizes[6], 1);
 			memcpy(cs->args[6], buff+pos, cs->arg_sizes[6]);
 			pos += cs->arg_sizes[6];
-			cs->arg_directions[7] = DIRECTION_OUT;
-			cs->arg_sizes[7] = strlen(buff+pos)+1;
-			cs->arg_types[7] = TYPE_STRING;
-			cs->args[7] = calloc(cs->arg_sizes[7], 1);
-			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
-			pos += cs->arg_sizes[7];
 			cs->arg_directions[8] = DIRECTION_INOUT;
-			cs->arg_sizes[8] = sizeof(int);
 			cs->arg_types[8] = TYPE_INT;
+			cs->arg_sizes[8] = sizeof(int);
 			cs->args[8] = calloc(cs->arg_sizes[8], 1);
 			memcpy(cs->args[8], buff+pos, cs->arg_sizes[8]);
 			pos += cs->arg_sizes[8];
 			cs->arg_directions[9] = DIRECTION_OUT;
-			cs->arg_sizes[9] = sizeof(int);
 			cs->arg_types[9] = TYPE_INT;
+			cs->arg_sizes[9] = sizeof(int);
 			cs->args[9] = calloc(cs->arg_sizes[9], 1);
 			memcpy(cs->args[9], buff+pos, cs->arg_sizes[9]);
 			pos += cs->arg_sizes[9];
 			cs->arg_directions[10] = DIRECTION_OUT;
-			cs->arg_sizes[10] = sizeof(int);
 			cs->arg_types[10] = TYPE_INT;
+			cs->arg_sizes[10] = sizeof(int);
 			cs->args[10] = calloc(cs->arg_sizes[10], 1);
 			memcpy(cs->args[10], buff+pos, cs->arg_sizes[10]);
 			pos += cs->arg_sizes[10];
 			cs->arg_directions[11] = DIRECTION_OUT;
-			cs->arg_sizes[11] = sizeof(int);
 			cs->arg_types[11] = TYPE_INT;
+			cs->arg_sizes[11] = sizeof(int);
 			cs->args[11] = calloc(cs->arg_sizes[11], 1);
 			memcpy(cs->args[11], buff+pos, cs->arg_sizes[11]);
 			pos += cs->arg_sizes[11];
 			cs->arg_directions[12] = DIRECTION_OUT;
-			cs->arg_sizes[12] = sizeof(int);
 			cs->arg_types[12] = TYPE_INT;
+			cs->arg_sizes[12] = sizeof(int);
 			cs->args[12] = calloc(cs->arg_sizes[12], 1);
 			memcpy(cs->args[12], buff+pos, cs->arg_sizes[12]);
 			pos += cs->arg_sizes[12];
+			cs->arg_directions[1] = DIRECTION_OUT;
+			cs->arg_types[1] = TYPE_STRING;
+			cs->arg_sizes[1] = strlen(buff+pos)+1;
+			cs->args[1] = calloc(cs->arg_sizes[1], 1);
+			memcpy(cs->args[1], buff+pos, cs->arg_sizes[1]);
+			pos += cs->arg_sizes[1];
+			cs->arg_directions[7] = DIRECTION_OUT;
+			cs->arg_types[7] = TYPE_STRING;
+			cs->arg_sizes[7] = strlen(buff+pos)+1;
+			cs->args[7] = calloc(cs->arg_sizes[7], 1);
+			memcpy(cs->args[7], buff+pos, cs->arg_sizes[7]);
+			pos += cs->arg_sizes[7];
 			break;
 		}
 		case ID_free:
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <math.h>
 #include "pilgrim.h"
 #include "pilgrim_timings.h"
 #include "pilgrim_reader.h"
@@ -41,3 +42,70 @@ double* read_tends(GlobalMetadata* gm) {
     sprintf(path, "%s/durations.dat", gm->trace_dir);
     return read_timings_core(path, gm);
 }
+
+int* read_joint_terminals(GlobalMetadata* gm, int* num_composites) {
+    char path[1024];
+    sprintf(path, "%s/durations.dat", gm->trace_dir);
+    FILE* f = fopen(path, "rb");
+    assert(f);
+    fread(num_composites, sizeof(int), 1, f);
+    int* composites = malloc(sizeof(int) * 2 * (*num_composites));
+    fread(composites, sizeof(int), 2 * (*num_composites), f);
+    fclose(f);
+    return composites;
+}
+
+// Bin 0 holds everything up to 10 microseconds
+static double bin_value(int bin) {
+    return bin == 0 ? 0 : pow(BASE, bin) * TIME_RESOLUTION;
+}
+
+double joint_duration(int bins) {
+    return bin_value(bins >> 16);
+}
+
+double joint_interval(int bins) {
+    return bin_value(bins & 0xffff);
+}
+
+TimingSwitch** read_timing_switches(GlobalMetadata* gm, int** num_switches) {
+    *num_switches = NULL;
+    if(gm->overhead_budget <= 0) return NULL;
+
+    char path[1024];
+    sprintf(path, "%s/timing_switches.dat", gm->trace_dir);
+    FILE* f = fopen(path, "rb");
+    if(f == NULL) return NULL;
+
+    TimingSwitch** switches = calloc(gm->ranks, sizeof(TimingSwitch*));
+    *num_switches = calloc(gm->ranks, sizeof(int));
+    for(int rank = 0; rank < gm->ranks; rank++) {
+        int n = 0;
+        fread(&n, sizeof(int), 1, f);
+        (*num_switches)[rank] = n;
+        if(n == 0) continue;
+        switches[rank] = malloc(sizeof(TimingSwitch) * n);
+        fread(switches[rank], sizeof(TimingSwitch), n, f);
+    }
+    fclose(f);
+    return switches;
+}
+
+void free_timing_switches(GlobalMetadata* gm, TimingSwitch** switches, int* num_switches) {
+    if(switches == NULL) return;
+    for(int rank = 0; rank < gm->ranks; rank++)
+        free(switches[rank]);
+    free(switches);
+    free(num_switches);
+}
+
+// Switches of the same function are in call order
+int timing_level(TimingSwitch* switches, int num_switches, int func_id, unsigned long call) {
+    int level = TIMING_LEVEL_EXACT;
+    for(int i = 0; i < num_switches; i++) {
+        if(switches[i].func_id != func_id) continue;
+        if(switches[i].call > call) break;
+        level = switches[i].level;
+    }
+    return level;
+}
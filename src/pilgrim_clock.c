@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pilgrim_clock.h"
+
+#ifdef PILGRIM_HAVE_TSC
+#include <cpuid.h>
+#endif
+
+#define TSC_CALIBRATION_TIME    (0.02)      // seconds
+
+ClockSource pilgrim_clock_source = CLOCK_SOURCE_MPI;
+double pilgrim_tsc_seconds_per_tick = 0;
+uint64_t pilgrim_tsc_base = 0;          // keep the tick counts small so the doubles stay precise
+
+static double monotonic_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#ifdef PILGRIM_HAVE_TSC
+/*
+ * An invariant TSC runs at a constant rate across
+ * P-/C-state changes, CPUID.80000007H:EDX[8]
+ */
+static bool has_invariant_tsc() {
+    unsigned int eax, ebx, ecx, edx;
+    if(!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007)
+        return false;
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1 << 8)) != 0;
+}
+
+/*
+ * Count the TSC ticks over a short busy wait
+ * measured by CLOCK_MONOTONIC
+ */
+static double calibrate_tsc() {
+    double t1 = monotonic_seconds();
+    uint64_t c1 = __rdtsc();
+    double t2 = t1;
+    while(t2 - t1 < TSC_CALIBRATION_TIME)
+        t2 = monotonic_seconds();
+    uint64_t c2 = __rdtsc();
+    return (c2 - c1) / (t2 - t1);
+}
+#endif
+
+void pilgrim_clock_init(int mpi_rank) {
+    pilgrim_clock_source = CLOCK_SOURCE_MPI;
+    pilgrim_tsc_seconds_per_tick = 0;
+
+    const char *clock = getenv("PILGRIM_CLOCK");
+    if(clock == NULL || strcmp(clock, PILGRIM_CLOCK_MPI) == 0)
+        return;
+
+    if(strcmp(clock, PILGRIM_CLOCK_TSC) == 0) {
+        #ifdef PILGRIM_HAVE_TSC
+        if(has_invariant_tsc()) {
+            pilgrim_tsc_seconds_per_tick = 1.0 / calibrate_tsc();
+            pilgrim_tsc_base = __rdtsc();
+            pilgrim_clock_source = CLOCK_SOURCE_TSC;
+            return;
+        }
+        #endif
+        // No usable TSC, clock_gettime() is the next best thing
+        pilgrim_clock_source = CLOCK_SOURCE_MONOTONIC;
+        return;
+    }
+
+    if(strcmp(clock, PILGRIM_CLOCK_MONOTONIC) == 0)
+        pilgrim_clock_source = CLOCK_SOURCE_MONOTONIC;
+    else if(mpi_rank == 0)
+        printf("[pilgrim] Unknown PILGRIM_CLOCK %s, use %s instead.\n", clock, PILGRIM_CLOCK_MPI);
+}
+
+const char* pilgrim_clock_name() {
+    if(pilgrim_clock_source == CLOCK_SOURCE_TSC)
+        return PILGRIM_CLOCK_TSC;
+    if(pilgrim_clock_source == CLOCK_SOURCE_MONOTONIC)
+        return PILGRIM_CLOCK_MONOTONIC;
+    return PILGRIM_CLOCK_MPI;
+}
+
+double pilgrim_clock_ticks_per_second() {
+    if(pilgrim_clock_source == CLOCK_SOURCE_TSC)
+        return 1.0 / pilgrim_tsc_seconds_per_tick;
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pilgrim_cst.h"
+#include "pilgrim_utils.h"
+
+#define CST_INITIAL_CAPACITY    1024        // slots
+#define CST_ARENA_CHUNK_SIZE    (64*1024)   // bytes
+
+static inline uint64_t mix64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * 64-bit hash of a call signature
+ * Consumes 8 bytes at a time, most keys are
+ * made of 4-byte integers and MemPtrAttrs.
+ */
+uint64_t cst_hash(const void *key, int key_len) {
+    const unsigned char *p = key;
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ ((uint64_t)key_len * 0xc2b2ae3d27d4eb4fULL);
+    uint64_t v;
+
+    int i = 0;
+    for(; i + 8 <= key_len; i += 8) {
+        memcpy(&v, p+i, sizeof(v));
+        h = (h ^ mix64(v)) * 0x9e3779b97f4a7c15ULL;
+        h = (h << 31) | (h >> 33);
+    }
+
+    if(i < key_len) {
+        v = 0;
+        memcpy(&v, p+i, key_len-i);
+        h = (h ^ mix64(v)) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    return mix64(h);
+}
+
+static void* arena_alloc(CallSignatureTable *cst, int size) {
+    CSTArenaChunk *chunk = cst->arena;
+    if(chunk == NULL || chunk->used + size > chunk->size) {
+        size_t chunk_size = size > CST_ARENA_CHUNK_SIZE ? size : CST_ARENA_CHUNK_SIZE;
+        chunk = pilgrim_malloc(sizeof(CSTArenaChunk) + chunk_size);
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        chunk->next = cst->arena;
+        cst->arena = chunk;
+    }
+    void *ptr = chunk->data + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+static void grow_slots(CallSignatureTable *cst) {
+    unsigned new_capacity = cst->capacity * 2;
+    CSTSlot *new_slots = pilgrim_malloc(sizeof(CSTSlot) * new_capacity);
+    memset(new_slots, 0, sizeof(CSTSlot) * new_capacity);
+
+    // Use the cached hashes, no key is touched
+    unsigned mask = new_capacity - 1;
+    for(unsigned i = 0; i < cst->capacity; i++) {
+        if(cst->slots[i].entry == NULL) continue;
+        unsigned idx = cst->slots[i].hash & mask;
+        while(new_slots[idx].entry)
+            idx = (idx + 1) & mask;
+        new_slots[idx] = cst->slots[i];
+    }
+
+    pilgrim_free(cst->slots, sizeof(CSTSlot) * cst->capacity);
+    cst->slots = new_slots;
+    cst->capacity = new_capacity;
+}
+
+void cst_init(CallSignatureTable *cst) {
+    cst->capacity = CST_INITIAL_CAPACITY;
+    cst->count = 0;
+    cst->slots = pilgrim_malloc(sizeof(CSTSlot) * cst->capacity);
+    memset(cst->slots, 0, sizeof(CSTSlot) * cst->capacity);
+
+    cst->entries_capacity = CST_INITIAL_CAPACITY / 2;
+    cst->entries = pilgrim_malloc(sizeof(RecordHash*) * cst->entries_capacity);
+
+    cst->arena = NULL;
+    slab_init(&cst->entry_slab, sizeof(RecordHash));
+}
+
+void cst_cleanup(CallSignatureTable *cst) {
+    slab_release(&cst->entry_slab);
+
+    CSTArenaChunk *chunk = cst->arena, *next;
+    while(chunk) {
+        next = chunk->next;
+        pilgrim_free(chunk, sizeof(CSTArenaChunk) + chunk->size);
+        chunk = next;
+    }
+
+    pilgrim_free(cst->entries, sizeof(RecordHash*) * cst->entries_capacity);
+    pilgrim_free(cst->slots, sizeof(CSTSlot) * cst->capacity);
+    cst->entries = NULL;
+    cst->slots = NULL;
+    cst->arena = NULL;
+    cst->count = 0;
+    cst->capacity = 0;
+    cst->entries_capacity = 0;
+}
+
+RecordHash* cst_find(CallSignatureTable *cst, const void *key, int key_len, uint64_t hash) {
+    unsigned mask = cst->capacity - 1;
+    unsigned idx = hash & mask;
+
+    CSTSlot *slot;
+    while((slot = &cst->slots[idx])->entry) {
+        if(slot->hash == hash && slot->key_len == key_len &&
+           memcmp(slot->entry->key, key, key_len) == 0)
+            return slot->entry;
+        idx = (idx + 1) & mask;
+    }
+    return NULL;
+}
+
+RecordHash* cst_insert(CallSignatureTable *cst, const void *key, int key_len, uint64_t hash) {
+    // Keep the load factor under 0.5
+    if((cst->count + 1) * 2 > cst->capacity)
+        grow_slots(cst);
+
+    if(cst->count == cst->entries_capacity) {
+        RecordHash **entries = pilgrim_malloc(sizeof(RecordHash*) * cst->entries_capacity * 2);
+        memcpy(entries, cst->entries, sizeof(RecordHash*) * cst->count);
+        pilgrim_free(cst->entries, sizeof(RecordHash*) * cst->entries_capacity);
+        cst->entries = entries;
+        cst->entries_capacity *= 2;
+    }
+
+    RecordHash *entry = slab_alloc(&cst->entry_slab);
+    memset(entry, 0, sizeof(RecordHash));
+    entry->key = arena_alloc(cst, key_len);
+    entry->key_len = key_len;
+    memcpy(entry->key, key, key_len);
+
+    unsigned mask = cst->capacity - 1;
+    unsigned idx = hash & mask;
+    while(cst->slots[idx].entry)
+        idx = (idx + 1) & mask;
+    cst->slots[idx].hash = hash;
+    cst->slots[idx].key_len = key_len;
+    cst->slots[idx].entry = entry;
+
+    cst->entries[cst->count++] = entry;
+    return entry;
+}
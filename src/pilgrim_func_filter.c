@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "pilgrim_func_filter.h"
+#include "pilgrim_func_ids.h"
+
+#define NUM_FUNCS   (ID_free + 1)
+
+typedef struct FuncClass_t {
+    const char *name;
+    const char *patterns[40];       // a trailing '*' matches any suffix
+} FuncClass;
+
+static FuncClass func_classes[] = {
+    { "p2p", {
+        "MPI_Send", "MPI_Bsend", "MPI_Ssend", "MPI_Rsend", "MPI_Recv",
+        "MPI_Isend", "MPI_Ibsend", "MPI_Issend", "MPI_Irsend", "MPI_Irecv",
+        "MPI_Sendrecv", "MPI_Sendrecv_replace",
+        "MPI_Send_init", "MPI_Bsend_init", "MPI_Ssend_init", "MPI_Rsend_init", "MPI_Recv_init",
+        "MPI_Start", "MPI_Startall", "MPI_Probe", "MPI_Iprobe", "MPI_Mprobe", "MPI_Improbe",
+        "MPI_Mrecv", "MPI_Imrecv", "MPI_Wait*", "MPI_Test", "MPI_Testany", "MPI_Testall",
+        "MPI_Testsome", "MPI_Test_cancelled", "MPI_Cancel", "MPI_Request_*", NULL } },
+    { "coll", {
+        "MPI_Barrier", "MPI_Bcast", "MPI_Gather*", "MPI_Scatter*", "MPI_Allgather*",
+        "MPI_Alltoall*", "MPI_Reduce", "MPI_Reduce_scatter*", "MPI_Allreduce", "MPI_Scan",
+        "MPI_Exscan", "MPI_Ibarrier", "MPI_Ibcast", "MPI_Igather*", "MPI_Iscatter*",
+        "MPI_Iallgather*", "MPI_Ialltoall*", "MPI_Ireduce*", "MPI_Iallreduce", "MPI_Iscan",
+        "MPI_Iexscan", "MPI_Neighbor_*", "MPI_Ineighbor_*", NULL } },
+    { "rma", {
+        "MPI_Win_*", "MPI_Put", "MPI_Get", "MPI_Accumulate", "MPI_Get_accumulate",
+        "MPI_Fetch_and_op", "MPI_Compare_and_swap", "MPI_Rput", "MPI_Rget",
+        "MPI_Raccumulate", "MPI_Rget_accumulate", "MPI_Alloc_mem", "MPI_Free_mem", NULL } },
+    { "io", {
+        "MPI_File_*", "MPI_Register_datarep", NULL } },
+    { "datatype", {
+        "MPI_Type_*", "MPI_Pack*", "MPI_Unpack*", "MPI_Get_address", "MPI_Get_count",
+        "MPI_Get_elements*", "MPI_Status_set_elements*", NULL } },
+    { "comm", {
+        "MPI_Comm_*", "MPI_Group_*", "MPI_Intercomm_*", "MPI_Cart*", "MPI_Graph*",
+        "MPI_Dist_graph*", "MPI_Topo_test", "MPI_Dims_create", NULL } },
+    { "tool", {
+        "MPI_T_*", NULL } },
+};
+
+static bool pattern_match(const char *pattern, const char *func_name) {
+    int len = strlen(pattern);
+    if(pattern[len-1] == '*')
+        return strncmp(pattern, func_name, len-1) == 0;
+    return strcmp(pattern, func_name) == 0;
+}
+
+/*
+ * Apply one token, either a class or a function name,
+ * returns false if it matches nothing.
+ */
+static bool apply_token(unsigned char *bitmap, const char *token, bool traced) {
+    int id, i;
+    for(size_t c = 0; c < sizeof(func_classes)/sizeof(FuncClass); c++) {
+        if(strcasecmp(token, func_classes[c].name) != 0) continue;
+        for(id = 0; id < NUM_FUNCS; id++) {
+            for(i = 0; func_classes[c].patterns[i]; i++) {
+                if(pattern_match(func_classes[c].patterns[i], func_names[id])) {
+                    if(traced) FUNC_FILTER_SET(bitmap, id);
+                    else FUNC_FILTER_CLEAR(bitmap, id);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Function name, MPI_ prefix is optional
+    for(id = 0; id < NUM_FUNCS; id++) {
+        const char *name = func_names[id];
+        if(strcmp(token, name) == 0 || (strncmp(name, "MPI_", 4) == 0 && strcmp(token, name+4) == 0)) {
+            if(traced) FUNC_FILTER_SET(bitmap, id);
+            else FUNC_FILTER_CLEAR(bitmap, id);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void apply_list(unsigned char *bitmap, const char *env, bool traced, bool verbose) {
+    const char *list = getenv(env);
+    if(list == NULL) return;
+
+    char *copy = strdup(list);
+    char *saveptr = NULL;
+    char *token = strtok_r(copy, ", ", &saveptr);
+    while(token) {
+        if(!apply_token(bitmap, token, traced) && verbose)
+            printf("[pilgrim] Unknown function or class %s in %s, ignored.\n", token, env);
+        token = strtok_r(NULL, ", ", &saveptr);
+    }
+    free(copy);
+}
+
+bool func_filter_init(unsigned char *bitmap, bool verbose) {
+    _Static_assert(NUM_FUNCS <= PILGRIM_MAX_FUNCS, "increase PILGRIM_MAX_FUNCS");
+
+    // PILGRIM_INCLUDE starts from nothing, otherwise everything is traced
+    bool include = getenv("PILGRIM_INCLUDE") != NULL;
+    memset(bitmap, include ? 0 : 0xff, FUNC_FILTER_BYTES);
+
+    apply_list(bitmap, "PILGRIM_INCLUDE", true, verbose);
+    apply_list(bitmap, "PILGRIM_EXCLUDE", false, verbose);
+
+    int id;
+    for(id = 0; id < NUM_FUNCS; id++)
+        if(!FUNC_FILTER_TEST(bitmap, id)) return true;
+    return false;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "mpi.h"
+#include "pilgrim_governor.h"
+#include "pilgrim_func_ids.h"
+#include "pilgrim_utils.h"
+#include "pilgrim_clock.h"
+
+static void add_switch(Governor *g, int func_id, int level, unsigned long call) {
+    if(g->num_switches == g->capacity) {
+        int capacity = g->capacity ? g->capacity * 2 : 16;
+        TimingSwitch *switches = pilgrim_malloc(sizeof(TimingSwitch) * capacity);
+        if(g->switches) {
+            memcpy(switches, g->switches, sizeof(TimingSwitch) * g->num_switches);
+            pilgrim_free(g->switches, sizeof(TimingSwitch) * g->capacity);
+        }
+        g->switches = switches;
+        g->capacity = capacity;
+    }
+    TimingSwitch *sw = &g->switches[g->num_switches++];
+    sw->func_id = func_id;
+    sw->level = level;
+    sw->call = call;
+    g->level[func_id] = level;
+}
+
+void governor_init(Governor *g, double budget) {
+    memset(g, 0, sizeof(Governor));
+    g->budget = budget;
+    g->epoch_start = pilgrim_wtime();
+}
+
+void governor_cleanup(Governor *g) {
+    if(g->switches)
+        pilgrim_free(g->switches, sizeof(TimingSwitch) * g->capacity);
+    g->switches = NULL;
+    g->num_switches = 0;
+    g->capacity = 0;
+}
+
+void governor_check(Governor *g, OverheadStats *stats, int mpi_rank, bool verbose) {
+    double now = pilgrim_wtime();
+    double allowed = g->budget * (now - g->epoch_start);
+
+    int f;
+    double overhead = 0;
+    for(f = 0; f <= ID_free; f++)
+        overhead += pilgrim_time(&stats[f]) - pilgrim_time(&g->epoch_base[f]);
+
+    // Drop the most expensive timings first, until the
+    // saved time brings us back under the budget
+    while(overhead > allowed) {
+        int victim = -1;
+        double victim_cost = 0;
+        for(f = 0; f <= ID_free; f++) {
+            double cost = stats[f].timing - g->epoch_base[f].timing;
+            if(g->level[f] == TIMING_LEVEL_EXACT && cost > victim_cost) {
+                victim = f;
+                victim_cost = cost;
+            }
+        }
+        if(victim < 0) break;
+
+        add_switch(g, victim, TIMING_LEVEL_AGGREGATED, g->calls[victim]);
+        overhead -= victim_cost;
+        if(verbose)
+            printf("[pilgrim] Rank %d: %s timings switched to aggregated after %lu calls\n",
+                    mpi_rank, func_names[victim], g->calls[victim]);
+    }
+
+    memcpy(g->epoch_base, stats, sizeof(OverheadStats) * PILGRIM_MAX_FUNCS);
+    g->epoch_start = now;
+    g->epoch_calls = 0;
+}
+
+void governor_merge(Governor *dst, Governor *src) {
+    int f, i;
+
+    // Every thread starts with exact timings
+    for(f = 0; f < PILGRIM_MAX_FUNCS; f++) {
+        if(dst->level[f] != TIMING_LEVEL_EXACT && src->calls[f] > 0)
+            add_switch(dst, f, TIMING_LEVEL_EXACT, dst->calls[f]);
+    }
+
+    for(i = 0; i < src->num_switches; i++) {
+        TimingSwitch *sw = &src->switches[i];
+        add_switch(dst, sw->func_id, sw->level, dst->calls[sw->func_id] + sw->call);
+    }
+
+    for(f = 0; f < PILGRIM_MAX_FUNCS; f++) {
+        dst->calls[f] += src->calls[f];
+        if(src->calls[f] > 0)
+            dst->level[f] = src->level[f];
+    }
+}
+
+/*
+ * File layout, in rank order:
+ * | int num_switches | TimingSwitch * num_switches |
+ */
+void governor_write_switches(Governor *g, const char *path, int mpi_rank, int mpi_size) {
+    int local_bytes = sizeof(TimingSwitch) * g->num_switches;
+    int counts[mpi_size], displs[mpi_size];
+    PMPI_Gather(&local_bytes, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    int i, total_bytes = 0;
+    for(i = 0; i < mpi_size; i++) {
+        displs[i] = total_bytes;
+        total_bytes += counts[i];
+    }
+
+    char *all = NULL;
+    if(mpi_rank == 0)
+        all = pilgrim_malloc(total_bytes > 0 ? total_bytes : 1);
+    PMPI_Gatherv(g->switches, local_bytes, MPI_BYTE, all, counts, displs, MPI_BYTE, 0, MPI_COMM_WORLD);
+    if(mpi_rank != 0) return;
+
+    FILE *f = fopen(path, "wb");
+    if(f == NULL) {
+        printf("[pilgrim] Open file: %s failed, errno: %d\n", path, errno);
+    } else {
+        for(i = 0; i < mpi_size; i++) {
+            int num_switches = counts[i] / sizeof(TimingSwitch);
+            fwrite(&num_switches, sizeof(int), 1, f);
+            fwrite(all + displs[i], 1, counts[i], f);
+        }
+        fclose(f);
+    }
+    pilgrim_free(all, total_bytes > 0 ? total_bytes : 1);
+}
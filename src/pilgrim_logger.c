@@ -13,35 +13,125 @@
 #include <math.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <sched.h>
+#include <time.h>
 
 #include "pilgrim.h"
 #include "pilgrim_sequitur.h"
+#include "pilgrim_repair.h"
+#include "pilgrim_cst.h"
 #include "pilgrim_timings.h"
+#include "pilgrim_overhead.h"
+#include "pilgrim_governor.h"
 #include "pilgrim_pattern_recognition.h"
 #include "utlist.h"
 #include "uthash.h"
 #include "mpi.h"
 
-pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
-
-
 #define OUTPUT_DIR                  "pilgrim-logs"
 char GRAMMAR_OUTPUT_PATH[256];
+char GRAMMAR_SPILL_PATH[256];
 char INTERVALS_OUTPUT_PATH[256];
 char DURATIONS_OUTPUT_PATH[256];
 char FUNCS_OUTPUT_PATH[256];
 char METADATA_OUTPUT_PATH[256];
-
-static int current_terminal_id = 0;
-static double cfg_ts = 0;
+char OVERHEAD_OUTPUT_PATH[256];
+char SWITCHES_OUTPUT_PATH[256];
 
 typedef struct OffsetNode_t {
     MPI_Offset offset;              // could be offset or size.
     struct OffsetNode_t *next;
 } OffsetNode;
 
-TimingNode *g_durations = NULL;
-TimingNode *g_intervals = NULL;
+
+#define SIG_CACHE_SIZE          8
+#define SIG_CACHE_SAMPLE_MASK   63          // time one of every 64 lookups (PILGRIM_DEBUG)
+
+/**
+ * MRU signature cache in front of the CST
+ *
+ * Polling loops (MPI_Test, MPI_Iprobe, etc.) repeat the same few
+ * call signatures back to back. The cache keeps the most recently
+ * used CST entries and compares the encoded key against them
+ * directly, so a hit neither hashes the key nor probes the CST.
+ */
+typedef struct SignatureCache_t {
+    RecordHash *entries[SIG_CACHE_SIZE];    // most recently used first
+    unsigned long lookups;
+    unsigned long hits;
+
+    // Sampled lookup costs, in cycles, only with PILGRIM_DEBUG
+    uint64_t hit_cycles, cst_cycles;        // cache hit, CST lookup (hash + probe)
+    unsigned long hit_samples, cst_samples;
+} SignatureCache;
+
+/**
+ * Run of identical consecutive calls, e.g., failed MPI_Test
+ * or MPI_Iprobe calls in a polling loop. The run is appended
+ * to the grammar as a single terminal with exp = count when
+ * it ends, instead of one terminal per call.
+ */
+typedef struct PendingRun_t {
+    RecordHash *entry;              // NULL if there is no pending run
+    short func_id;
+    bool timed;                     // false if the governor dropped the timings of func_id
+    TimingRun calls;                // count and timings of the calls
+} PendingRun;
+
+#define RUN_RING_SIZE           4096        // runs, power of 2
+#define RUN_RING_BATCH          256         // runs applied before the slots are handed back
+#define GRAMMAR_WORKER_IDLE_NS  20000       // sleep of the worker when all rings are empty
+
+/**
+ * Single-producer single-consumer ring of finished runs,
+ * only used with PILGRIM_ASYNC_GRAMMAR=1.
+ *
+ * The thread owning the context pushes the runs, the grammar
+ * worker thread pops them in batches and appends them to the
+ * grammar (and the timing grammars in CFG mode). So the grammar
+ * maintenance is off the critical path of the MPI calls.
+ */
+typedef struct RunRing_t {
+    PendingRun *slots;
+    unsigned long head __attribute__((aligned(64)));    // next run to pop, written by the worker
+    unsigned long tail __attribute__((aligned(64)));    // next run to push, written by the owner
+    unsigned long stalls;                               // pushes that found the ring full
+} RunRing;
+
+/**
+ * Per-thread recording context
+ *
+ * Every thread that makes MPI calls records into its own
+ * context, so write_record() does not need any lock.
+ * All contexts are merged into one at logger_exit(), see
+ * merge_recording_contexts().
+ */
+typedef struct RecordingContext_t {
+    int ctx_id;                     // creation order
+    int tid;                        // symbolic tid of the thread, see pilgrim_pthread_hooks.c
+    unsigned long records_count;
+
+    CallSignatureTable cst;         // CST shard of this thread
+    int current_terminal_id;        // terminal ids are local to the shard
+    SignatureCache sig_cache;       // entries of the CST shard above
+
+    Grammar grammar;                // Context-free-grammar for the MPI calls
+    TerminalBuffer terminals;       // the calls, only with PILGRIM_GRAMMAR_ALGO=repair
+    Grammar *thread_grammars;       // after merging, one grammar per tid in tid order
+    int num_threads;
+    PendingRun run;                 // not yet appended to the grammar
+    RunRing ring;                   // finished runs for the grammar worker (async grammar only)
+    OverheadStats *overhead;        // per function id, only with PILGRIM_PROFILE_OVERHEAD
+    Governor *governor;             // only with PILGRIM_OVERHEAD_BUDGET
+    TimingContext timing;           // used by __logger.timing
+
+    void *sig_buf;                  // scratch buffer to encode call signatures
+    int sig_buf_capacity;
+
+    struct RecordingContext_t *next;
+} RecordingContext;
+
+static __thread RecordingContext *tls_context = NULL;
 
 
 struct Logger {
@@ -52,19 +142,29 @@ struct Logger {
     bool recording;                 // set to true after initialization or after MPI_Info_set for on demand mode
     LocalMetadata local_metadata;   // local metadata information
 
-    RecordHash *hash_head;          // head of CST hash table
-
     OffsetNode *offset_list;        // List of MPI_Offset
 
-    Grammar grammar;                // Context-free-grammar for the MPI calls
-    Grammar durations_grammar;
-    Grammar intervals_grammar;
+    RecordingContext *contexts;     // list of all recording contexts, in ctx_id order
+    int num_contexts;
+    pthread_mutex_t contexts_mutex; // only taken when a thread creates its context
 
     double final_grammar_size;      // compressed grammar size (in KB)
     double final_cst_size;          // compressed cst size (in KB)
 
-    char *timing_mode;              // options defined in pilgrim_timing.h
+    const TimingRecorder *timing;   // resolved from PILGRIM_TIMING_MODE, see pilgrim_timings.h
     char *tracing_mode;             // options defined in pilgrim_logger.h
+    bool func_filtered;             // PILGRIM_INCLUDE/PILGRIM_EXCLUDE filtered out some functions
+    bool async_grammar;             // PILGRIM_ASYNC_GRAMMAR, grammars are built by grammar_worker
+    bool worker_stop;
+    pthread_t grammar_worker;
+    unsigned long worker_runs;      // runs appended by the worker
+    bool profile_overhead;          // PILGRIM_PROFILE_OVERHEAD, see pilgrim_overhead.h
+    double overhead_budget;         // PILGRIM_OVERHEAD_BUDGET, see pilgrim_governor.h, 0 if disabled
+    bool query_counted;             // PILGRIM_QUERY_CALLS=count, local queries are not added to the grammar
+    size_t max_grammar_bytes;       // PILGRIM_MAX_GRAMMAR_MB, 0 if the grammars are not bounded
+    bool repair;                    // PILGRIM_GRAMMAR_ALGO=repair, grammars are built at finalize, see pilgrim_repair.h
+    bool parametric_loops;          // PILGRIM_PARAMETRIC_LOOPS, loop counts are kept out of the digrams
+    unsigned char func_filter[FUNC_FILTER_BYTES];   // bitmap of traced function ids
 };
 
 // Global object to access the Logger fileds
@@ -92,12 +192,72 @@ bool logger_initialized() {
     return __logger.initialized;
 }
 
+bool logger_tracing(short func_id) {
+    return __logger.initialized && __logger.recording && FUNC_FILTER_TEST(__logger.func_filter, func_id);
+}
+
+bool logger_paused(short func_id) {
+    return __logger.initialized && !(__logger.recording && FUNC_FILTER_TEST(__logger.func_filter, func_id));
+}
+
+RecordingContext* create_recording_context() {
+    RecordingContext *ctx = pilgrim_malloc(sizeof(RecordingContext));
+    ctx->records_count = 0;
+    ctx->tid = pilgrim_pthread_add_get_tid();
+    ctx->thread_grammars = NULL;
+    ctx->num_threads = 0;
+    cst_init(&ctx->cst);
+    ctx->current_terminal_id = 0;
+    memset(&ctx->sig_cache, 0, sizeof(SignatureCache));
+    memset(&ctx->terminals, 0, sizeof(TerminalBuffer));
+    ctx->run.entry = NULL;
+    ctx->run.calls.count = 0;
+    memset(&ctx->ring, 0, sizeof(RunRing));
+    if(__logger.async_grammar)
+        ctx->ring.slots = pilgrim_malloc(sizeof(PendingRun) * RUN_RING_SIZE);
+    ctx->overhead = NULL;
+    if(__logger.profile_overhead) {
+        ctx->overhead = pilgrim_malloc(sizeof(OverheadStats) * PILGRIM_MAX_FUNCS);
+        memset(ctx->overhead, 0, sizeof(OverheadStats) * PILGRIM_MAX_FUNCS);
+    }
+    ctx->governor = NULL;
+    if(__logger.overhead_budget > 0) {
+        ctx->governor = pilgrim_malloc(sizeof(Governor));
+        governor_init(ctx->governor, __logger.overhead_budget);
+    }
+    ctx->sig_buf = NULL;
+    ctx->sig_buf_capacity = 0;
+    ctx->next = NULL;
+
+    sequitur_init(&(ctx->grammar));
+    if(__logger.parametric_loops)
+        sequitur_set_parametric(&(ctx->grammar));
+    __logger.timing->init(&ctx->timing);
+
+    pthread_mutex_lock(&__logger.contexts_mutex);
+    ctx->ctx_id = __logger.num_contexts++;
+    if(__logger.max_grammar_bytes) {
+        char spill_path[300];
+        sprintf(spill_path, "%s.%d.%d", GRAMMAR_SPILL_PATH, __logger.rank, ctx->ctx_id);
+        sequitur_set_limit(&ctx->grammar, __logger.max_grammar_bytes, spill_path);
+    }
+    LL_APPEND(__logger.contexts, ctx);
+    pthread_mutex_unlock(&__logger.contexts_mutex);
+
+    return ctx;
+}
+
+// Only the first call of each thread will create its context
+static inline RecordingContext* get_recording_context() {
+    if(tls_context == NULL)
+        tls_context = create_recording_context();
+    return tls_context;
+}
 
-void cleanup_cst(RecordHash* table) {
-    RecordHash *entry, *tmp;
-    HASH_ITER(hh, table, entry, tmp) {
-        HASH_DEL(table, entry);
 
+void cleanup_cst(CallSignatureTable *table) {
+    RecordHash *entry;
+    CST_FOREACH(table, entry) {
         TimingNode *elt, *tmp2;
         LL_FOREACH_SAFE(entry->durations, elt, tmp2) {
             LL_DELETE(entry->durations,  elt);
@@ -107,11 +267,8 @@ void cleanup_cst(RecordHash* table) {
             LL_DELETE(entry->intervals,  elt);
             pilgrim_free(elt, sizeof(TimingNode));
         }
-
-        pilgrim_free(entry->key, entry->key_len);
-        pilgrim_free(entry, sizeof(RecordHash));
     }
-    table = NULL;
+    cst_cleanup(table);
 }
 
 /**
@@ -126,22 +283,22 @@ void cleanup_cst(RecordHash* table) {
  * @return: the address of this memory space.
  *
  */
-void* serialize_cst(RecordHash *table, size_t *len) {
+void* serialize_cst(CallSignatureTable *table, size_t *len) {
     *len = sizeof(int);
 
-    RecordHash *entry, *tmp;
-    HASH_ITER(hh, table, entry, tmp) {
+    RecordHash *entry;
+    CST_FOREACH(table, entry) {
         *len = *len + entry->key_len + sizeof(int)*3 + sizeof(unsigned);
     }
 
-    int count = HASH_COUNT(table);
+    int count = CST_COUNT(table);
     void *res = pilgrim_malloc(*len);
     void *ptr = res;
 
     memcpy(ptr, &count, sizeof(int));
     ptr += sizeof(int);
 
-    HASH_ITER(hh, table, entry, tmp) {
+    CST_FOREACH(table, entry) {
 
         memcpy(ptr, &entry->terminal_id, sizeof(int));
         ptr = ptr + sizeof(int);
@@ -164,57 +321,46 @@ void* serialize_cst(RecordHash *table, size_t *len) {
 
 // Caller need to be sure that data containts no duplicated keys
 // We don't check it when inserting entries into the hash table.
-RecordHash* deserialize_cst(void *data) {
+void deserialize_cst(void *data, CallSignatureTable *table) {
     int num;
     memcpy(&num, data, sizeof(int));
 
     void *ptr = data + sizeof(int);
 
-    RecordHash *table = NULL, *entry = NULL;
+    cst_init(table);
+    int terminal_id, rank, key_len;
+    unsigned count;
     for(int i = 0; i < num; i++) {
-        entry = pilgrim_malloc(sizeof(RecordHash));
-
-        memcpy( &(entry->terminal_id), ptr, sizeof(int) );
+        memcpy( &terminal_id, ptr, sizeof(int) );
         ptr += sizeof(int);
 
-        memcpy( &(entry->rank), ptr, sizeof(int) );
+        memcpy( &rank, ptr, sizeof(int) );
         ptr += sizeof(int);
 
-        memcpy( &(entry->key_len), ptr, sizeof(int) );
+        memcpy( &key_len, ptr, sizeof(int) );
         ptr += sizeof(int);
 
-        memcpy( &(entry->count), ptr, sizeof(unsigned) );
+        memcpy( &count, ptr, sizeof(unsigned) );
         ptr += sizeof(unsigned);
 
-        entry->key = pilgrim_malloc(entry->key_len);
-        memcpy( entry->key, ptr, entry->key_len );
-        ptr += entry->key_len;
-
-        entry->durations = NULL;
-        entry->intervals = NULL;
-        HASH_ADD_KEYPTR(hh, table, entry->key, entry->key_len, entry);
+        RecordHash *entry = cst_insert(table, ptr, key_len, cst_hash(ptr, key_len));
+        entry->terminal_id = terminal_id;
+        entry->rank = rank;
+        entry->count = count;
+        ptr += key_len;
     }
-
-    return table;
 }
 
 
-RecordHash* copy_cst(RecordHash* origin) {
-    RecordHash* table = NULL;
-    RecordHash *entry, *tmp, *new_entry;
-    HASH_ITER(hh, origin, entry, tmp) {
-        new_entry = pilgrim_malloc(sizeof(RecordHash));
+void copy_cst(CallSignatureTable *origin, CallSignatureTable *table) {
+    cst_init(table);
+    RecordHash *entry, *new_entry;
+    CST_FOREACH(origin, entry) {
+        new_entry = cst_insert(table, entry->key, entry->key_len, cst_hash(entry->key, entry->key_len));
         new_entry->terminal_id = entry->terminal_id;
-        new_entry->key_len = entry->key_len;
         new_entry->rank = entry->rank;
         new_entry->count = entry->count;
-        new_entry->key = pilgrim_malloc(entry->key_len);
-        new_entry->durations = NULL;
-        new_entry->intervals = NULL;
-        memcpy(new_entry->key, entry->key, entry->key_len);
-        HASH_ADD_KEYPTR(hh, table, new_entry->key, new_entry->key_len, new_entry);
     }
-    return table;
 }
 
 /**
@@ -234,8 +380,9 @@ RecordHash* copy_cst(RecordHash* origin) {
  * phase 1: 100 --> 100
  * phase 2: 010 --> 000
  *
+ * @merged_table: output, only valid on rank 0
  */
-RecordHash* compress_csts() {
+void compress_csts(CallSignatureTable *local_cst, CallSignatureTable *merged_table) {
     int my_rank = __logger.rank;
     int other_rank;
     int mask = 1;
@@ -243,7 +390,7 @@ RecordHash* compress_csts() {
 
     int phases = pilgrim_ceil(pilgrim_log2(__logger.nprocs));
 
-    RecordHash* merged_table = copy_cst(__logger.hash_head);
+    copy_cst(local_cst, merged_table);
 
     for(int k = 0; k < phases; k++, mask*=2) {
         if(done) break;
@@ -283,25 +430,18 @@ RecordHash* compress_csts() {
                 ptr = ptr + sizeof(unsigned);
 
                 // key length bytes key
-                void *key = pilgrim_malloc(key_len);
-                memcpy(key, ptr, key_len);
+                void *key = ptr;
                 ptr = ptr + key_len;
 
                 // Check to see if this function entry is already in the table
-                RecordHash *entry = NULL;
-                HASH_FIND(hh, merged_table, key, key_len, entry);
+                uint64_t hash = cst_hash(key, key_len);
+                RecordHash *entry = cst_find(merged_table, key, key_len, hash);
                 if(entry) {
-                    pilgrim_free(key, key_len);
                     entry->count += count;
                 } else {                                // Not exist, add to hash table
-                    entry = (RecordHash*) pilgrim_malloc(sizeof(RecordHash));
-                    entry->key = key;
-                    entry->key_len = key_len;
+                    entry = cst_insert(merged_table, key, key_len, hash);
                     entry->rank = cst_rank;
                     entry->count = count;
-                    entry->durations = NULL;
-                    entry->intervals = NULL;
-                    HASH_ADD_KEYPTR(hh, merged_table, key, key_len, entry);
                 }
             }
             pilgrim_free(buf, size);
@@ -320,25 +460,24 @@ RecordHash* compress_csts() {
     if(my_rank == 0) {
         //linear_regression(merged_table);
         int terminal_id = 0;
-        RecordHash *entry, *tmp;
-        HASH_ITER(hh, merged_table, entry, tmp) {
+        RecordHash *entry;
+        CST_FOREACH(merged_table, entry) {
             entry->terminal_id = terminal_id++;
         }
     } else {
         cleanup_cst(merged_table);
     }
-    return merged_table;
 }
 
-void print_cst(RecordHash *cst) {
+void print_cst(CallSignatureTable *cst) {
     unsigned long long us[400], count[400];
     for(int i = 0; i < 400; i++) {
         us[i] = 0;
         count[i] = 0;
     }
 
-    RecordHash *entry, *tmp;
-    HASH_ITER(hh, cst, entry, tmp) {
+    RecordHash *entry;
+    CST_FOREACH(cst, entry) {
         short func_id;
         memcpy(&func_id, entry->key, sizeof(short));
 
@@ -346,7 +485,7 @@ void print_cst(RecordHash *cst) {
         count[func_id] += entry->count;
 
         int args[8];
-        int arg_start = sizeof(short) + sizeof(int); // func_id and tid
+        int arg_start = sizeof(short);  // func_id
 
         /*
         if(func_id == ID_MPI_Sendrecv) {
@@ -400,23 +539,24 @@ void print_cst(RecordHash *cst) {
  * we merge them by inserting them into one hash table
  *
  */
-int* dump_cst() {
+int* dump_cst(RecordingContext *ctx) {
 
     // 1. Inter-process copmression for CSTs
     // Eventually, rank 0 will have the compressed table.
-    RecordHash* compressed_cst = compress_csts();
+    CallSignatureTable compressed_cst;
+    compress_csts(&ctx->cst, &compressed_cst);
 
     // 2. Broadcast the merged CST to all ranks
     size_t cst_stream_size;
     void *cst_stream;
 
     if(__logger.rank == 0) {
-        cst_stream = serialize_cst(compressed_cst, &cst_stream_size);
+        cst_stream = serialize_cst(&compressed_cst, &cst_stream_size);
 
         /*
-        printf("compressed stream size: %d, %ld\n", HASH_COUNT(compressed_cst), cst_stream_size);
-        RecordHash *entry, *tmp;
-        HASH_ITER(hh, compressed_cst, entry, tmp) {
+        printf("compressed stream size: %d, %ld\n", CST_COUNT(&compressed_cst), cst_stream_size);
+        RecordHash *entry;
+        CST_FOREACH(&compressed_cst, entry) {
             short func_id;
             memcpy(&func_id, entry->key, sizeof(short));
             printf("func: %s, key len: %d\n", func_names[func_id], entry->key_len);
@@ -442,17 +582,17 @@ int* dump_cst() {
 
         // 3. Other rank get the compressed cst stream from rank 0
         // then convert it to the CST
-        compressed_cst = deserialize_cst(cst_stream);
+        deserialize_cst(cst_stream, &compressed_cst);
     }
 
     __logger.final_cst_size = cst_stream_size / 1024.0;
 
 
     // 4. Update function entry's terminal id
-    int *update_terminal_id = pilgrim_malloc(sizeof(int) * current_terminal_id);
-    RecordHash *entry, *tmp, *res;
-    HASH_ITER(hh, __logger.hash_head, entry, tmp) {
-        HASH_FIND(hh, compressed_cst, entry->key, entry->key_len, res);
+    int *update_terminal_id = pilgrim_malloc(sizeof(int) * ctx->current_terminal_id);
+    RecordHash *entry, *res;
+    CST_FOREACH(&ctx->cst, entry) {
+        res = cst_find(&compressed_cst, entry->key, entry->key_len, cst_hash(entry->key, entry->key_len));
         if(res)
             update_terminal_id[entry->terminal_id] = res->terminal_id;
         else
@@ -460,22 +600,244 @@ int* dump_cst() {
     }
 
     if(__logger.rank == 0 && __logger.debug)
-        print_cst(compressed_cst);
-    cleanup_cst(compressed_cst);
+        print_cst(&compressed_cst);
+    cleanup_cst(&compressed_cst);
     pilgrim_free(cst_stream, cst_stream_size);
     return update_terminal_id;
 }
 
-// Compose key: (func_id, arguments)
+// Compose key: (func_id, comm_size, arguments)
+// The key is encoded into the calling thread's scratch buffer,
+// it is only valid until the next call from the same thread.
 void* compose_call_signature(Record *record, int *key_len) {
-    return concat_function_args(record->func_id, record->tid, record->arg_count,
-            record->args, record->arg_sizes, record->comm_size, key_len);
+    RecordingContext *ctx = get_recording_context();
+    *key_len = concat_function_args(record->func_id, record->arg_count,
+            record->args, record->arg_sizes, record->comm_size, &ctx->sig_buf, &ctx->sig_buf_capacity);
+    return ctx->sig_buf;
+}
+
+// Used by the generated wrappers, which encode the arguments themselves.
+// Returns the thread's signature buffer with the header already encoded,
+// args_len bytes at its end are left to the caller.
+void* logger_get_signature_buffer(short func_id, int comm_size, int args_len, int *key_len) {
+    RecordingContext *ctx = get_recording_context();
+    *key_len = args_len + encode_signature_header(func_id, comm_size, args_len,
+                                            &ctx->sig_buf, &ctx->sig_buf_capacity);
+    return ctx->sig_buf;
+}
+
+static inline void sig_cache_insert(SignatureCache *cache, RecordHash *entry) {
+    memmove(&cache->entries[1], &cache->entries[0], sizeof(RecordHash*) * (SIG_CACHE_SIZE-1));
+    cache->entries[0] = entry;
+}
+
+/*
+ * Look up a signature, first in the MRU cache then in the CST.
+ * Return NULL if it is not in the CST yet.
+ */
+static inline RecordHash* lookup_signature(RecordingContext *ctx, const void *key, int key_len) {
+    SignatureCache *cache = &ctx->sig_cache;
+    // Only sample for the debug report, a sampled hit
+    // also does the CST lookup it is compared against
+    bool sampled = (cache->lookups++ & SIG_CACHE_SAMPLE_MASK) == 0 && __logger.debug;
+    uint64_t t1 = sampled ? pilgrim_cycles() : 0;
+
+    RecordHash *entry;
+    for(int i = 0; i < SIG_CACHE_SIZE && (entry = cache->entries[i]); i++) {
+        if(entry->key_len == key_len && memcmp(entry->key, key, key_len) == 0) {
+            // Move to front
+            memmove(&cache->entries[1], &cache->entries[0], sizeof(RecordHash*) * i);
+            cache->entries[0] = entry;
+            cache->hits++;
+            if(sampled) {
+                uint64_t t2 = pilgrim_cycles();
+                cache->hit_cycles += t2 - t1;
+                cache->hit_samples++;
+                // Also time the CST lookup we just avoided, for the report
+                cst_find(&ctx->cst, key, key_len, cst_hash(key, key_len));
+                cache->cst_cycles += pilgrim_cycles() - t2;
+                cache->cst_samples++;
+            }
+            return entry;
+        }
+    }
+
+    t1 = sampled ? pilgrim_cycles() : 0;
+    uint64_t hash = cst_hash(key, key_len);
+    entry = cst_find(&ctx->cst, key, key_len, hash);
+    if(entry) {
+        sig_cache_insert(cache, entry);
+        if(sampled) {
+            cache->cst_cycles += pilgrim_cycles() - t1;
+            cache->cst_samples++;
+        }
+    }
+    return entry;
+}
+
+// stats is the overhead profile of the call that ended the run, if any.
+// The grammar time is charged to that call, the timing time to the
+// function of the run, so the governor knows whose timings cost what.
+static void apply_run(RecordingContext *ctx, PendingRun *run, OverheadStats *stats) {
+    double t = stats ? pilgrim_wtime() : 0;
+    int terminal = run->entry->terminal_id;
+    if(__logger.timing->terminal)
+        terminal = __logger.timing->terminal(&ctx->timing, run->entry, run->timed ? &run->calls : NULL);
+    if(__logger.repair) {
+        terminal_buffer_push(&ctx->terminals, terminal, run->calls.count);
+    } else {
+        append_terminal(&(ctx->grammar), terminal, run->calls.count);
+        if(ctx->grammar.spill && sequitur_should_freeze(&ctx->grammar))
+            sequitur_freeze(&ctx->grammar);
+    }
+    OVERHEAD_PHASE(stats, grammar, t);
+    if(__logger.timing->record_run) {
+        __logger.timing->record_run(&ctx->timing, run->entry, &run->calls, run->timed);
+        OverheadStats *run_stats = stats ? &ctx->overhead[run->func_id] : NULL;
+        OVERHEAD_PHASE(run_stats, timing, t);
+    }
+}
+
+static void push_run(RunRing *ring, PendingRun *run) {
+    unsigned long tail = ring->tail;
+    while(tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == RUN_RING_SIZE) {
+        ring->stalls++;
+        sched_yield();
+    }
+    ring->slots[tail & (RUN_RING_SIZE-1)] = *run;
+    __atomic_store_n(&ring->tail, tail+1, __ATOMIC_RELEASE);
+}
+
+// Called by the grammar worker, or by logger_exit() once the worker is gone
+static unsigned long drain_ring(RecordingContext *ctx) {
+    RunRing *ring = &ctx->ring;
+    unsigned long head = ring->head;
+    unsigned long tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    unsigned long start = head;
+
+    while(head < tail) {
+        unsigned long end = head + RUN_RING_BATCH < tail ? head + RUN_RING_BATCH : tail;
+        for(; head < end; head++)
+            apply_run(ctx, &ring->slots[head & (RUN_RING_SIZE-1)], NULL);
+        __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+    }
+    return head - start;
+}
+
+static void* grammar_worker_main(void *arg) {
+    struct timespec idle = {0, GRAMMAR_WORKER_IDLE_NS};
+    RecordingContext *ctx;
+    while(true) {
+        // Read the flag before the last pass, so no run pushed before the stop is left behind
+        bool stop = __atomic_load_n(&__logger.worker_stop, __ATOMIC_ACQUIRE);
+
+        unsigned long drained = 0;
+        pthread_mutex_lock(&__logger.contexts_mutex);
+        LL_FOREACH(__logger.contexts, ctx)
+            drained += drain_ring(ctx);
+        pthread_mutex_unlock(&__logger.contexts_mutex);
+        __logger.worker_runs += drained;
+
+        if(stop) break;
+        if(drained == 0)
+            nanosleep(&idle, NULL);
+    }
+    return NULL;
+}
+
+static void start_grammar_worker() {
+    __logger.worker_stop = false;
+    __logger.worker_runs = 0;
+    if(pthread_create(&__logger.grammar_worker, NULL, grammar_worker_main, NULL) != 0) {
+        if(__logger.rank == 0)
+            printf("[pilgrim] Failed to create the grammar worker thread, build grammars synchronously.\n");
+        __logger.async_grammar = false;
+        pilgrim_free(tls_context->ring.slots, sizeof(PendingRun) * RUN_RING_SIZE);
+        tls_context->ring.slots = NULL;
+    }
+}
+
+// Drain all rings, after this the grammars are only touched by logger_exit()
+static void stop_grammar_worker() {
+    __atomic_store_n(&__logger.worker_stop, true, __ATOMIC_RELEASE);
+    pthread_join(__logger.grammar_worker, NULL);
+    __logger.async_grammar = false;
+
+    unsigned long stalls = 0;
+    RecordingContext *ctx;
+    LL_FOREACH(__logger.contexts, ctx) {
+        __logger.worker_runs += drain_ring(ctx);
+        stalls += ctx->ring.stalls;
+        pilgrim_free(ctx->ring.slots, sizeof(PendingRun) * RUN_RING_SIZE);
+        ctx->ring.slots = NULL;
+    }
+
+    if(__logger.debug && __logger.rank == 0)
+        printf("[pilgrim] Grammar worker on rank 0: %lu runs, %lu stalls on a full ring\n",
+                __logger.worker_runs, stalls);
+}
+
+static void flush_run(RecordingContext *ctx, OverheadStats *stats) {
+    PendingRun *run = &ctx->run;
+    if(run->entry == NULL) return;
+
+    if(__logger.async_grammar) {
+        double t = stats ? pilgrim_wtime() : 0;
+        push_run(&ctx->ring, run);
+        OVERHEAD_PHASE(stats, grammar, t);
+    } else
+        apply_run(ctx, run, stats);
+
+    run->entry = NULL;
+    run->calls.count = 0;
+}
+
+static RecordHash* insert_signature(RecordingContext *ctx, void *key, int key_len, double tstart) {
+    RecordHash *entry = cst_insert(&ctx->cst, key, key_len, cst_hash(key, key_len));
+    sig_cache_insert(&ctx->sig_cache, entry);
+    entry->rank = __logger.rank;
+    entry->terminal_id = ctx->current_terminal_id++;
+    entry->count = 1;
+    entry->tstart = tstart;
+    entry->ext_tstart = tstart;
+
+    // TODO check if we need to store lossless info
+    entry->durations = NULL;
+    entry->intervals = NULL;
+    return entry;
+}
+
+// Extend the pending run with one call of entry, or end it and start a new one
+static inline void extend_run(RecordingContext *ctx, RecordHash *entry, Record *record, bool timed, OverheadStats *stats) {
+    PendingRun *run = &ctx->run;
+    if(run->entry == entry) {
+        run->calls.count++;
+        run->calls.last_tstart = record->tstart;
+        run->calls.duration += record->tend - record->tstart;
+    } else {
+        flush_run(ctx, stats);
+        run->entry = entry;
+        run->func_id = record->func_id;
+        run->timed = timed;
+        run->calls.count = 1;
+        run->calls.tstart = record->tstart;
+        run->calls.last_tstart = record->tstart;
+        run->calls.duration = record->tend - record->tstart;
+    }
 }
 
 void write_record(Record record) {
     if (!__logger.recording) return;
 
-    pthread_mutex_lock(&g_mutex);
+    int key_len;
+    void *key = compose_call_signature(&record, &key_len);
+    write_record_signature(record, key, key_len);
+}
+
+void write_record_signature(Record record, void *key, int key_len) {
+    if (!__logger.recording) return;
+
+    RecordingContext *ctx = get_recording_context();
 
     /*
     if(__logger.rank == 0)
@@ -484,98 +846,226 @@ void write_record(Record record) {
        record.tend-__logger.local_metadata.tstart, func_names[record.func_id]);
     */
 
-    __logger.local_metadata.records_count++;
-
-    int key_len;
-    void *key = compose_call_signature(&record, &key_len);
+    ctx->records_count++;
+
+    // The signature was encoded between tend and now
+    OverheadStats *stats = NULL;
+    double t = 0;
+    if(ctx->overhead) {
+        stats = &ctx->overhead[record.func_id];
+        t = pilgrim_wtime();
+        stats->calls++;
+        stats->pmpi += record.tend - record.tstart;
+        stats->signature += (t - __logger.local_metadata.tstart) - record.tend;
+    }
 
-    RecordHash *entry = NULL;
-    HASH_FIND(hh, __logger.hash_head, key, key_len, entry);
+    RecordHash *entry = lookup_signature(ctx, key, key_len);
     if(entry) {                         // Found
         int c = entry->count;
         entry->avg_duration = (entry->avg_duration*c+(record.tend-record.tstart))/(c+1);
         entry->count++;
-        pilgrim_free(key, key_len);
     } else {                            // Not exist, add to hash table
-        entry = (RecordHash*) pilgrim_malloc(sizeof(RecordHash));
-        entry->key = key;
-        entry->key_len = key_len;
-        entry->rank = __logger.rank;
-        entry->terminal_id = current_terminal_id++;
-        entry->count = 1;
-        entry->tstart = record.tstart;
-        entry->ext_tstart = record.tstart;
-
-        // TODO check if we need to store lossless info
-        entry->durations = NULL;
-        entry->intervals = NULL;
+        entry = insert_signature(ctx, key, key_len, record.tstart);
+    }
+    OVERHEAD_PHASE(stats, cst, t);
 
-        HASH_ADD_KEYPTR(hh, __logger.hash_head, entry->key, entry->key_len, entry);
+    bool timed = true;
+    if(ctx->governor) {
+        timed = governor_timed(ctx->governor, record.func_id);
+        if(ctx->governor->epoch_calls >= GOVERNOR_EPOCH)
+            governor_check(ctx->governor, ctx->overhead, __logger.rank, __logger.debug);
     }
 
     // Store timings infomraiton
-    if(strcmp(__logger.timing_mode, TIMING_MODE_AGGREGATED) == 0) {
-        handle_aggregated_timing(entry, &record);
-    } else if(strcmp(__logger.timing_mode, TIMING_MODE_CFG) == 0) {
-        int duration_id, interval_id;
-        handle_cfg_timing(entry, &record, &duration_id, &interval_id);
-        double t1 = PMPI_Wtime();
-        append_terminal(&(__logger.intervals_grammar), interval_id, 1);
-        append_terminal(&(__logger.durations_grammar), duration_id, 1);
-        double t2 = PMPI_Wtime();
-        cfg_ts += (t2 - t1);
-    } else if(strcmp(__logger.timing_mode, TIMING_MODE_LOSSLESS) == 0) {
-        // For lossless mode, we directly store tstart in interval
-        // and tend in duration for easier postprocessing
-        TimingNode *tstart_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        TimingNode *tend_node   = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        tstart_node->val = record.tstart;
-        tend_node->val   = record.tend;
-        LL_PREPEND(g_intervals, tstart_node);
-        LL_PREPEND(g_durations, tend_node);
-    } else {
-        // For SZ, ZFP, HIST
-        TimingNode *dur_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        TimingNode *int_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        dur_node->val = record.tend - record.tstart;
-        int_node->val = record.tstart - entry->tstart;
-        entry->tstart = record.tstart;
+    if(__logger.timing->record && timed) {
+        __logger.timing->record(&ctx->timing, entry, &record);
+        OVERHEAD_PHASE(stats, timing, t);
+    }
 
-        LL_PREPEND(entry->durations, dur_node);
-        LL_PREPEND(entry->intervals, int_node);
+    // Grow the MPI call grammar, one run at a time
+    extend_run(ctx, entry, &record, timed, stats);
+}
 
-        TimingNode *dur_node2 = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        dur_node2->val = dur_node->val;
-        LL_PREPEND(g_durations, dur_node2);
-        TimingNode *int_node2 = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
-        int_node2->val = int_node->val;
-        LL_PREPEND(g_intervals, int_node2);
+/**
+ * Counter-only path of the local queries, PILGRIM_QUERY_1/PILGRIM_QUERY_2_END
+ * No timings and no overhead profile, the call signature is only counted.
+ * The call is appended to the grammar as an untimed run, or not at all
+ * with PILGRIM_QUERY_CALLS=count.
+ */
+void write_query_signature(short func_id, void *key, int key_len) {
+    if (!__logger.recording) return;
+
+    RecordingContext *ctx = get_recording_context();
+    ctx->records_count++;
+
+    RecordHash *entry = lookup_signature(ctx, key, key_len);
+    if(entry)
+        entry->count++;
+    else
+        entry = insert_signature(ctx, key, key_len, pilgrim_wtime() - __logger.local_metadata.tstart);
+
+    if(!__logger.query_counted) {
+        Record record = {.func_id = func_id};
+        extend_run(ctx, entry, &record, false, NULL);
     }
+}
 
-    // Grow the MPI call grammar
-    append_terminal(&(__logger.grammar), entry->terminal_id, 1);
+static int compare_contexts(RecordingContext *a, RecordingContext *b) {
+    if(a->tid != b->tid)
+        return a->tid - b->tid;
+    return a->ctx_id - b->ctx_id;
+}
 
-    pthread_mutex_unlock(&g_mutex);
+/**
+ * Merge all recording contexts into one
+ *
+ * Contexts are merged in (tid, ctx_id) order. Call signatures do not
+ * contain the tid, they are all merged into the CST of the first
+ * context. Each tid keeps its own grammar (dst->thread_grammars), the
+ * one of its only context, or if threads reused the tid, one rebuilt
+ * from all of its contexts.
+ * Timings are merged in the same order, i.e., grouped by thread.
+ */
+RecordingContext* merge_recording_contexts() {
+    if(__logger.async_grammar)
+        stop_grammar_worker();
+
+    RecordingContext *ctx, *tmp;
+    LL_FOREACH(__logger.contexts, ctx) {
+        flush_run(ctx, NULL);
+        if(__logger.repair) {
+            repair_build(&ctx->grammar, ctx->terminals.data, ctx->terminals.len);
+            terminal_buffer_free(&ctx->terminals);
+        }
+        if(ctx->grammar.spill && ctx->grammar.spill->segments && __logger.debug && __logger.rank == 0)
+            printf("[pilgrim] Grammar of context %d on rank 0 was frozen into %d segments\n", ctx->ctx_id, ctx->grammar.spill->segments);
+    }
+
+    LL_SORT(__logger.contexts, compare_contexts);
+    RecordingContext *dst = __logger.contexts;
+
+    int num_threads = 1;
+    LL_FOREACH(dst, ctx)
+        if(ctx->next && ctx->next->tid != ctx->tid) num_threads++;
+    dst->thread_grammars = pilgrim_malloc(sizeof(Grammar) * num_threads);
+    dst->thread_grammars[0] = dst->grammar;
+    dst->num_threads = 1;
+    int last_tid = dst->tid;
+
+    LL_FOREACH_SAFE(dst->next, ctx, tmp) {
+        int *update_terminal_id = pilgrim_malloc(sizeof(int) * ctx->current_terminal_id);
+
+        RecordHash *entry, *found;
+        CST_FOREACH(&ctx->cst, entry) {
+            uint64_t hash = cst_hash(entry->key, entry->key_len);
+            found = cst_find(&dst->cst, entry->key, entry->key_len, hash);
+            if(found) {
+                update_terminal_id[entry->terminal_id] = found->terminal_id;
+                found->avg_duration = (found->avg_duration*found->count + entry->avg_duration*entry->count)
+                                        / (found->count + entry->count);
+                found->count += entry->count;
+                found->durations = merge_timing_list(found->durations, entry->durations);
+                found->intervals = merge_timing_list(found->intervals, entry->intervals);
+            } else {
+                found = cst_insert(&dst->cst, entry->key, entry->key_len, hash);
+                int key_len = found->key_len;
+                void *key = found->key;
+                *found = *entry;
+                found->key = key;
+                found->key_len = key_len;
+                update_terminal_id[entry->terminal_id] = dst->current_terminal_id;
+                found->terminal_id = dst->current_terminal_id++;
+            }
+        }
+        // Timing lists have been moved to dst
+        cst_cleanup(&ctx->cst);
+
+        // Joint timing modes have their own terminals in the grammar
+        int *update_grammar_id = update_terminal_id;
+        if(__logger.timing->merge_terminals)
+            update_grammar_id = __logger.timing->merge_terminals(&dst->timing, &ctx->timing, update_terminal_id);
+
+        bool new_tid = ctx->tid != last_tid;
+        last_tid = ctx->tid;
+        if(new_tid && !(ctx->next && ctx->next->tid == ctx->tid)) {
+            // The only context of its tid keeps its grammar (and spill file), with the terminal ids of dst
+            sequitur_update(&ctx->grammar, update_grammar_id);
+            dst->thread_grammars[dst->num_threads++] = ctx->grammar;
+        } else {
+            // Rebuilt with the terminal ids of dst, more contexts of the same tid follow
+            if(new_tid) {
+                Grammar *thread_grammar = &dst->thread_grammars[dst->num_threads];
+                sequitur_init(thread_grammar);
+                if(__logger.parametric_loops)
+                    sequitur_set_parametric(thread_grammar);
+                if(__logger.max_grammar_bytes) {
+                    char spill_path[300];
+                    sprintf(spill_path, "%s.%d.t%d", GRAMMAR_SPILL_PATH, __logger.rank, dst->num_threads);
+                    sequitur_set_limit(thread_grammar, __logger.max_grammar_bytes, spill_path);
+                }
+                dst->num_threads++;
+            }
+            // Only a grammar appended to another one is loaded back as a whole
+            sequitur_load_spill(&ctx->grammar);
+            sequitur_append_grammar(&dst->thread_grammars[dst->num_threads-1], &(ctx->grammar), update_grammar_id);
+            sequitur_cleanup(&(ctx->grammar));
+        }
+        if(__logger.timing->merge)
+            __logger.timing->merge(&dst->timing, &ctx->timing);
+        __logger.timing->finalize(&ctx->timing);
+
+        dst->records_count += ctx->records_count;
+        dst->sig_cache.lookups     += ctx->sig_cache.lookups;
+        dst->sig_cache.hits        += ctx->sig_cache.hits;
+        dst->sig_cache.hit_cycles  += ctx->sig_cache.hit_cycles;
+        dst->sig_cache.hit_samples += ctx->sig_cache.hit_samples;
+        dst->sig_cache.cst_cycles  += ctx->sig_cache.cst_cycles;
+        dst->sig_cache.cst_samples += ctx->sig_cache.cst_samples;
+        if(ctx->overhead) {
+            overhead_merge(dst->overhead, ctx->overhead, PILGRIM_MAX_FUNCS);
+            pilgrim_free(ctx->overhead, sizeof(OverheadStats) * PILGRIM_MAX_FUNCS);
+        }
+        if(ctx->governor) {
+            governor_merge(dst->governor, ctx->governor);
+            governor_cleanup(ctx->governor);
+            pilgrim_free(ctx->governor, sizeof(Governor));
+        }
+
+        if(ctx->sig_buf)
+            pilgrim_free(ctx->sig_buf, ctx->sig_buf_capacity);
+
+        pilgrim_free(update_terminal_id, sizeof(int) * ctx->current_terminal_id);
+        LL_DELETE(__logger.contexts, ctx);
+        pilgrim_free(ctx, sizeof(RecordingContext));
+    }
+
+    __logger.num_contexts = 1;
+    return dst;
 }
 
 void logger_init(int mpi_rank, int mpi_size) {
     __logger.rank = mpi_rank;
     __logger.nprocs = mpi_size;
+    pilgrim_clock_init(mpi_rank);
     __logger.local_metadata.tstart = pilgrim_wtime();
     __logger.local_metadata.records_count = 0;
     __logger.local_metadata.rank = mpi_rank;
-    __logger.hash_head   = NULL;          // Must be NULL initialized
     __logger.offset_list = NULL;
+    __logger.contexts    = NULL;
+    __logger.num_contexts = 0;
+    pthread_mutex_init(&__logger.contexts_mutex, NULL);
     __logger.initialized = false;
     __logger.recording   = false;
 
     // Check if users want to store non-aggregated timings
-    char* timing_mode = NULL;
-    timing_mode = getenv("PILGRIM_TIMING_MODE");
-    if(timing_mode)
-        __logger.timing_mode = strdup(timing_mode);
-    else
-        __logger.timing_mode = strdup(TIMING_MODE_AGGREGATED);
+    // Resolve the timing recorder once, write_record() only calls through it
+    char* timing_mode = getenv("PILGRIM_TIMING_MODE");
+    __logger.timing = timing_recorder_lookup(timing_mode ? timing_mode : TIMING_MODE_AGGREGATED);
+    if(__logger.timing == NULL) {
+        if(__logger.rank == 0)
+            printf("[pilgrim] Unknown or unsupported timing mode %s, use %s instead.\n", timing_mode, TIMING_MODE_AGGREGATED);
+        __logger.timing = timing_recorder_lookup(TIMING_MODE_AGGREGATED);
+    }
 
     // Tracing model
     // 1. default:  tracing all mpi calls between MPI_Init and MPI_Finalize
@@ -591,6 +1081,62 @@ void logger_init(int mpi_rank, int mpi_size) {
     if(getenv("PILGRIM_DEBUG"))
         __logger.debug = true;
 
+    // Build the grammars on a helper thread, see RunRing
+    char* async_grammar = getenv("PILGRIM_ASYNC_GRAMMAR");
+    __logger.async_grammar = async_grammar && atoi(async_grammar) != 0;
+
+    char* profile_overhead = getenv("PILGRIM_PROFILE_OVERHEAD");
+    __logger.profile_overhead = profile_overhead && atoi(profile_overhead) != 0;
+
+    // The governor needs the per-call and per-run timing samples to drop,
+    // and the overhead profile to know what they cost, e.g., "2%"
+    char* overhead_budget = getenv("PILGRIM_OVERHEAD_BUDGET");
+    __logger.overhead_budget = overhead_budget ? atof(overhead_budget) / 100.0 : 0;
+    if(__logger.timing->mode == TIMING_AGGREGATED || __logger.timing->mode == TIMING_CFG ||
+       __logger.timing->mode == TIMING_CFG_JOINT) {
+        if(__logger.overhead_budget > 0 && __logger.rank == 0)
+            printf("[pilgrim] PILGRIM_OVERHEAD_BUDGET is ignored in %s timing mode.\n", __logger.timing->name);
+        __logger.overhead_budget = 0;
+    }
+    if(__logger.overhead_budget > 0)
+        __logger.profile_overhead = true;
+
+    // Local queries: "grammar" (default) appends them to the grammar without
+    // timings, "count" only keeps the call counts of their signatures
+    char* query_calls = getenv("PILGRIM_QUERY_CALLS");
+    __logger.query_counted = query_calls && strcmp(query_calls, "count") == 0;
+    if(query_calls && !__logger.query_counted && strcmp(query_calls, "grammar") != 0 && __logger.rank == 0)
+        printf("[pilgrim] Unknown PILGRIM_QUERY_CALLS %s, use grammar instead.\n", query_calls);
+
+    // Grammar algorithm: "sequitur" (default) grows the grammars online,
+    // "repair" only keeps the calls and builds the grammars at finalize
+    char* grammar_algo = getenv("PILGRIM_GRAMMAR_ALGO");
+    __logger.repair = grammar_algo && strcmp(grammar_algo, "repair") == 0;
+    if(grammar_algo && !__logger.repair && strcmp(grammar_algo, "sequitur") != 0 && __logger.rank == 0)
+        printf("[pilgrim] Unknown PILGRIM_GRAMMAR_ALGO %s, use sequitur instead.\n", grammar_algo);
+
+    // Bound the memory of each grammar, spill the rest to disk, see pilgrim_sequitur_spill.c
+    char* max_grammar = getenv("PILGRIM_MAX_GRAMMAR_MB");
+    __logger.max_grammar_bytes = max_grammar && atol(max_grammar) > 0 ? atol(max_grammar) * 1024 * 1024 : 0;
+    if(__logger.max_grammar_bytes && __logger.repair) {
+        if(__logger.rank == 0)
+            printf("[pilgrim] PILGRIM_MAX_GRAMMAR_MB is ignored with PILGRIM_GRAMMAR_ALGO=repair.\n");
+        __logger.max_grammar_bytes = 0;
+    }
+
+    // Trip counts of loops as rule parameters, see pilgrim_sequitur_loops.c
+    char* parametric_loops = getenv("PILGRIM_PARAMETRIC_LOOPS");
+    __logger.parametric_loops = parametric_loops && atoi(parametric_loops) != 0;
+
+    // Functions to trace, PILGRIM_INCLUDE/PILGRIM_EXCLUDE
+    __logger.func_filtered = func_filter_init(__logger.func_filter, __logger.rank == 0);
+    if(__logger.func_filtered && __logger.rank == 0) {
+        int id, traced = 0;
+        for(id = 0; id <= ID_free; id++)
+            if(FUNC_FILTER_TEST(__logger.func_filter, id)) traced++;
+        printf("[pilgrim] Tracing %d of %d MPI functions.\n", traced, ID_free+1);
+    }
+
 
     // Set the output paths in advance because
     // application may change the cwd duration execution
@@ -598,9 +1144,12 @@ void logger_init(int mpi_rank, int mpi_size) {
     getcwd(cwd, 256);
     sprintf(METADATA_OUTPUT_PATH, "%s/%s/pilgrim.mt", cwd, OUTPUT_DIR);
     sprintf(GRAMMAR_OUTPUT_PATH,  "%s/%s/grammars.dat", cwd, OUTPUT_DIR);
+    sprintf(GRAMMAR_SPILL_PATH,   "%s/%s/grammar.spill", cwd, OUTPUT_DIR);
     sprintf(INTERVALS_OUTPUT_PATH,  "%s/%s/intervals.dat", cwd, OUTPUT_DIR);
     sprintf(DURATIONS_OUTPUT_PATH,  "%s/%s/durations.dat", cwd, OUTPUT_DIR);
     sprintf(FUNCS_OUTPUT_PATH,    "%s/%s/funcs.dat", cwd, OUTPUT_DIR);
+    sprintf(OVERHEAD_OUTPUT_PATH, "%s/%s/overhead.csv", cwd, OUTPUT_DIR);
+    sprintf(SWITCHES_OUTPUT_PATH, "%s/%s/timing_switches.dat", cwd, OUTPUT_DIR);
 
     if(__logger.rank == 0)
         mkdir(OUTPUT_DIR, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
@@ -613,16 +1162,26 @@ void logger_init(int mpi_rank, int mpi_size) {
             .time_resolution = TIME_RESOLUTION,
             .ranks = __logger.nprocs,
         };
-        strcpy(global_metadata.timing_mode, __logger.timing_mode);
+        strcpy(global_metadata.timing_mode, __logger.timing->name);
+        strcpy(global_metadata.clock, pilgrim_clock_name());
+        global_metadata.clock_ticks_per_second = pilgrim_clock_ticks_per_second();
+        global_metadata.func_filtered = __logger.func_filtered;
+        memcpy(global_metadata.func_filter, __logger.func_filter, FUNC_FILTER_BYTES);
+        global_metadata.overhead_budget = __logger.overhead_budget;
+        global_metadata.query_counted = __logger.query_counted;
+        global_metadata.parametric_loops = __logger.parametric_loops;
+        memset(global_metadata.func_queries, 0, FUNC_FILTER_BYTES);
+        for(int i = 0; i < NUM_QUERY_FUNCS; i++)
+            FUNC_FILTER_SET(global_metadata.func_queries, query_func_ids[i]);
         fwrite(&global_metadata, sizeof(GlobalMetadata), 1, global_metafh);
         fclose(global_metafh);
     }
 
-    sequitur_init(&(__logger.grammar));
-    if(strcmp(__logger.timing_mode, TIMING_MODE_CFG) == 0) {
-        sequitur_init(&(__logger.intervals_grammar));
-        sequitur_init(&(__logger.durations_grammar));
-    }
+    // The calling (main) thread owns the first context,
+    // all other contexts will be merged into it
+    tls_context = create_recording_context();
+    if(__logger.async_grammar)
+        start_grammar_worker();
 
     install_mem_hooks();
 
@@ -639,49 +1198,64 @@ void logger_init(int mpi_rank, int mpi_size) {
 }
 
 
+// Debug output, hit rate of the MRU signature cache and
+// the cycles it saved compared to going through the CST
+static void report_sig_cache(SignatureCache *cache) {
+    if(cache->lookups == 0) return;
+    printf("[pilgrim] Signature cache on rank 0: %lu/%lu hits (%.2f%%)", cache->hits, cache->lookups,
+            100.0 * cache->hits / cache->lookups);
+    if(cache->hit_samples > 0 && cache->cst_samples > 0) {
+        double hit_cycles = (double) cache->hit_cycles / cache->hit_samples;
+        double cst_cycles = (double) cache->cst_cycles / cache->cst_samples;
+        printf(", %.0f cycles/hit vs. %.0f cycles/CST lookup, %.2f Mcycles saved",
+                hit_cycles, cst_cycles, (cst_cycles - hit_cycles) * cache->hits / 1e6);
+    }
+    printf("\n");
+}
+
 void logger_exit() {
     uninstall_mem_hooks();
     logger_recording_off();
 
+    int num_contexts = __logger.num_contexts;
+    RecordingContext *ctx = merge_recording_contexts();
+    int num_threads = ctx->num_threads;
+    __logger.local_metadata.records_count = ctx->records_count;
+    SignatureCache sig_cache = ctx->sig_cache;
+
     //printf("[pilgrim] Rank: %d, Hash: %d, Number of records: %d\n", __logger.rank,
-    //        HASH_COUNT(__logger.hash_head), __logger.local_metadata.records_count);
+    //        CST_COUNT(&ctx->cst), __logger.local_metadata.records_count);
     double local_calls = __logger.local_metadata.records_count/1000.0/1000.0;
     double total_calls = 0;
     PMPI_Reduce(&local_calls, &total_calls, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
 
     // 1. Inter-process compression of CSTs
     double cst_compression_time = pilgrim_wtime();
-    int* update_terminal_id = dump_cst();
-    sequitur_update(&(__logger.grammar), update_terminal_id);
-    pilgrim_free(update_terminal_id, sizeof(int)*current_terminal_id);
+    int* update_terminal_id = dump_cst(ctx);
+    int* update_grammar_id = update_terminal_id;
+    if(__logger.timing->dump_terminals)
+        update_grammar_id = __logger.timing->dump_terminals(&ctx->timing, update_terminal_id);
+    for(int t = 0; t < ctx->num_threads; t++)
+        sequitur_update(&ctx->thread_grammars[t], update_grammar_id);
+    pilgrim_free(update_terminal_id, sizeof(int)*ctx->current_terminal_id);
     cst_compression_time = pilgrim_wtime() - cst_compression_time;
 
     // 2. Inter-process copmression of CFGs
     double cfg_compression_time = pilgrim_wtime();
-    __logger.final_grammar_size = sequitur_finalize(GRAMMAR_OUTPUT_PATH, &(__logger.grammar));
+    __logger.final_grammar_size = sequitur_finalize(GRAMMAR_OUTPUT_PATH, ctx->thread_grammars, ctx->num_threads);
+    pilgrim_free(ctx->thread_grammars, sizeof(Grammar) * ctx->num_threads);
     cfg_compression_time = pilgrim_wtime() - cfg_compression_time;
 
     // 3. Write out timing information
-    if(strcmp(__logger.timing_mode, TIMING_MODE_CFG) == 0)
-        write_cfg_timings(&(__logger.durations_grammar), &(__logger.intervals_grammar), __logger.rank, total_calls, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH, cfg_ts);
-    if(strcmp(__logger.timing_mode, TIMING_MODE_TEXT) == 0)
-        write_text_timings(__logger.hash_head, __logger.rank);
-    if(strcmp(__logger.timing_mode, TIMING_MODE_LOSSLESS) == 0)
-        // Again, for lossless mode, we store tstarts in g_intervals
-        // and tends in g_durations
-        write_lossless_timings(g_intervals, g_durations, __logger.rank, __logger.nprocs, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH);
-    #ifdef WITH_ZFP
-    if(strcmp(__logger.timing_mode, TIMING_MODE_ZFP) == 0)
-        write_zfp_timings(__logger.hash_head, __logger.rank, total_calls, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH, g_durations, g_intervals, false);
-    #endif
-    #ifdef WITH_SZ
-    if(strcmp(__logger.timing_mode, TIMING_MODE_SZ) == 0)
-        write_sz_timings(__logger.hash_head, __logger.rank, total_calls, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH, g_durations, g_intervals, false);
-    #endif
-    if(strcmp(__logger.timing_mode, TIMING_MODE_HIST) == 0)
-        write_hist_timings(__logger.hash_head, __logger.rank, __logger.nprocs, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH);
-    if(strcmp(__logger.timing_mode, TIMING_MODE_ZSTD) == 0)
-        write_zstd_timings(__logger.hash_head, __logger.rank, __logger.nprocs, DURATIONS_OUTPUT_PATH, INTERVALS_OUTPUT_PATH, g_durations);
+    TimingOutput timing_output = {
+        .mpi_rank = __logger.rank,
+        .mpi_size = __logger.nprocs,
+        .total_calls = total_calls,
+        .dur_path = DURATIONS_OUTPUT_PATH,
+        .int_path = INTERVALS_OUTPUT_PATH,
+    };
+    if(__logger.timing->write)
+        __logger.timing->write(&ctx->timing, &ctx->cst, &timing_output);
 
     /*
     if(strcmp(__logger.timing_mode, TIMING_MODE_CFG) != 0 &&
@@ -698,8 +1272,27 @@ void logger_exit() {
     }
     */
 
+    // Which timings were dropped by the governor, from which call on
+    if(ctx->governor) {
+        governor_write_switches(ctx->governor, SWITCHES_OUTPUT_PATH, __logger.rank, __logger.nprocs);
+        governor_cleanup(ctx->governor);
+        pilgrim_free(ctx->governor, sizeof(Governor));
+    }
+
+    // Where the tracing time went, per MPI function
+    if(ctx->overhead) {
+        overhead_write_table(ctx->overhead, ID_free+1, OVERHEAD_OUTPUT_PATH, __logger.rank);
+        pilgrim_free(ctx->overhead, sizeof(OverheadStats) * PILGRIM_MAX_FUNCS);
+    }
+
     // 4. Clean up all resources
-    cleanup_cst(__logger.hash_head);
+    __logger.timing->finalize(&ctx->timing);
+    cleanup_cst(&ctx->cst);
+    if(ctx->sig_buf)
+        pilgrim_free(ctx->sig_buf, ctx->sig_buf_capacity);
+    LL_DELETE(__logger.contexts, ctx);
+    pilgrim_free(ctx, sizeof(RecordingContext));
+    tls_context = NULL;
     OffsetNode *elt, *tmp2;
     LL_FOREACH_SAFE(__logger.offset_list, elt, tmp2) {
         LL_DELETE(__logger.offset_list, elt);
@@ -713,14 +1306,14 @@ void logger_exit() {
         pilgrim_report_memory_status();
 
         printf("[pilgrim] Total mpi calls: %f *1e6\n", total_calls);
+        printf("[pilgrim] Recording contexts (threads) on rank 0: %d, thread grammars: %d\n", num_contexts, num_threads);
+        report_sig_cache(&sig_cache);
         printf("[pilgrim] CST inter-process compression time: %.2f\n", cst_compression_time);
         printf("[pilgrim] CFG inter-process compression time: %.2f\n", cfg_compression_time);
         printf("[pilgrim] CST Size: %.2fKB, CFG Size: %.2fKB, Total: %.2fKB\n",
                 __logger.final_cst_size, __logger.final_grammar_size, __logger.final_cst_size + __logger.final_grammar_size);
         fflush(stdout);
     }
-
-    free(__logger.timing_mode);
 }
 
 int logger_get_mpi_rank() {
@@ -732,5 +1325,5 @@ int logger_get_mpi_size() {
 }
 
 double logger_get_program_start_time() {
-    __logger.local_metadata.tstart;
+    return __logger.local_metadata.tstart;
 }
@@ -186,10 +186,9 @@ void safe_delete_addr(AvlTree *addr_tree, void* ptr) {
                 .arg_count = 1,
                 .arg_sizes = arg_sizes,
             };
-            record.args = (void**) dlmalloc(sizeof(void*) * 1);
-            record.args[0] = &attr;
+            void *args[1] = {&attr};
+            record.args = args;
             write_record(record);
-            dlfree(record.args);
         }
         /* ------Experimental code above--------- */
 
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "mpi.h"
+#include "pilgrim_overhead.h"
+#include "pilgrim_func_ids.h"
+#include "pilgrim_utils.h"
+
+static int compare_pilgrim_time(const void *p1, const void *p2) {
+    double t1 = pilgrim_time((OverheadStats*) p1);
+    double t2 = pilgrim_time((OverheadStats*) p2);
+    if(t1 == t2) return 0;
+    return t1 < t2 ? 1 : -1;
+}
+
+static void write_row(FILE *f, const char *name, OverheadStats *s) {
+    double total = pilgrim_time(s);
+    fprintf(f, "%s,%.0f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.1f,%.2f\n", name, s->calls,
+            s->pmpi, s->signature, s->cst, s->grammar, s->timing, total,
+            total / s->calls * 1e9, s->pmpi > 0 ? total / s->pmpi * 100 : 0);
+}
+
+void overhead_merge(OverheadStats *dst, OverheadStats *src, int num_funcs) {
+    double *d = (double*) dst, *s = (double*) src;
+    int i;
+    for(i = 0; i < num_funcs * OVERHEAD_NUM_FIELDS; i++)
+        d[i] += s[i];
+}
+
+void overhead_write_table(OverheadStats *stats, int num_funcs, const char *path, int rank) {
+    OverheadStats *all = NULL;
+    if(rank == 0)
+        all = pilgrim_malloc(sizeof(OverheadStats) * num_funcs);
+    PMPI_Reduce(stats, all, num_funcs * OVERHEAD_NUM_FIELDS, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    if(rank != 0) return;
+
+    // Keep the function name next to its stats before sorting
+    typedef struct { OverheadStats s; int func_id; } Row;
+    Row *rows = pilgrim_malloc(sizeof(Row) * num_funcs);
+    OverheadStats total = {0};
+    int i, num_rows = 0;
+    for(i = 0; i < num_funcs; i++) {
+        if(all[i].calls == 0) continue;
+        rows[num_rows].s = all[i];
+        rows[num_rows].func_id = i;
+        num_rows++;
+        overhead_merge(&total, &all[i], 1);
+    }
+    qsort(rows, num_rows, sizeof(Row), compare_pilgrim_time);
+
+    FILE *f = fopen(path, "w");
+    if(f == NULL) {
+        printf("[pilgrim] Open file: %s failed, errno: %d\n", path, errno);
+    } else {
+        fprintf(f, "function,calls,pmpi_sec,signature_sec,cst_sec,grammar_sec,timing_sec,pilgrim_sec,pilgrim_ns_per_call,overhead_percent\n");
+        for(i = 0; i < num_rows; i++)
+            write_row(f, func_names[rows[i].func_id], &rows[i].s);
+        if(num_rows > 0)
+            write_row(f, "total", &total);
+        fclose(f);
+    }
+
+    pilgrim_free(rows, sizeof(Row) * num_funcs);
+    pilgrim_free(all, sizeof(OverheadStats) * num_funcs);
+}
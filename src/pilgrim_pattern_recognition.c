@@ -5,6 +5,7 @@
 
 #include "uthash.h"
 #include "pilgrim.h"
+#include "pilgrim_pattern_recognition.h"
 
 typedef struct PatternHash_t {
     void *key;              // key is the call signature without the field will be compressed.
@@ -65,11 +66,11 @@ void compress_isend(RecordHash *record) {
 
 }
 
-void linear_regression(RecordHash* merged_cst) {
+void linear_regression(CallSignatureTable* merged_cst) {
     isend_pattern_table = NULL;
 
-    RecordHash *entry, *tmp;
-    HASH_ITER(hh, merged_cst, entry, tmp) {
+    RecordHash *entry;
+    CST_FOREACH(merged_cst, entry) {
         short func_id;
         memcpy(&func_id, entry->key, sizeof(func_id));
         if(func_id == ID_MPI_Isend)
@@ -6,61 +6,82 @@
 #include <stdio.h>
 #include <pthread.h>
 #include <dlfcn.h>
+#include <stdint.h>
+#include <string.h>
 #include "pilgrim_pthread_hooks.h"
 #include "pilgrim_utils.h"
-#include "uthash.h"
 
 
-typedef struct thread_tid_entry {
-    pthread_t thread;   // pthread_t as key
-    int       tid;      // symbolic tid as value
-    UT_hash_handle hh;
-}  thread_tid_entry_t;
+#ifdef ENABLE_THREAD_ID
+/**
+ * Symbolic tids
+ *
+ * Each thread caches its tid in thread-local storage, so only its
+ * first call takes tid_mutex. When a thread exits, the destructor
+ * of tid_key gives its tid back, and the next new thread reuses
+ * the smallest released tid. So thread pools that keep creating
+ * short-lived threads do not keep growing the number of tids.
+ */
+static __thread int cached_tid = -1;    // -1 until the first call of this thread
+
+static pthread_key_t    tid_key;        // value is tid+1, so the destructor also runs for tid 0
+static pthread_once_t   tid_key_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t  tid_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int  current_tid;                // next never used tid
+static int *free_tids;                  // tids released by exited threads
+static int  num_free_tids, free_tids_capacity;
+
+static void release_tid(void *value) {
+    int tid = (int)(intptr_t)value - 1;
+
+    pthread_mutex_lock(&tid_mutex);
+    if(num_free_tids == free_tids_capacity) {
+        int capacity = free_tids_capacity ? free_tids_capacity * 2 : 16;
+        int *tids = pilgrim_malloc(sizeof(int) * capacity);
+        if(free_tids) {
+            memcpy(tids, free_tids, sizeof(int) * num_free_tids);
+            pilgrim_free(free_tids, sizeof(int) * free_tids_capacity);
+        }
+        free_tids = tids;
+        free_tids_capacity = capacity;
+    }
+    free_tids[num_free_tids++] = tid;
+    pthread_mutex_unlock(&tid_mutex);
+}
 
-static int          current_tid;
-thread_tid_entry_t* thread2tid;
-pthread_rwlock_t    uthash_lock = PTHREAD_RWLOCK_INITIALIZER;
+static void create_tid_key() {
+    pthread_key_create(&tid_key, release_tid);
+}
 
-/*
-void thread_tid_entry_destroy(pthread_t thread) {
-    pthread_rwlock_wrlock(&uthash_lock);
-    thread_tid_entry *entrh;
-    HASH_FIND(hh, thread2tid, thread, sizeof(pthread_t), entry);
-    if(entry) {
-        HASH_DELETE(hh, thread2tid, entry);
+// First call of this thread
+static int assign_tid() {
+    pthread_once(&tid_key_once, create_tid_key);
+
+    pthread_mutex_lock(&tid_mutex);
+    int tid;
+    if(num_free_tids > 0) {
+        int i, min = 0;
+        for(i = 1; i < num_free_tids; i++)
+            if(free_tids[i] < free_tids[min]) min = i;
+        tid = free_tids[min];
+        free_tids[min] = free_tids[--num_free_tids];
+    } else {
+        tid = current_tid++;
     }
-    pthread_rwlock_unlock(&uthash_lock);
+    pthread_mutex_unlock(&tid_mutex);
+
+    pthread_setspecific(tid_key, (void*)(intptr_t)(tid+1));
+    cached_tid = tid;
+    return tid;
 }
-*/
+#endif
 
 int pilgrim_pthread_add_get_tid() {
 #ifdef ENABLE_THREAD_ID
-    thread_tid_entry_t *entry = NULL;
-
-    pthread_rwlock_rdlock(&uthash_lock);
-    pthread_t thread = pthread_self();
-    HASH_FIND(hh, thread2tid, &thread, sizeof(pthread_t), entry);
-    pthread_rwlock_unlock(&uthash_lock);
-
-    if(entry)
-        return entry->tid;
-
-    // Reached here, suggesting that this pthread_t is seen the
-    // the first time, assign it a symbolic tid and add the entry
-    // to the hash table
-
-    // pthread_t not seen before, add it to the hash table
-    pthread_rwlock_wrlock(&uthash_lock);
-
-    entry = pilgrim_malloc(sizeof(thread_tid_entry_t));
-    memcpy(&entry->thread, &thread, sizeof(pthread_t));
-    entry->tid = current_tid++;
-
-    HASH_ADD(hh, thread2tid, thread, sizeof(pthread_t), entry);
-
-    pthread_rwlock_unlock(&uthash_lock);
-
-    return entry->tid;
+    if(cached_tid >= 0)
+        return cached_tid;
+    return assign_tid();
 #else
     return 0;
 #endif
@@ -72,7 +93,7 @@ int pilgrim_pthread_add_get_tid() {
 // ---------------------------
 //
 /* pthread hooks are not used for now.
- * Currently, we simply map pthread_self() to a local symbolic
+ * Tids are cached in TLS and given back by the destructor of tid_key
  */
 /*
 int pthread_create(pthread_t *thread, const pthread_attr_t *attr, void *(*start_routine)(void*), void *arg) {
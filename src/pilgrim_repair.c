@@ -0,0 +1,447 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Re-Pair (Larsson and Moffat) over a terminal stream, see pilgrim_repair.h
+ *
+ * The stream is a doubly linked list over positions (prev/next), deleted
+ * positions have seq = -1. Symbol ids: terminals are 0..num_terminals-1,
+ * the rule r is num_terminals+r.
+ *
+ * Every recorded pair occurrence (the position of its first symbol) is in
+ * the occurrence list of its pair (occ_prev/occ_next), occ_pair is -1 for
+ * positions not recorded. New occurrences go to the tail of the list, so
+ * the lists stay in position order without sorting: the initial count
+ * walks the stream left to right, and a replacement creates occurrences
+ * of new pairs only (they contain the new rule), also left to right. Pairs of the same symbol are not recorded,
+ * like the twins-removal rule of Sequitur, a a a becomes a^3 instead.
+ *
+ * Pairs with freq >= 2 are in bucket[freq]. A replacement can only create
+ * pairs less frequent than the pair replaced, so max_freq only goes down.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pilgrim_repair.h"
+#include "pilgrim_utils.h"
+
+typedef struct Pair_t {
+    int a, b;
+    int freq;
+    int head, tail;                 // recorded occurrences, in position order
+    int bprev, bnext;               // bucket list
+} Pair;
+
+typedef struct KeySlot_t {
+    uint64_t key;
+    int idx;                        // -1 if empty
+} KeySlot;
+
+// Open addressing map from a 64-bit key to an index
+typedef struct KeyMap_t {
+    KeySlot *slots;
+    unsigned capacity;
+    unsigned count;
+} KeyMap;
+
+typedef struct RePair_t {
+    int n;
+    int *seq, *prev, *next;
+    int *occ_pair, *occ_prev, *occ_next;
+
+    Pair *pairs;
+    int num_pairs, pairs_capacity;
+    KeyMap pair_map;
+
+    int *bucket;                    // n+1 heads
+    int max_freq;
+
+    int num_terminals;
+    int *rule_left, *rule_right;
+    int num_rules;
+} RePair;
+
+
+static inline uint64_t pack_key(int a, int b) {
+    return ((uint64_t)(uint32_t)a << 32) | (uint32_t)b;
+}
+
+static inline unsigned key_slot(KeyMap *map, uint64_t key) {
+    uint64_t h = key * 0x9e3779b97f4a7c15ULL;
+    return (h ^ (h >> 29)) & (map->capacity - 1);
+}
+
+static void keymap_init(KeyMap *map, unsigned capacity) {
+    map->capacity = 16;
+    while(map->capacity < capacity * 2)
+        map->capacity *= 2;
+    map->count = 0;
+    map->slots = pilgrim_malloc(sizeof(KeySlot) * map->capacity);
+    for(unsigned i = 0; i < map->capacity; i++)
+        map->slots[i].idx = -1;
+}
+
+static void keymap_free(KeyMap *map) {
+    pilgrim_free(map->slots, sizeof(KeySlot) * map->capacity);
+}
+
+static void keymap_grow(KeyMap *map) {
+    KeySlot *old_slots = map->slots;
+    unsigned old_capacity = map->capacity;
+    keymap_init(map, old_capacity);
+    for(unsigned i = 0; i < old_capacity; i++) {
+        if(old_slots[i].idx < 0) continue;
+        unsigned s = key_slot(map, old_slots[i].key);
+        while(map->slots[s].idx >= 0)
+            s = (s + 1) & (map->capacity - 1);
+        map->slots[s] = old_slots[i];
+        map->count++;
+    }
+    pilgrim_free(old_slots, sizeof(KeySlot) * old_capacity);
+}
+
+// Return the slot of the key, or the empty slot to insert it
+static KeySlot* keymap_find(KeyMap *map, uint64_t key) {
+    if((map->count + 1) * 2 > map->capacity)
+        keymap_grow(map);
+    unsigned s = key_slot(map, key);
+    while(map->slots[s].idx >= 0 && map->slots[s].key != key)
+        s = (s + 1) & (map->capacity - 1);
+    return &map->slots[s];
+}
+
+
+static int pair_get(RePair *rp, int a, int b) {
+    KeySlot *slot = keymap_find(&rp->pair_map, pack_key(a, b));
+    if(slot->idx >= 0)
+        return slot->idx;
+
+    if(rp->num_pairs == rp->pairs_capacity) {
+        Pair *pairs = pilgrim_malloc(sizeof(Pair) * rp->pairs_capacity * 2);
+        memcpy(pairs, rp->pairs, sizeof(Pair) * rp->num_pairs);
+        pilgrim_free(rp->pairs, sizeof(Pair) * rp->pairs_capacity);
+        rp->pairs = pairs;
+        rp->pairs_capacity *= 2;
+    }
+    int p = rp->num_pairs++;
+    rp->pairs[p] = (Pair){.a = a, .b = b, .freq = 0, .head = -1, .tail = -1, .bprev = -1, .bnext = -1};
+    slot->key = pack_key(a, b);
+    slot->idx = p;
+    rp->pair_map.count++;
+    return p;
+}
+
+static void set_freq(RePair *rp, int p, int freq) {
+    Pair *pair = &rp->pairs[p];
+    if(pair->freq >= 2) {
+        if(pair->bprev >= 0)
+            rp->pairs[pair->bprev].bnext = pair->bnext;
+        else
+            rp->bucket[pair->freq] = pair->bnext;
+        if(pair->bnext >= 0)
+            rp->pairs[pair->bnext].bprev = pair->bprev;
+    }
+    pair->freq = freq;
+    if(freq >= 2) {
+        pair->bprev = -1;
+        pair->bnext = rp->bucket[freq];
+        if(pair->bnext >= 0)
+            rp->pairs[pair->bnext].bprev = p;
+        rp->bucket[freq] = p;
+        if(freq > rp->max_freq)
+            rp->max_freq = freq;
+    }
+}
+
+// Record the pair starting at pos, after all its recorded occurrences
+static void add_occurrence(RePair *rp, int pos) {
+    int a = rp->seq[pos], b = rp->seq[rp->next[pos]];
+
+    // a a is never replaced, runs become a^i when the grammar is written
+    if(a == b) return;
+
+    int p = pair_get(rp, a, b);
+    Pair *pair = &rp->pairs[p];
+    rp->occ_pair[pos] = p;
+    rp->occ_prev[pos] = pair->tail;
+    rp->occ_next[pos] = -1;
+    if(pair->tail >= 0)
+        rp->occ_next[pair->tail] = pos;
+    else
+        pair->head = pos;
+    pair->tail = pos;
+    set_freq(rp, p, pair->freq + 1);
+}
+
+static void remove_occurrence(RePair *rp, int pos) {
+    int p = rp->occ_pair[pos];
+    if(p < 0) return;
+
+    Pair *pair = &rp->pairs[p];
+    if(rp->occ_prev[pos] >= 0)
+        rp->occ_next[rp->occ_prev[pos]] = rp->occ_next[pos];
+    else
+        pair->head = rp->occ_next[pos];
+    if(rp->occ_next[pos] >= 0)
+        rp->occ_prev[rp->occ_next[pos]] = rp->occ_prev[pos];
+    else
+        pair->tail = rp->occ_prev[pos];
+    rp->occ_pair[pos] = -1;
+    set_freq(rp, p, pair->freq - 1);
+}
+
+// Replace every occurrence of the pair p by a new rule
+static void replace_pair(RePair *rp, int p, int *positions) {
+    int a = rp->pairs[p].a, b = rp->pairs[p].b;
+    int count = 0;
+
+    // Take the occurrences off the list first (they are already in
+    // position order), so removing the neighbor pairs below never
+    // touches the list we walk
+    for(int pos = rp->pairs[p].head; pos >= 0; pos = rp->occ_next[pos]) {
+        positions[count++] = pos;
+        rp->occ_pair[pos] = -1;
+    }
+    rp->pairs[p].head = -1;
+    rp->pairs[p].tail = -1;
+    set_freq(rp, p, 0);
+
+    int r = rp->num_rules++;
+    rp->rule_left[r] = a;
+    rp->rule_right[r] = b;
+    int sym = rp->num_terminals + r;
+
+    for(int i = 0; i < count; i++) {
+        int pos = positions[i];
+        int j = rp->next[pos];
+        // Earlier replacements may have consumed this one
+        if(rp->seq[pos] != a || j < 0 || rp->seq[j] != b)
+            continue;
+
+        int h = rp->prev[pos], k = rp->next[j];
+        if(h >= 0)
+            remove_occurrence(rp, h);
+        remove_occurrence(rp, j);
+
+        rp->seq[pos] = sym;
+        rp->seq[j] = -1;
+        rp->next[pos] = k;
+        if(k >= 0)
+            rp->prev[k] = pos;
+
+        if(h >= 0)
+            add_occurrence(rp, h);
+        if(k >= 0)
+            add_occurrence(rp, pos);
+    }
+}
+
+
+/*
+ * Write the Re-Pair result into the grammar
+ *
+ * rule_map[r] is the grammar rule of the Re-Pair rule r, rules used
+ * once are not in the grammar but expanded where they are used.
+ */
+typedef struct Emitter_t {
+    RePair *rp;
+    Grammar *grammar;
+    int *term_val, *term_exp;
+    int *uses;
+    uint32_t *rule_map;
+    int *stack;
+} Emitter;
+
+static uint32_t grammar_rule(Emitter *em, int r) {
+    if(em->rule_map[r] == 0) {
+        em->rule_map[r] = new_rule(em->grammar);
+        rule_put(em->grammar, em->rule_map[r]);
+    }
+    return em->rule_map[r];
+}
+
+// Append a symbol to the rule, a^i a^j becomes a^(i+j) unless one is a loop parameter
+static void emit_symbol(Emitter *em, uint32_t rule, int sym) {
+    Grammar *grammar = em->grammar;
+    int num_terminals = em->rp->num_terminals;
+    bool terminal = sym < num_terminals;
+    uint32_t head = terminal ? 0 : grammar_rule(em, sym - num_terminals);
+    int val = terminal ? em->term_val[sym] : RULE(grammar, head)->val;
+    int exp = terminal ? em->term_exp[sym] : 1;
+
+    SymbolId body = RULE(grammar, rule)->body;
+    SymbolId tail = body ? SYMBOL(grammar, body)->prev : 0;
+    if(tail && SYMBOL(grammar, tail)->val == val && SYMBOL(grammar, tail)->exp != LOOP_PARAM && exp != LOOP_PARAM) {
+        SYMBOL(grammar, tail)->exp += exp;
+        return;
+    }
+    symbol_put(grammar, rule, tail, new_symbol(grammar, val, exp, terminal, head));
+}
+
+// Append sym, or its expansion if it is a rule used once
+static void emit(Emitter *em, uint32_t rule, int sym) {
+    RePair *rp = em->rp;
+    int top = 0;
+    em->stack[top++] = sym;
+    while(top > 0) {
+        int s = em->stack[--top];
+        int r = s - rp->num_terminals;
+        if(r >= 0 && em->uses[r] == 1) {
+            em->stack[top++] = rp->rule_right[r];
+            em->stack[top++] = rp->rule_left[r];
+        } else {
+            emit_symbol(em, rule, s);
+        }
+    }
+}
+
+
+void terminal_buffer_grow(TerminalBuffer *buf) {
+    size_t capacity = buf->capacity ? buf->capacity * 2 : 4096;
+    int *data = pilgrim_malloc(sizeof(int) * capacity);
+    if(buf->data) {
+        memcpy(data, buf->data, sizeof(int) * buf->len);
+        pilgrim_free(buf->data, sizeof(int) * buf->capacity);
+    }
+    buf->data = data;
+    buf->capacity = capacity;
+}
+
+void terminal_buffer_free(TerminalBuffer *buf) {
+    if(buf->data)
+        pilgrim_free(buf->data, sizeof(int) * buf->capacity);
+    buf->data = NULL;
+    buf->len = 0;
+    buf->capacity = 0;
+}
+
+void repair_build(Grammar *grammar, const int *terminals, size_t len) {
+    int n = len / 2;
+    if(n == 0) return;
+
+    RePair rp;
+    rp.n = n;
+    rp.seq      = pilgrim_malloc(sizeof(int) * n);
+    rp.prev     = pilgrim_malloc(sizeof(int) * n);
+    rp.next     = pilgrim_malloc(sizeof(int) * n);
+    rp.occ_pair = pilgrim_malloc(sizeof(int) * n);
+    rp.occ_prev = pilgrim_malloc(sizeof(int) * n);
+    rp.occ_next = pilgrim_malloc(sizeof(int) * n);
+    rp.bucket   = pilgrim_malloc(sizeof(int) * (n+1));
+    rp.max_freq = 0;
+    for(int f = 0; f <= n; f++)
+        rp.bucket[f] = -1;
+
+    // 1. Terminal (val, exp) -> symbol id
+    KeyMap term_map;
+    keymap_init(&term_map, 1024);
+    int terms_capacity = 1024;
+    int *term_val = pilgrim_malloc(sizeof(int) * terms_capacity);
+    int *term_exp = pilgrim_malloc(sizeof(int) * terms_capacity);
+    rp.num_terminals = 0;
+    for(int i = 0; i < n; i++) {
+        int val = terminals[2*i], exp = terminals[2*i+1];
+        if(grammar->parametric && exp > 1) {
+            loop_counts_push(&grammar->loop_counts, exp);
+            exp = LOOP_PARAM;
+        }
+        uint64_t key = pack_key(val, exp);
+        KeySlot *slot = keymap_find(&term_map, key);
+        if(slot->idx < 0) {
+            if(rp.num_terminals == terms_capacity) {
+                int *v = pilgrim_malloc(sizeof(int) * terms_capacity * 2);
+                int *e = pilgrim_malloc(sizeof(int) * terms_capacity * 2);
+                memcpy(v, term_val, sizeof(int) * terms_capacity);
+                memcpy(e, term_exp, sizeof(int) * terms_capacity);
+                pilgrim_free(term_val, sizeof(int) * terms_capacity);
+                pilgrim_free(term_exp, sizeof(int) * terms_capacity);
+                term_val = v;
+                term_exp = e;
+                terms_capacity *= 2;
+            }
+            slot->key = key;
+            slot->idx = rp.num_terminals++;
+            term_map.count++;
+            term_val[slot->idx] = val;
+            term_exp[slot->idx] = exp;
+        }
+        rp.seq[i] = slot->idx;
+        rp.prev[i] = i - 1;
+        rp.next[i] = i + 1 < n ? i + 1 : -1;
+        rp.occ_pair[i] = -1;
+    }
+    keymap_free(&term_map);
+
+    // 2. Count all pairs, then replace the most frequent one until none repeats
+    rp.pairs_capacity = 1024;
+    rp.num_pairs = 0;
+    rp.pairs = pilgrim_malloc(sizeof(Pair) * rp.pairs_capacity);
+    keymap_init(&rp.pair_map, 1024);
+    for(int i = 0; i + 1 < n; i++)
+        add_occurrence(&rp, i);
+
+    // Every rule removes at least one position
+    rp.num_rules = 0;
+    rp.rule_left  = pilgrim_malloc(sizeof(int) * n);
+    rp.rule_right = pilgrim_malloc(sizeof(int) * n);
+    int *positions = pilgrim_malloc(sizeof(int) * n);
+
+    while(1) {
+        while(rp.max_freq >= 2 && rp.bucket[rp.max_freq] < 0)
+            rp.max_freq--;
+        if(rp.max_freq < 2) break;
+        replace_pair(&rp, rp.bucket[rp.max_freq], positions);
+    }
+
+    pilgrim_free(positions, sizeof(int) * n);
+    pilgrim_free(rp.pairs, sizeof(Pair) * rp.pairs_capacity);
+    keymap_free(&rp.pair_map);
+    pilgrim_free(rp.bucket, sizeof(int) * (n+1));
+    pilgrim_free(rp.occ_pair, sizeof(int) * n);
+    pilgrim_free(rp.occ_prev, sizeof(int) * n);
+    pilgrim_free(rp.occ_next, sizeof(int) * n);
+
+    // 3. Count the uses of every rule, then write the grammar
+    int num_rules = rp.num_rules;
+    Emitter em = {.rp = &rp, .grammar = grammar, .term_val = term_val, .term_exp = term_exp};
+    em.uses = pilgrim_malloc(sizeof(int) * (num_rules+1));
+    em.rule_map = pilgrim_malloc(sizeof(uint32_t) * (num_rules+1));
+    em.stack = pilgrim_malloc(sizeof(int) * (num_rules+1) * 2);
+    memset(em.uses, 0, sizeof(int) * (num_rules+1));
+    memset(em.rule_map, 0, sizeof(uint32_t) * (num_rules+1));
+
+    for(int pos = 0; pos >= 0; pos = rp.next[pos])
+        if(rp.seq[pos] >= rp.num_terminals)
+            em.uses[rp.seq[pos] - rp.num_terminals]++;
+    for(int r = 0; r < num_rules; r++) {
+        if(rp.rule_left[r] >= rp.num_terminals)
+            em.uses[rp.rule_left[r] - rp.num_terminals]++;
+        if(rp.rule_right[r] >= rp.num_terminals)
+            em.uses[rp.rule_right[r] - rp.num_terminals]++;
+    }
+
+    for(int pos = 0; pos >= 0; pos = rp.next[pos])
+        emit(&em, grammar->rules_head, rp.seq[pos]);
+    for(int r = 0; r < num_rules; r++) {
+        if(em.uses[r] < 2) continue;
+        uint32_t rule = grammar_rule(&em, r);
+        emit(&em, rule, rp.rule_left[r]);
+        emit(&em, rule, rp.rule_right[r]);
+    }
+
+    if(grammar->parametric)
+        loop_params_update(grammar);
+
+    pilgrim_free(em.uses, sizeof(int) * (num_rules+1));
+    pilgrim_free(em.rule_map, sizeof(uint32_t) * (num_rules+1));
+    pilgrim_free(em.stack, sizeof(int) * (num_rules+1) * 2);
+    pilgrim_free(rp.rule_left, sizeof(int) * n);
+    pilgrim_free(rp.rule_right, sizeof(int) * n);
+    pilgrim_free(rp.seq, sizeof(int) * n);
+    pilgrim_free(rp.prev, sizeof(int) * n);
+    pilgrim_free(rp.next, sizeof(int) * n);
+    pilgrim_free(term_val, sizeof(int) * terms_capacity);
+    pilgrim_free(term_exp, sizeof(int) * terms_capacity);
+}
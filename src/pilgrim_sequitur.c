@@ -5,18 +5,22 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #include "mpi.h"
 #include "pilgrim_sequitur.h"
 #include "pilgrim_utils.h"
 
+#define INITIAL_SYMBOLS     256
+#define INITIAL_RULES       32
 
-void delete_symbol(Symbol *sym) {
-    symbol_delete(sym->rule, sym, true);
+
+void delete_symbol(Grammar *grammar, SymbolId sym) {
+    symbol_delete(grammar, sym, true);
 }
 
 
-int check_digram(Grammar *grammar, Symbol *sym);
+int check_digram(Grammar *grammar, SymbolId sym);
 
 /**
  * Replace a digram by a rule (non-terminal)
@@ -28,46 +32,43 @@ int check_digram(Grammar *grammar, Symbol *sym);
  * other rules body may have the same key.
  *
  */
-void replace_digram(Grammar *grammar, Symbol *origin, Symbol *rule, bool delete_digram) {
-    if(!IS_RULE_HEAD(rule))
-        ERROR_ABORT("replace_digram: not a rule head?\n");
-
+void replace_digram(Grammar *grammar, SymbolId origin, uint32_t rule, bool delete_digram) {
     // Create an non-terminal
-    Symbol *replaced = new_symbol(rule->val, 1, false, rule);
+    SymbolId replaced = new_symbol(grammar, RULE(grammar, rule)->val, 1, false, rule);
 
     // carefule here, if orgin is the first symbol, then
-    // NULL will be used as the tail node.
-    Symbol *prev = NULL;
-    if(origin->rule->rule_body != origin)
-        prev = origin->prev;
-    if(prev != NULL)
-        digram_delete(&(grammar->digram_table), prev);
+    // 0 will be used as the tail node.
+    SymbolId prev = 0;
+    if(RULE(grammar, SYMBOL(grammar, origin)->rule)->body != origin)
+        prev = SYMBOL(grammar, origin)->prev;
+    if(prev != 0)
+        digram_delete(grammar, prev);
 
     // delete digram before deleting symbols, otherwise we won't have correct digrams
     if(delete_digram) {
-        digram_delete(&(grammar->digram_table), origin);
-        digram_delete(&(grammar->digram_table), origin->next);
+        digram_delete(grammar, origin);
+        digram_delete(grammar, SYMBOL(grammar, origin)->next);
     }
 
-    // delete symbol will set origin to NULL
+    // delete symbol will reset origin
     // so we need to store its rule and also delete origin->next first.
-    Symbol *origin_rule = origin->rule;
-    delete_symbol(origin->next);
-    delete_symbol(origin);
+    uint32_t origin_rule = SYMBOL(grammar, origin)->rule;
+    delete_symbol(grammar, SYMBOL(grammar, origin)->next);
+    delete_symbol(grammar, origin);
 
-    symbol_put(origin_rule, prev, replaced);
+    symbol_put(grammar, origin_rule, prev, replaced);
 
 
     // Add a new symbol (replaced) after prev
     // may introduce another repeated digram that we need to check
     if( check_digram(grammar, prev) == 0) {
-        if(prev == NULL) {
+        if(prev == 0) {
             check_digram(grammar, replaced);
         } else {
             // it is possible that the 'replaced' symbol was deleted
             // by the check digram function due to twins-removal rule
             // if that's the case, we can not check the 'replaced'.
-            if(prev->next==replaced)
+            if(SYMBOL(grammar, prev)->next == replaced)
                 check_digram(grammar, replaced);
         }
     }
@@ -77,40 +78,44 @@ void replace_digram(Grammar *grammar, Symbol *origin, Symbol *rule, bool delete_
  * Rule Utility
  * Replace a rule with its body if the rule is used only once
  *
- * @sym: is an non-terminal which should be replaced by sym->rule_head->rule_body
+ * @sym: is an non-terminal which should be replaced by the body of the rule it represents
  */
-void expand_instance(Grammar *grammar, Symbol *sym) {
-    Symbol *rule = sym->rule_head;
+void expand_instance(Grammar *grammar, SymbolId sym) {
+    uint32_t rule = SYMBOL(grammar, sym)->rule_head;
     // just double check to make sure
-    if(rule->ref != 1)
+    if(RULE(grammar, rule)->ref != 1)
         ERROR_ABORT("Attempt to delete a rule that has multiple references!\n");
 
-    digram_delete(&(grammar->digram_table), sym);
+    digram_delete(grammar, sym);
 
     int n = 0;
-    Symbol *this, *tmp;
-    Symbol *tail = sym;
-    DL_FOREACH_SAFE(rule->rule_body, this,  tmp) {
+    SymbolId this = RULE(grammar, rule)->body, tmp;
+    SymbolId tail = sym;
+    while(this) {
+        tmp = SYMBOL(grammar, this)->next;
+
         // delete the digram of the old rule (rule body)
-        digram_delete(&(grammar->digram_table), this);
+        digram_delete(grammar, this);
 
-        Symbol *s = new_symbol(this->val, this->exp, this->terminal, this->rule_head);
-        symbol_put(sym->rule, tail, s);
+        Symbol *old = SYMBOL(grammar, this);
+        SymbolId s = new_symbol(grammar, old->val, old->exp, old->terminal, old->rule_head);
+        symbol_put(grammar, SYMBOL(grammar, sym)->rule, tail, s);
         tail = s;
         n++;
 
         // delete the symbol of the old rule (rule body)
-        delete_symbol(this);
+        delete_symbol(grammar, this);
+        this = tmp;
     }
 
-    this = sym->next;
+    this = SYMBOL(grammar, sym)->next;
     for(int i = 0; i < n; i++) {
-        digram_put(&(grammar->digram_table), this);
-        this = this->next;
+        digram_put(grammar, this);
+        this = SYMBOL(grammar, this)->next;
     }
 
-    delete_symbol(sym);
-    rule_delete(&(grammar->rules), rule);
+    delete_symbol(grammar, sym);
+    rule_delete(grammar, rule);
 }
 
 /**
@@ -118,39 +123,48 @@ void expand_instance(Grammar *grammar, Symbol *sym) {
  * a previously existing one.
  *
  */
-void process_match(Grammar *grammar, Symbol *this, Symbol *match) {
-    Symbol *rule = NULL;
+void process_match(Grammar *grammar, SymbolId this, SymbolId match) {
+    uint32_t rule = 0;
 
     // 1. The match consists of entire body of a rule
     // Then we replace the new digram with this rule
-    if(match->prev == match->next) {
-        rule = match->rule;
-        replace_digram(grammar, this, match->rule, false);
+    if(SYMBOL(grammar, match)->prev == SYMBOL(grammar, match)->next) {
+        rule = SYMBOL(grammar, match)->rule;
+        replace_digram(grammar, this, rule, false);
     } else {
         // 2. Otherwise, we create a new rule and replace the repeated digrams with this rule
         rule = new_rule(grammar);
-        symbol_put(rule, rule->rule_body, new_symbol(this->val, this->exp, this->terminal, this->rule_head));
-        symbol_put(rule, rule->rule_body->prev, new_symbol(this->next->val, this->next->exp, this->next->terminal, this->next->rule_head));
-        rule_put(&(grammar->rules), rule);
+
+        Symbol first = *SYMBOL(grammar, this);
+        Symbol second = *SYMBOL(grammar, first.next);
+        SymbolId s = new_symbol(grammar, first.val, first.exp, first.terminal, first.rule_head);
+        symbol_put(grammar, rule, 0, s);
+        s = new_symbol(grammar, second.val, second.exp, second.terminal, second.rule_head);
+        symbol_put(grammar, rule, SYMBOL(grammar, RULE(grammar, rule)->body)->prev, s);
+        rule_put(grammar, rule);
+        RULE(grammar, rule)->params = symbol_has_params(grammar, &first) || symbol_has_params(grammar, &second);
 
         replace_digram(grammar, match, rule, true);
         replace_digram(grammar, this, rule, false);
 
         // Insert the rule body into the digram table
-        digram_put(&(grammar->digram_table), rule->rule_body);
+        digram_put(grammar, RULE(grammar, rule)->body);
     }
 
 
     // Check for "Rule Utility"
     // The first symbol of the just-created rule,
     // if is an non-terminal could be underutilized
-    if(rule && rule->rule_body) {
-        Symbol* tocheck = rule->rule_body->rule_head;
-        if(tocheck && tocheck->ref < 2 && tocheck->exp < 2) {
-            #ifdef DEBUG
-                printf("rule utility:%d %d\n", tocheck->val, tocheck->ref);
-            #endif
-            expand_instance(grammar, rule->rule_body);
+    if(rule && RULE(grammar, rule)->body) {
+        SymbolId first = RULE(grammar, rule)->body;
+        if(!IS_TERMINAL(SYMBOL(grammar, first))) {
+            Rule *tocheck = RULE(grammar, SYMBOL(grammar, first)->rule_head);
+            if(tocheck->ref < 2) {
+                #ifdef DEBUG
+                    printf("rule utility:%d %d\n", tocheck->val, tocheck->ref);
+                #endif
+                expand_instance(grammar, first);
+            }
         }
     }
 
@@ -160,35 +174,42 @@ void process_match(Grammar *grammar, Symbol *this, Symbol *match) {
  * Return 1 means the digram is replaced by a rule
  * (Either a new rule or an exisiting rule)
  */
-int check_digram(Grammar *grammar, Symbol *sym) {
+int check_digram(Grammar *grammar, SymbolId sym) {
+
+    if(sym == 0)
+        return 0;
 
-    if(sym == NULL || sym->next == NULL || sym->next == sym)
+    Symbol *s = SYMBOL(grammar, sym);
+    if(s->next == 0 || s->next == sym)
         return 0;
 
     // First of all, twins-removal rule.
     // Check if digram is of form a^i a^j
     // If so, represent it using a^(i+j)
-    if(grammar->twins_removal && sym->val == sym->next->val) {
-        digram_delete(&(grammar->digram_table), sym->prev);
-        sym->exp = sym->exp + sym->next->exp;
-        //delete_symbol(sym->next);
-        symbol_delete(sym->next->rule, sym->next, false);
-        return check_digram(grammar, sym->prev);
+    // Loop parameters have their own rules, see pilgrim_sequitur_loops.c
+    if(grammar->twins_removal && s->val == SYMBOL(grammar, s->next)->val) {
+        int exp = loop_twins_exp(grammar, sym);
+        if(exp >= 0) {
+            digram_delete(grammar, s->prev);
+            s->exp = exp;
+            symbol_delete(grammar, s->next, false);
+            return check_digram(grammar, s->prev);
+        }
     }
 
 
-    Symbol *match = digram_get(grammar->digram_table, sym, sym->next);
+    SymbolId match = digram_get(grammar, sym, s->next);
 
-    if(match == NULL) {
+    if(match == 0) {
         // Case 1. new digram, put it in the table
         #ifdef DEBUG
-            printf("new digram %d %d\n", sym->val, sym->next->val);
+            printf("new digram %d %d\n", s->val, SYMBOL(grammar, s->next)->val);
         #endif
-        digram_put(&(grammar->digram_table), sym);
+        digram_put(grammar, sym);
         return 0;
     }
 
-    if(match->next == sym) {
+    if(SYMBOL(grammar, match)->next == sym) {
         // Case 2. match found but overlap: do nothing
         #ifdef DEBUG
             printf("found digram but overlap\n");
@@ -197,7 +218,7 @@ int check_digram(Grammar *grammar, Symbol *sym) {
     } else {
         // Case 3. non-overlapping match found
         #ifdef DEBUG
-            printf("found non-overlapping digram %d %d\n", sym->val, sym->next->val);
+            printf("found non-overlapping digram %d %d\n", s->val, SYMBOL(grammar, s->next)->val);
         #endif
         process_match(grammar, sym, match);
         return 1;
@@ -205,81 +226,133 @@ int check_digram(Grammar *grammar, Symbol *sym) {
 
 }
 
-Symbol* append_terminal(Grammar* grammar, int val, int exp) {
+SymbolId append_terminal(Grammar* grammar, int val, int exp) {
 
-    Symbol *sym = new_symbol(val, exp, true, NULL);
+    if(grammar->parametric && exp > 1) {
+        loop_counts_push(&grammar->loop_counts, exp);
+        exp = LOOP_PARAM;
+    }
 
-    Symbol *main_rule = grammar->rules;
-    Symbol *tail;
+    SymbolId sym = new_symbol(grammar, val, exp, true, 0);
 
-    if(main_rule->rule_body)
-        tail = main_rule->rule_body->prev;  // Get the last symbol
-    else
-        tail = main_rule->rule_body;        // NULL, no symbol yet
+    uint32_t main_rule = grammar->rules_head;
+    SymbolId body = RULE(grammar, main_rule)->body;
+    SymbolId tail = body ? SYMBOL(grammar, body)->prev : 0;    // the last symbol, or 0 if no symbol yet
 
-    symbol_put(main_rule, tail, sym);
-    check_digram(grammar, sym->prev);
+    symbol_put(grammar, main_rule, tail, sym);
+    check_digram(grammar, SYMBOL(grammar, sym)->prev);
 
     return sym;
 }
 
 void sequitur_cleanup(Grammar *grammar) {
-    Digram *digram, *tmp;
-    HASH_ITER(hh, grammar->digram_table, digram, tmp) {
-        HASH_DEL(grammar->digram_table, digram);
-        pilgrim_free(digram->key, DIGRAM_KEY_LEN);
-        pilgrim_free(digram, sizeof(Digram));
-    }
+    sequitur_close_spill(grammar);
+    digram_table_cleanup(&grammar->digram_table);
+    loop_counts_free(&grammar->loop_counts);
+    pilgrim_free(grammar->symbols, sizeof(Symbol) * grammar->symbols_capacity);
+    pilgrim_free(grammar->rules, sizeof(Rule) * grammar->rules_capacity);
 
-    Symbol *rule, *sym, *tmp2, *tmp3;
-    DL_FOREACH_SAFE(grammar->rules, rule, tmp2) {
-        DL_FOREACH_SAFE(rule->rule_body, sym, tmp3) {
-            DL_DELETE(rule->rule_body, sym);
-            pilgrim_free(sym, sizeof(Symbol));
-        }
-        DL_DELETE(grammar->rules, rule);
-        pilgrim_free(rule, sizeof(Symbol));
-    }
-
-    grammar->digram_table = NULL;
+    grammar->symbols = NULL;
     grammar->rules = NULL;
+    grammar->symbols_capacity = grammar->symbols_used = 0;
+    grammar->rules_capacity = grammar->rules_used = 0;
+    grammar->free_symbols = 0;
+    grammar->rules_head = 0;
+    grammar->free_rules = 0;
     grammar->rule_id = -1;
 }
 
 void sequitur_init_rule_id(Grammar *grammar, int start_rule_id, bool twins_removal) {
-    grammar->digram_table = NULL;
-    grammar->rules = NULL;
+    grammar->start_rule_id = start_rule_id;
     grammar->rule_id = start_rule_id;
     grammar->twins_removal = twins_removal;
+    grammar->spill = NULL;
+    grammar->parametric = false;
+    memset(&grammar->loop_counts, 0, sizeof(LoopCounts));
+
+    // symbols[0] and rules[0] are never used
+    grammar->symbols_capacity = INITIAL_SYMBOLS;
+    grammar->symbols_used = 1;
+    grammar->symbols = pilgrim_malloc(sizeof(Symbol) * grammar->symbols_capacity);
+    grammar->free_symbols = 0;
 
+    grammar->rules_capacity = INITIAL_RULES;
+    grammar->rules_used = 1;
+    grammar->rules = pilgrim_malloc(sizeof(Rule) * grammar->rules_capacity);
+    grammar->rules_head = 0;
+    grammar->free_rules = 0;
+
+    digram_table_init(&grammar->digram_table);
 
     // Add the main rule: S, which will be the head of the rule list
-    rule_put(&(grammar->rules), new_rule(grammar));
+    rule_put(grammar, new_rule(grammar));
 }
 
 void sequitur_init(Grammar *grammar) {
     sequitur_init_rule_id(grammar, -1, true);
 }
 
+/*
+ * Scan the symbols array in memory order,
+ * deleted symbols have rule == 0. Then the
+ * spill file, if the grammar was frozen.
+ */
 void sequitur_update(Grammar *grammar, int *update_terminal_id) {
-    Symbol* rule, *sym;
-    DL_FOREACH(grammar->rules, rule) {
-        DL_FOREACH(rule->rule_body, sym) {
-            if(sym->val >= 0)
-                sym->val = update_terminal_id[sym->val];
+    for(SymbolId i = 1; i < grammar->symbols_used; i++) {
+        Symbol *sym = SYMBOL(grammar, i);
+        if(sym->rule && sym->val >= 0)
+            sym->val = update_terminal_id[sym->val];
+    }
+    sequitur_spill_update(grammar, update_terminal_id);
+}
+
+static void append_rule_body(Grammar *dst, Grammar *src, Rule *rule, int *update_terminal_id, LoopCursor *loops) {
+    Symbol *sym;
+    RULE_FOREACH_SYMBOL(src, rule, sym) {
+        if(IS_TERMINAL(sym)) {
+            int val = update_terminal_id ? update_terminal_id[sym->val] : sym->val;
+            int exp = (src->parametric && sym->exp == LOOP_PARAM) ? loop_cursor_next(loops) : sym->exp;
+            append_terminal(dst, val, exp);
+            if(dst->spill && sequitur_should_freeze(dst))
+                sequitur_freeze(dst);
+        } else {
+            int exp = (src->parametric && sym->exp == LOOP_PARAM) ? loop_cursor_next(loops) : sym->exp;
+            for(int i = 0; i < exp; i++)
+                append_rule_body(dst, src, RULE(src, sym->rule_head), update_terminal_id, loops);
         }
     }
 }
 
-double sequitur_finalize(const char* output_path, Grammar *grammar) {
+/**
+ * Append the whole sequence represented by src
+ * to the end of dst, i.e., dst = dst + src
+ *
+ * @update_terminal_id: maps src terminal ids to dst terminal ids,
+ * can be NULL if they use the same terminal ids.
+ *
+ * Loop parameters of src get their counts back, if dst
+ * is parametric, append_terminal() takes them out again.
+ *
+ * src must not be frozen, see sequitur_load_spill().
+ * dst may have a limit, it is then frozen as it grows.
+ */
+void sequitur_append_grammar(Grammar *dst, Grammar *src, int *update_terminal_id) {
+    LoopCursor loops;
+    loop_cursor_init(&loops, src->loop_counts.runs, src->loop_counts.len);
+    if(src->rules_head)
+        append_rule_body(dst, src, RULE(src, src->rules_head), update_terminal_id, &loops);
+}
+
+double sequitur_finalize(const char* output_path, Grammar *grammars, int num_grammars) {
 
     int mpi_size, mpi_rank;
     PMPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
     PMPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
-    // Write grammars from all ranks to one file
-    double compressed_size = sequitur_dump(output_path, grammar, mpi_rank, mpi_size);
-    sequitur_cleanup(grammar);
+    // Write grammars from all ranks (and their threads) to one file
+    double compressed_size = sequitur_dump(output_path, grammars, num_grammars, mpi_rank, mpi_size);
+    for(int i = 0; i < num_grammars; i++)
+        sequitur_cleanup(&grammars[i]);
 
     return compressed_size;
 }
@@ -4,38 +4,118 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "pilgrim_sequitur.h"
 #include "pilgrim_utils.h"
 
+#define DIGRAM_TABLE_INITIAL_CAPACITY   256     // slots
 
-void* build_digram_key(int v1, int exp1, int v2, int exp2) {
-    void *key = pilgrim_malloc(DIGRAM_KEY_LEN);
-    memcpy(key, &v1, sizeof(int));
-    memcpy(key+sizeof(int), &exp1, sizeof(int));
-    memcpy(key+sizeof(int)*2, &v2, sizeof(int));
-    memcpy(key+sizeof(int)*3, &exp2, sizeof(int));
-    return key;
+
+static inline uint64_t pack(int val, int exp) {
+    return ((uint64_t)(uint32_t)val << 32) | (uint32_t)exp;
 }
 
+static inline uint64_t digram_hash(uint64_t k1, uint64_t k2) {
+    uint64_t h = (k1 ^ (k2 * 0x9e3779b97f4a7c15ULL)) * 0xff51afd7ed558ccdULL;
+    h ^= h >> 32;
+    return h;
+}
 
-/**
- * Look up a digram in the hash table
- *
- * @param v1 The symbol value of the first symbol of the digram
- * @param v2 The symbol value of the second symbol of the digram
- */
-Symbol* digram_get(Digram *digram_table, Symbol* sym1, Symbol* sym2) {
+static inline unsigned home_slot(DigramTable *table, uint64_t k1, uint64_t k2) {
+    return digram_hash(k1, k2) & (table->capacity - 1);
+}
 
-    void* key = build_digram_key(sym1->val, sym1->exp, sym2->val, sym2->exp);
+static void grow_slots(DigramTable *table) {
+    DigramSlot *old_slots = table->slots;
+    unsigned old_capacity = table->capacity;
+
+    table->capacity = old_capacity * 2;
+    table->slots = pilgrim_malloc(sizeof(DigramSlot) * table->capacity);
+    memset(table->slots, 0, sizeof(DigramSlot) * table->capacity);
+
+    unsigned mask = table->capacity - 1;
+    for(unsigned i = 0; i < old_capacity; i++) {
+        if(old_slots[i].symbol == 0) continue;
+        unsigned idx = home_slot(table, old_slots[i].k1, old_slots[i].k2);
+        while(table->slots[idx].symbol)
+            idx = (idx + 1) & mask;
+        table->slots[idx] = old_slots[i];
+    }
 
-    Digram *found;
-    HASH_FIND(hh, digram_table, key, DIGRAM_KEY_LEN, found);
-    pilgrim_free(key, DIGRAM_KEY_LEN);
+    pilgrim_free(old_slots, sizeof(DigramSlot) * old_capacity);
+}
 
-    if(found) {
-        return found->symbol;
+/*
+ * Return the slot holding the key, or the
+ * empty slot that ends its probe sequence
+ */
+static inline DigramSlot* find_slot(DigramTable *table, uint64_t k1, uint64_t k2) {
+    unsigned mask = table->capacity - 1;
+    unsigned idx = home_slot(table, k1, k2);
+    DigramSlot *slot;
+    while((slot = &table->slots[idx])->symbol) {
+        if(slot->k1 == k1 && slot->k2 == k2)
+            return slot;
+        idx = (idx + 1) & mask;
+    }
+    return slot;
+}
+
+/*
+ * Backward-shift deletion: move every following entry of the
+ * cluster that is not at its home slot into the hole, so
+ * probe sequences stay unbroken without tombstones.
+ */
+static void remove_slot(DigramTable *table, DigramSlot *slot) {
+    unsigned mask = table->capacity - 1;
+    unsigned hole = slot - table->slots;
+    unsigned idx = hole;
+
+    while(1) {
+        idx = (idx + 1) & mask;
+        DigramSlot *next = &table->slots[idx];
+        if(next->symbol == 0)
+            break;
+
+        // Can the entry at idx move to the hole? Only if its
+        // home slot is not in the cyclic range (hole, idx]
+        unsigned home = home_slot(table, next->k1, next->k2);
+        if(((idx - home) & mask) >= ((idx - hole) & mask)) {
+            table->slots[hole] = *next;
+            hole = idx;
+        }
     }
-    return NULL;
+
+    table->slots[hole].symbol = 0;
+    table->count--;
+}
+
+
+void digram_table_init(DigramTable *table) {
+    table->capacity = DIGRAM_TABLE_INITIAL_CAPACITY;
+    table->count = 0;
+    table->slots = pilgrim_malloc(sizeof(DigramSlot) * table->capacity);
+    memset(table->slots, 0, sizeof(DigramSlot) * table->capacity);
+}
+
+void digram_table_cleanup(DigramTable *table) {
+    if(table->slots)
+        pilgrim_free(table->slots, sizeof(DigramSlot) * table->capacity);
+    table->slots = NULL;
+    table->capacity = 0;
+    table->count = 0;
+}
+
+/**
+ * Look up a digram in the hash table
+ *
+ * @param sym1 The first symbol of the digram
+ * @param sym2 The second symbol of the digram
+ */
+SymbolId digram_get(Grammar *grammar, SymbolId sym1, SymbolId sym2) {
+    Symbol *s1 = SYMBOL(grammar, sym1), *s2 = SYMBOL(grammar, sym2);
+    DigramSlot *slot = find_slot(&grammar->digram_table, pack(s1->val, s1->exp), pack(s2->val, s2->exp));
+    return slot->symbol;
 }
 
 /**
@@ -44,49 +124,48 @@ Symbol* digram_get(Digram *digram_table, Symbol* sym1, Symbol* sym2) {
  * @param symbol The first symbol of the digram
  *
  */
-int digram_put(Digram **digram_table, Symbol *symbol) {
-    if (symbol == NULL || symbol->next == NULL)
+int digram_put(Grammar *grammar, SymbolId symbol) {
+    if (symbol == 0 || SYMBOL(grammar, symbol)->next == 0)
         return -1;
 
-    void* key = build_digram_key(symbol->val, symbol->exp, symbol->next->val, symbol->next->exp);
+    DigramTable *table = &grammar->digram_table;
 
-    Digram *found;
-    HASH_FIND(hh, *digram_table, key, DIGRAM_KEY_LEN, found);
+    // Keep the load factor under 0.5
+    if((table->count + 1) * 2 > table->capacity)
+        grow_slots(table);
+
+    Symbol *s1 = SYMBOL(grammar, symbol), *s2 = SYMBOL(grammar, s1->next);
+    uint64_t k1 = pack(s1->val, s1->exp);
+    uint64_t k2 = pack(s2->val, s2->exp);
+    DigramSlot *slot = find_slot(table, k1, k2);
 
     // Found the same digram in the table already
-    if(found) {
-        pilgrim_free(key, DIGRAM_KEY_LEN);
+    if(slot->symbol)
         return 1;
-    } else {
-        Digram *digram = pilgrim_malloc(sizeof(Digram));
-        digram->key = key;
-        digram->symbol = symbol;
-        HASH_ADD_KEYPTR(hh, *digram_table, digram->key, DIGRAM_KEY_LEN, digram);
-        return 0;
-    }
+
+    slot->k1 = k1;
+    slot->k2 = k2;
+    slot->symbol = symbol;
+    table->count++;
+    return 0;
 }
 
 
-int digram_delete(Digram **digram_table, Symbol *symbol) {
-    if(symbol == NULL || symbol->next == NULL)
+int digram_delete(Grammar *grammar, SymbolId symbol) {
+    if(symbol == 0 || SYMBOL(grammar, symbol)->next == 0)
         return 0;
 
-    void* key = build_digram_key(symbol->val, symbol->exp, symbol->next->val, symbol->next->exp);
-
-    Digram *found;
-    HASH_FIND(hh, *digram_table, key, DIGRAM_KEY_LEN, found);
-    pilgrim_free(key, DIGRAM_KEY_LEN);
+    DigramTable *table = &grammar->digram_table;
+    Symbol *s1 = SYMBOL(grammar, symbol), *s2 = SYMBOL(grammar, s1->next);
+    DigramSlot *slot = find_slot(table, pack(s1->val, s1->exp), pack(s2->val, s2->exp));
 
     // 1 1 1, this sequence only has one digram (1, 1) points to the first 1.
     // if somehow digram_delete is called on the 2nd 1, we should not delete the
     // digram. This can happen for this sequence 1 1 1 2 1 2
-    if(found && found->symbol == symbol) {
-        HASH_DELETE(hh, *digram_table, found);
-        pilgrim_free(found->key, DIGRAM_KEY_LEN);
-        pilgrim_free(found, sizeof(Digram));
+    if(slot->symbol == symbol) {
+        remove_slot(table, slot);
         return 0;
     }
 
     return -1;
 }
-
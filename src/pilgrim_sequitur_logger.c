@@ -6,10 +6,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <string.h>
 #include "pilgrim_sequitur.h"
 #include "pilgrim_utils.h"
+#include "pilgrim_varint.h"
 #include "mpi.h"
 #include "uthash.h"
+#include "zstd.h"
 
 typedef struct UniqueGrammar_t {
     int ugi;                // unique grammar id
@@ -28,6 +31,8 @@ static int current_ugi = 0;
  * | rule 1 head | #symbols of rule 1 | symbol 1, ..., symbol N |
  * | rule 2 head | #symbols of rule 2 | symbol 1, ..., symbol N |
  * ...
+ * Parametric grammars also have their loop counts at the end:
+ * | #runs | count | repeat | ...
  *
  * @len: [out] the length of the array: 1 + 2 * number of rules + number of symbols
  * @return: return the array, need to be freed by the caller
@@ -35,48 +40,112 @@ static int current_ugi = 0;
  */
 int* serialize_grammar(Grammar *grammar, int *integers) {
 
-    int total_integers = 1, symbols_count = 0, rules_count = 0;
+    int total_integers = 1, rules_count = 0;
 
-    Symbol *rule, *sym;
-    DL_COUNT(grammar->rules, rule, rules_count);
+    Rule *rule;
+    Symbol *sym;
+    GRAMMAR_FOREACH_RULE(grammar, rule)
+        rules_count++;
 
-    total_integers += 2 * rules_count;
+    // Count the symbols of each rule with one pass
+    // over the symbols array, deleted ones have rule == 0
+    int *symbols_count = pilgrim_malloc(sizeof(int) * grammar->rules_used);
+    memset(symbols_count, 0, sizeof(int) * grammar->rules_used);
+    for(SymbolId s = 1; s < grammar->symbols_used; s++)
+        symbols_count[SYMBOL(grammar, s)->rule]++;
 
-    DL_FOREACH(grammar->rules, rule) {
-        DL_COUNT(rule->rule_body, sym, symbols_count);
-        total_integers += symbols_count*2;  // val and exp
+    total_integers += 2 * rules_count;
+    for(uint32_t r = 1; r < grammar->rules_used; r++)
+        total_integers += symbols_count[r]*2;  // val and exp
+    if(grammar->parametric)
+        total_integers += 1 + grammar->loop_counts.len;
+
+    // A frozen grammar, its spilled rules are streamed from the spill
+    // file after the ones in memory and its segments are put in front
+    // of the main rule body, see pilgrim_sequitur_spill.c
+    GrammarSpill *spill = grammar->spill;
+    int segments = 0;
+    if(spill && spill->fd >= 0) {
+        segments = spill->segments;
+        total_integers += 2 * spill->rules + 2 * spill->symbols + 2 * segments;
     }
 
-    int i = 0;
+    int i = 0, *segments_data = NULL;
     int *data = pilgrim_malloc(sizeof(int) * total_integers);
-    data[i++]  = rules_count;
-    DL_FOREACH(grammar->rules, rule) {
-        DL_COUNT(rule->rule_body, sym, symbols_count);
+    data[i++]  = rules_count + (segments ? spill->rules : 0);
+    GRAMMAR_FOREACH_RULE(grammar, rule) {
         data[i++] = rule->val;
-        data[i++] = symbols_count;
+        data[i++] = symbols_count[rule - grammar->rules];
+        if(rule == RULE(grammar, grammar->rules_head) && segments) {
+            data[i-1] += segments;
+            segments_data = data + i;
+            i += 2 * segments;
+        }
 
-        DL_FOREACH(rule->rule_body, sym) {
+        RULE_FOREACH_SYMBOL(grammar, rule, sym) {
             data[i++] = sym->val;       // rule id does not change
             data[i++] = sym->exp;
         }
     }
+    if(segments)
+        i += sequitur_spill_serialize(grammar, segments_data, data+i);
 
+    if(grammar->parametric) {
+        data[i++] = grammar->loop_counts.len / 2;
+        memcpy(data+i, grammar->loop_counts.runs, sizeof(int) * grammar->loop_counts.len);
+    }
+
+    pilgrim_free(symbols_count, sizeof(int) * grammar->rules_used);
     *integers = total_integers;
     return data;
 }
 
 
+// Number of integers of a grammar serialized by serialize_grammar()
+static int serialized_grammar_integers(int *g, bool parametric) {
+    int k = 0;
+    int rules = g[k++];
+    for(int rule_idx = 0; rule_idx < rules; rule_idx++) {
+        k++;                        // rule head
+        int symbols = g[k++];
+        k += symbols * 2;
+    }
+    if(parametric) {
+        int runs = g[k++];
+        k += runs * 2;
+    }
+    return k;
+}
+
 /**
  * Inter-process compression of CFGs
  *
- * Grammar* lg [in]: local grammar
+ * Grammar* lgs [in]: local grammars, one per thread
+ * int* num_threads [out]: number of grammars of each rank, only on rank 0
+ * int* grammar_ids [out]: unique grammar id of each (rank, thread), rank-major.
+ *                         Allocated on rank 0, sum of num_threads integers
  * return: a compressed grammar.
  */
-Grammar* compress_grammars(Grammar *lg, int mpi_rank, int mpi_size, size_t *uncompressed_integers, int* num_unique_grammars, int* grammar_ids) {
+Grammar* compress_grammars(Grammar *lgs, int num_lgs, int mpi_rank, int mpi_size, size_t *uncompressed_integers,
+                           int* num_unique_grammars, int* num_threads, int** grammar_ids) {
     int integers = 0;
-    int *local_grammar = serialize_grammar(lg, &integers);
+    bool parametric = lgs[0].parametric;     // the same for all grammars of all ranks
+    int *serialized[num_lgs], lengths[num_lgs];
+    for(int t = 0; t < num_lgs; t++) {
+        serialized[t] = serialize_grammar(&lgs[t], &lengths[t]);
+        integers += lengths[t];
+    }
+
+    // All grammars of this rank back to back
+    int *local_grammar = pilgrim_malloc(sizeof(int) * integers);
+    for(int t = 0, pos = 0; t < num_lgs; t++) {
+        memcpy(local_grammar+pos, serialized[t], sizeof(int) * lengths[t]);
+        pos += lengths[t];
+        pilgrim_free(serialized[t], sizeof(int) * lengths[t]);
+    }
 
     int recvcounts[mpi_size], displs[mpi_size];
+    PMPI_Gather(&num_lgs, 1, MPI_INT, num_threads, 1, MPI_INT, 0, MPI_COMM_WORLD);
     PMPI_Gather(&integers, 1, MPI_INT, recvcounts, 1, MPI_INT, 0, MPI_COMM_WORLD);
 
     displs[0] = 0;
@@ -104,12 +173,20 @@ Grammar* compress_grammars(Grammar *lg, int mpi_rank, int mpi_size, size_t *unco
 
     *uncompressed_integers = 0;
 
-    // Go through each rank's grammar
+    int total_threads = 0;
+    for(int i = 0; i < mpi_size; i++)
+        total_threads += num_threads[i];
+    *grammar_ids = pilgrim_malloc(sizeof(int) * total_threads);
+    int gi = 0;
+
+    // Go through each rank's grammars, one per thread
     for(int i = 0; i < mpi_size; i++) {
+      int* g = gathered_grammars + displs[i];
+      for(int t = 0; t < num_threads[i]; t++, gi++) {
 
-        // Serialized grammar of rank i
-        int* g = gathered_grammars + displs[i];
-        int g_len = recvcounts[i] * sizeof(int);
+        // Serialized grammar of thread t of rank i
+        int g_integers = serialized_grammar_integers(g, parametric);
+        int g_len = g_integers * sizeof(int);
 
         UniqueGrammar *entry = NULL;
         HASH_FIND(hh, unique_grammars, g, g_len, entry);
@@ -117,13 +194,13 @@ Grammar* compress_grammars(Grammar *lg, int mpi_rank, int mpi_size, size_t *unco
         if(entry) {
             entry->count++;
             // A duplicated grammar, only need to store its id
-            grammar_ids[i] = entry->ugi;
+            (*grammar_ids)[gi] = entry->ugi;
         } else {
             entry = pilgrim_malloc(sizeof(UniqueGrammar));
             entry->ugi = current_ugi++;
             entry->key = g;   // use the existing memory, do not copy it
             HASH_ADD_KEYPTR(hh, unique_grammars, entry->key, g_len, entry);
-            grammar_ids[i] = entry->ugi;
+            (*grammar_ids)[gi] = entry->ugi;
 
             // An unseen grammar, fully store it.
             int k = 0;
@@ -144,7 +221,20 @@ Grammar* compress_grammars(Grammar *lg, int mpi_rank, int mpi_size, size_t *unco
                     *uncompressed_integers += 2;
                 }
             }
+
+            // Loop counts, each run as one (count, repeat) symbol
+            if(parametric) {
+                int runs = g[k++];
+                append_terminal(grammar, runs, 1);
+                *uncompressed_integers += 2;
+                for(int run = 0; run < runs; run++, k += 2) {
+                    append_terminal(grammar, g[k], g[k+1]);
+                    *uncompressed_integers += 2;
+                }
+            }
         }
+        g += g_integers;
+      }
     } // end of for loop
 
     // Clean up the hash table, and gathered grammars
@@ -164,53 +254,182 @@ Grammar* compress_grammars(Grammar *lg, int mpi_rank, int mpi_size, size_t *unco
 // Only used in pilgrim_timings.c
 int* compress_serialize_grammars(int mpi_rank, int mpi_size, Grammar* local_grammar, int* compressed_integers) {
     size_t uncompressed_integers = 0;
-    int grammar_ids[mpi_size];
+    int num_threads[mpi_size];
+    int *grammar_ids = NULL;
     int num_unique_grammars;
-    Grammar *grammar = compress_grammars(local_grammar, mpi_rank, mpi_size, &uncompressed_integers, &num_unique_grammars, grammar_ids);
+    Grammar *grammar = compress_grammars(local_grammar, 1, mpi_rank, mpi_size, &uncompressed_integers,
+                                         &num_unique_grammars, num_threads, &grammar_ids);
 
     int* compressed_grammar = NULL;
     if(mpi_rank == 0) {
         compressed_grammar = serialize_grammar(grammar, compressed_integers);
         sequitur_cleanup(grammar);
         pilgrim_free(grammar, sizeof(Grammar));
+        pilgrim_free(grammar_ids, sizeof(int) * mpi_size);
     }
 
     return compressed_grammar;
 }
 
 
-// Return the size of compressed grammar in KB
-double sequitur_dump(const char* path, Grammar *local_grammar, int mpi_rank, int mpi_size) {
-    int compressed_integers = 0;
+typedef struct VarintBuffer_t {
+    unsigned char *data;
+    size_t len;
+    size_t capacity;
+} VarintBuffer;
+
+static void put_varint(VarintBuffer *buf, uint64_t val) {
+    if(buf->len + VARINT_MAX_BYTES > buf->capacity) {
+        size_t capacity = buf->capacity ? buf->capacity * 2 : 4096;
+        unsigned char *data = pilgrim_malloc(capacity);
+        if(buf->data) {
+            memcpy(data, buf->data, buf->len);
+            pilgrim_free(buf->data, buf->capacity);
+        }
+        buf->data = data;
+        buf->capacity = capacity;
+    }
+    buf->len += varint_encode(val, buf->data + buf->len);
+}
+
+// Run-length encode vals (or their deltas) as | val | repeat | pairs
+static void put_runs(VarintBuffer *buf, int *vals, int n, bool delta) {
+    int prev = 0;
+    for(int i = 0; i < n;) {
+        int d = delta ? vals[i] - prev : vals[i];
+        int repeat = 1;
+        while(i + repeat < n && (delta ? vals[i+repeat] - vals[i+repeat-1] : vals[i+repeat]) == d)
+            repeat++;
+        put_varint(buf, ZIGZAG_ENCODE(d));
+        put_varint(buf, repeat);
+        prev = vals[i+repeat-1];
+        i += repeat;
+    }
+}
+
+/**
+ * Encode the inter-process compressed grammar (as serialize_grammar()
+ * wrote it) in sections, so each can be decoded in bulk. Exps are
+ * almost always 1, and only stored for symbols with the exp flag.
+ */
+static void put_grammar(VarintBuffer *buf, int *g, int start_rule_id) {
+    int rules = g[0], symbols = 0, k = 1;
+    for(int r = 0; r < rules; r++) {
+        symbols += g[k+1];
+        k += 2 + 2*g[k+1];
+    }
+    put_varint(buf, rules);
+    put_varint(buf, symbols);
+
+    k = 1;
+    for(int r = 0; r < rules; r++) {
+        put_varint(buf, start_rule_id - g[k]);
+        put_varint(buf, g[k+1]);
+        k += 2 + 2*g[k+1];
+    }
+
+    k = 1;
+    for(int r = 0; r < rules; r++, k += 2) {
+        for(int i = 0, n = g[k+1]; i < n; i++) {
+            int val = g[k+2+2*i], exp = g[k+3+2*i];
+            bool non_terminal = val < start_rule_id;
+            uint64_t code = non_terminal ? (uint64_t)(start_rule_id - val) : ZIGZAG_ENCODE(val);
+            put_varint(buf, (code << 2) | (non_terminal << 1) | (exp != 1));
+        }
+        k += 2*g[k+1];
+    }
+
+    k = 1;
+    for(int r = 0; r < rules; r++, k += 2) {
+        for(int i = 0, n = g[k+1]; i < n; i++) {
+            int exp = g[k+3+2*i];
+            if(exp != 1)
+                put_varint(buf, exp);
+        }
+        k += 2*g[k+1];
+    }
+}
+
+/**
+ * File layout (GRAMMAR_FILE_VERSION 1):
+ * | magic "PGRM" | version | flags |
+ * then, ZSTD compressed if flags has GRAMMAR_FILE_ZSTD (| payload bytes | frame |),
+ * varints only, the signed ones zigzag encoded:
+ * | number of threads of each rank, run-length encoded: value, repeat, ... |
+ * | unique grammar id of each (rank, thread), rank-major, run-length encoded deltas |
+ * | number of unique grammars | start rule id | uncompressed integers |
+ * | #rules | #symbols | start rule id - rule id, #symbols, ... (one pair per rule) |
+ * | symbols: code << 2 | non-terminal << 1 | exp != 1, ... |
+ * | exps of the symbols whose exp != 1 |
+ *
+ * The code of a terminal is zigzag(val), of a non-terminal start rule id - val.
+ * ZSTD is only used if it makes the file smaller.
+ *
+ * Return the size of compressed grammar in KB
+ */
+double sequitur_dump(const char* path, Grammar *local_grammars, int num_local_grammars, int mpi_rank, int mpi_size) {
+    size_t file_bytes = 0;
 
     // Compressed grammar is NULL except rank 0
     size_t uncompressed_integers = 0;
-    int grammar_ids[mpi_size];
+    int num_threads[mpi_size];
+    int *grammar_ids = NULL;
     int num_unique_grammars;
-    Grammar *grammar = compress_grammars(local_grammar, mpi_rank, mpi_size, &uncompressed_integers, &num_unique_grammars, grammar_ids);
+    Grammar *grammar = compress_grammars(local_grammars, num_local_grammars, mpi_rank, mpi_size, &uncompressed_integers,
+                                         &num_unique_grammars, num_threads, &grammar_ids);
 
     // Serialize the compressed grammar and write it to file
     if(mpi_rank == 0) {
+        int compressed_integers;
         int* compressed_grammar = serialize_grammar(grammar, &compressed_integers);
+        int total_threads = 0;
+        for(int i = 0; i < mpi_size; i++)
+            total_threads += num_threads[i];
+
+        VarintBuffer payload = {NULL, 0, 0};
+        put_runs(&payload, num_threads, mpi_size, false);
+        put_runs(&payload, grammar_ids, total_threads, true);
+        put_varint(&payload, num_unique_grammars);
+        put_varint(&payload, ZIGZAG_ENCODE(grammar->start_rule_id));
+        put_varint(&payload, uncompressed_integers);
+        put_grammar(&payload, compressed_grammar, grammar->start_rule_id);
+
+        unsigned char header[4 + 2 + VARINT_MAX_BYTES] = GRAMMAR_FILE_MAGIC;
+        size_t header_bytes = 4;
+        header[header_bytes++] = GRAMMAR_FILE_VERSION;
+        header[header_bytes++] = 0;
+
+        size_t zstd_buf_size = ZSTD_compressBound(payload.len);
+        void *zstd_buf = pilgrim_malloc(zstd_buf_size);
+        size_t zstd_bytes = ZSTD_compress(zstd_buf, zstd_buf_size, payload.data, payload.len, 1);
+        bool zstd = !ZSTD_isError(zstd_bytes) && zstd_bytes + VARINT_MAX_BYTES < payload.len;
+        if(zstd) {
+            header[5] |= GRAMMAR_FILE_ZSTD;
+            header_bytes += varint_encode(payload.len, header + header_bytes);
+        }
 
         errno = 0;
         FILE* f = fopen(path, "wb");
         if(f) {
-            fwrite(grammar_ids, sizeof(int), mpi_size, f);
-            fwrite(&num_unique_grammars, sizeof(int), 1, f);
-            fwrite(&(grammar->start_rule_id), sizeof(int), 1, f);
-            fwrite(&uncompressed_integers, sizeof(size_t), 1, f);
-            fwrite(compressed_grammar, sizeof(int), compressed_integers, f);
+            fwrite(header, 1, header_bytes, f);
+            if(zstd)
+                fwrite(zstd_buf, 1, zstd_bytes, f);
+            else
+                fwrite(payload.data, 1, payload.len, f);
             fflush(f);
             fclose(f);
+            file_bytes = header_bytes + (zstd ? zstd_bytes : payload.len);
         } else {
             printf("Open file: %s failed, errno: %d!\n", path, errno);
         }
 
+        pilgrim_free(zstd_buf, zstd_buf_size);
+        pilgrim_free(payload.data, payload.capacity);
         sequitur_cleanup(grammar);
         pilgrim_free(grammar, sizeof(Grammar));
         pilgrim_free(compressed_grammar, compressed_integers*sizeof(int));
+        pilgrim_free(grammar_ids, sizeof(int) * total_threads);
     }
 
-    return (compressed_integers/1024.0*sizeof(int));
+    return file_bytes / 1024.0;
 }
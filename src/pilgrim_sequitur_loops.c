@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Parametric loops (PILGRIM_PARAMETRIC_LOOPS)
+ *
+ * Adaptive codes run the same loop with a different trip count
+ * every outer iteration, e.g., a^8 b a^9 b a^12 b ... With the trip
+ * count in the digram key none of these digrams repeat and the grammar
+ * grows as fast as the trace.
+ *
+ * In a parametric grammar such a loop is kept as a^LOOP_PARAM and its
+ * count is pushed to grammar->loop_counts, so the sequence above is just
+ * (a^LOOP_PARAM b)^n plus the counts 8 9 12 ... A rule whose body has
+ * a^LOOP_PARAM takes that count as a parameter each time it is used.
+ * Sequitur never reorders the expansion of the grammar, so the counts
+ * are consumed in the order they were pushed: the k-th a^LOOP_PARAM of
+ * the expansion gets the k-th count.
+ *
+ * Loops come from two places:
+ * 1. append_terminal() with exp > 1, the logger's runs of one call.
+ * 2. twins-removal of a rule at the end of the main rule, e.g.,
+ *    (Irecv Isend Waitall)^k. Only rules without parameters of their
+ *    own are turned into loops, then the count of the loop is always
+ *    the last one pushed and can be updated in place. Everywhere else
+ *    twins-removal keeps a fixed exp, and never merges a parameter.
+ *
+ * Counts are run-length encoded, a loop with a fixed trip count
+ * costs one run for the whole execution. serialize_grammar() writes
+ * them after the rules:
+ *
+ * | #runs | count | repeat | count | repeat | ...
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pilgrim_sequitur.h"
+#include "pilgrim_utils.h"
+
+#define LOOP_COUNTS_INITIAL_CAPACITY    256     // integers
+
+
+void loop_counts_push(LoopCounts *counts, int count) {
+    if(counts->len > 0 && counts->runs[counts->len-2] == count) {
+        counts->runs[counts->len-1]++;
+        return;
+    }
+
+    if(counts->len + 2 > counts->capacity) {
+        size_t capacity = counts->capacity ? counts->capacity * 2 : LOOP_COUNTS_INITIAL_CAPACITY;
+        int *runs = pilgrim_malloc(sizeof(int) * capacity);
+        if(counts->runs) {
+            memcpy(runs, counts->runs, sizeof(int) * counts->len);
+            pilgrim_free(counts->runs, sizeof(int) * counts->capacity);
+        }
+        counts->runs = runs;
+        counts->capacity = capacity;
+    }
+    counts->runs[counts->len++] = count;
+    counts->runs[counts->len++] = 1;
+}
+
+// Add delta to the last count pushed
+static void loop_counts_add_last(LoopCounts *counts, int delta) {
+    int count = counts->runs[counts->len-2] + delta;
+    if(--counts->runs[counts->len-1] == 0)
+        counts->len -= 2;
+    loop_counts_push(counts, count);
+}
+
+// Must be called before the first append
+void sequitur_set_parametric(Grammar *grammar) {
+    grammar->parametric = true;
+}
+
+// True if the expansion of the symbol takes loop counts
+bool symbol_has_params(Grammar *grammar, Symbol *sym) {
+    return sym->exp == LOOP_PARAM || (!IS_TERMINAL(sym) && RULE(grammar, sym->rule_head)->params);
+}
+
+/**
+ * Twins-removal of sym and sym->next, which have the same val
+ *
+ * Return the exp of the merged symbol, LOOP_PARAM
+ * if it is a loop, or -1 if they can not be merged.
+ */
+int loop_twins_exp(Grammar *grammar, SymbolId sym) {
+    Symbol *s = SYMBOL(grammar, sym), *next = SYMBOL(grammar, s->next);
+    if(next->exp == LOOP_PARAM)
+        return -1;
+
+    if(grammar->parametric && !IS_TERMINAL(s) && !RULE(grammar, s->rule_head)->params &&
+       s->rule == grammar->rules_head && next->next == 0) {
+        // Neither s nor next take counts, s's count is the last one
+        if(s->exp == LOOP_PARAM)
+            loop_counts_add_last(&grammar->loop_counts, next->exp);
+        else
+            loop_counts_push(&grammar->loop_counts, s->exp + next->exp);
+        return LOOP_PARAM;
+    }
+
+    if(s->exp == LOOP_PARAM)
+        return -1;
+    return s->exp + next->exp;
+}
+
+static void update_rule_params(Grammar *grammar, uint32_t rule, unsigned char *visited) {
+    if(visited[rule]) return;
+    visited[rule] = 1;
+
+    Rule *r = RULE(grammar, rule);
+    Symbol *sym;
+    r->params = false;
+    RULE_FOREACH_SYMBOL(grammar, r, sym) {
+        if(!IS_TERMINAL(sym))
+            update_rule_params(grammar, sym->rule_head, visited);
+        if(symbol_has_params(grammar, sym))
+            r->params = true;
+    }
+}
+
+// Set Rule.params of all rules, for grammars not built by append_terminal()
+void loop_params_update(Grammar *grammar) {
+    unsigned char *visited = pilgrim_malloc(grammar->rules_used);
+    memset(visited, 0, grammar->rules_used);
+    Rule *rule;
+    GRAMMAR_FOREACH_RULE(grammar, rule)
+        update_rule_params(grammar, rule - grammar->rules, visited);
+    pilgrim_free(visited, grammar->rules_used);
+}
+
+void loop_counts_free(LoopCounts *counts) {
+    if(counts->runs)
+        pilgrim_free(counts->runs, sizeof(int) * counts->capacity);
+    counts->runs = NULL;
+    counts->len = 0;
+    counts->capacity = 0;
+}
+
+/**
+ * @runs: count, repeat pairs, e.g., LoopCounts.runs
+ * @len: number of integers
+ */
+void loop_cursor_init(LoopCursor *cursor, const int *runs, size_t len) {
+    cursor->runs = runs;
+    cursor->len = len;
+    cursor->pos = 0;
+    cursor->left = len > 0 ? runs[1] : 0;
+}
+
+int loop_cursor_next(LoopCursor *cursor) {
+    while(cursor->left == 0) {
+        cursor->pos += 2;
+        if(cursor->pos >= cursor->len)
+            ERROR_ABORT("[pilgrim] Ran out of loop counts!\n");
+        cursor->left = cursor->runs[cursor->pos+1];
+    }
+    cursor->left--;
+    return cursor->runs[cursor->pos];
+}
@@ -0,0 +1,424 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Bounded grammar memory (PILGRIM_MAX_GRAMMAR_MB)
+ *
+ * When a grammar is about to grow past its limit, sequitur_freeze()
+ * 1. writes the body of the main rule to the spill file as a segment,
+ *    i.e., a new rule whose id is taken from grammar->rule_id,
+ * 2. keeps the rules used by the last SPILL_KEEP_SYMBOLS symbols of
+ *    the main rule (and the rules they use) as the shared dictionary,
+ * 3. writes all other rules to the spill file and deletes them.
+ * Then compression restarts with an empty main rule.
+ *
+ * The kept rules are also referenced from the spill file, which their
+ * ref counts do not see. They are pinned (ref += RULE_PINNED) until they
+ * are spilled or loaded back, otherwise rule utility could inline and
+ * delete them. Sequitur never changes what a rule expands to, so a rule
+ * written out earlier stays valid for all its users.
+ *
+ * The grammar is never loaded back as a whole. Once recording is over,
+ * sequitur_spill_update() remaps the terminals of the spill file in place
+ * and sequitur_spill_serialize() streams its records into the output of
+ * serialize_grammar(), as if the segments were put in front of the main
+ * rule body, i.e., S -> seg1 seg2 ... body. Both read the file in chunks
+ * of SPILL_CHUNK integers.
+ *
+ * sequitur_load_spill() does turn it back into a normal grammar, which
+ * is only needed to append it to another one (a thread that reused a tid).
+ *
+ * Spill file record: | kind | rule id | #symbols | val exp ... |
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "pilgrim_sequitur.h"
+#include "pilgrim_utils.h"
+
+#define RULE_PINNED         (1<<30)
+#define SPILL_KEEP_SYMBOLS  64      // tail of the main rule whose rules are kept
+#define SPILL_SLACK         64      // symbols (digrams) one append may add
+#define SPILL_MIN_APPENDS   4096    // do not freeze again before this many appends
+#define SPILL_CHUNK         65536   // integers read at a time when streaming the spill file
+
+enum { SPILL_SEGMENT = 0, SPILL_RULE = 1 };
+
+// Position of an integer within its spill file record
+enum { FIELD_KIND, FIELD_ID, FIELD_SYMBOLS, FIELD_VAL, FIELD_EXP };
+
+typedef struct SpillBuffer_t {
+    int *data;
+    size_t len, capacity;
+} SpillBuffer;
+
+
+static void buffer_push(SpillBuffer *buf, int val) {
+    if(buf->len == buf->capacity) {
+        size_t capacity = buf->capacity ? buf->capacity * 2 : 4096;
+        int *data = pilgrim_malloc(sizeof(int) * capacity);
+        if(buf->data) {
+            memcpy(data, buf->data, sizeof(int) * buf->len);
+            pilgrim_free(buf->data, sizeof(int) * buf->capacity);
+        }
+        buf->data = data;
+        buf->capacity = capacity;
+    }
+    buf->data[buf->len++] = val;
+}
+
+static void buffer_rule(Grammar *grammar, SpillBuffer *buf, int kind, int id, uint32_t rule) {
+    buffer_push(buf, kind);
+    buffer_push(buf, id);
+    size_t count = buf->len;
+    buffer_push(buf, 0);
+
+    Symbol *sym;
+    RULE_FOREACH_SYMBOL(grammar, RULE(grammar, rule), sym) {
+        buffer_push(buf, sym->val);
+        buffer_push(buf, sym->exp);
+    }
+    buf->data[count] = (buf->len - count - 1) / 2;
+}
+
+// Delete the whole body of a rule and its digrams
+static void delete_body(Grammar *grammar, uint32_t rule) {
+    SymbolId this = RULE(grammar, rule)->body, next;
+    while(this) {
+        next = SYMBOL(grammar, this)->next;
+        digram_delete(grammar, this);
+        symbol_delete(grammar, this, true);
+        this = next;
+    }
+}
+
+// Mark the rule and all rules used by it, stack has room for every rule
+static void mark_rules(Grammar *grammar, unsigned char *keep, uint32_t *stack, uint32_t rule) {
+    if(keep[rule]) return;
+    int top = 0;
+    keep[rule] = 1;
+    stack[top++] = rule;
+    while(top > 0) {
+        Symbol *sym;
+        RULE_FOREACH_SYMBOL(grammar, RULE(grammar, stack[--top]), sym) {
+            if(!IS_TERMINAL(sym) && !keep[sym->rule_head]) {
+                keep[sym->rule_head] = 1;
+                stack[top++] = sym->rule_head;
+            }
+        }
+    }
+}
+
+static void write_all(int fd, const void *data, size_t bytes) {
+    const char *p = data;
+    while(bytes > 0) {
+        ssize_t n = write(fd, p, bytes);
+        if(n <= 0) ERROR_ABORT("[pilgrim] Failed to write the grammar spill file!\n");
+        p += n;
+        bytes -= n;
+    }
+}
+
+static void read_all(int fd, void *data, size_t bytes, off_t offset) {
+    char *p = data;
+    while(bytes > 0) {
+        ssize_t n = pread(fd, p, bytes, offset);
+        if(n <= 0) ERROR_ABORT("[pilgrim] Failed to read the grammar spill file!\n");
+        p += n;
+        bytes -= n;
+        offset += n;
+    }
+}
+
+static void rewrite_all(int fd, const void *data, size_t bytes, off_t offset) {
+    const char *p = data;
+    while(bytes > 0) {
+        ssize_t n = pwrite(fd, p, bytes, offset);
+        if(n <= 0) ERROR_ABORT("[pilgrim] Failed to write the grammar spill file!\n");
+        p += n;
+        bytes -= n;
+        offset += n;
+    }
+}
+
+// Walks the spill file one integer at a time
+typedef struct SpillCursor_t {
+    int field;          // field of the last integer
+    int left;           // integers left in its record
+} SpillCursor;
+
+static int next_field(SpillCursor *cursor, int val) {
+    if(cursor->left == 0) {
+        cursor->field = FIELD_KIND;
+        cursor->left = 2;
+    } else {
+        cursor->left--;
+        if(cursor->field == FIELD_KIND)
+            cursor->field = FIELD_ID;
+        else if(cursor->field == FIELD_ID) {
+            cursor->field = FIELD_SYMBOLS;
+            cursor->left = 2 * val;
+        } else
+            cursor->field = (cursor->field == FIELD_VAL) ? FIELD_EXP : FIELD_VAL;
+    }
+    return cursor->field;
+}
+
+
+void sequitur_set_limit(Grammar *grammar, size_t max_bytes, const char *spill_path) {
+    GrammarSpill *spill = pilgrim_malloc(sizeof(GrammarSpill));
+    spill->max_bytes = max_bytes;
+    snprintf(spill->path, sizeof(spill->path), "%s", spill_path);
+    spill->fd = -1;
+    spill->countdown = 0;
+    spill->segments = 0;
+    spill->rules = 0;
+    spill->symbols = 0;
+    grammar->spill = spill;
+}
+
+// Bytes held by the symbol, rule and digram arrays
+size_t sequitur_memory(Grammar *grammar) {
+    return sizeof(Symbol) * grammar->symbols_capacity + sizeof(Rule) * grammar->rules_capacity +
+           sizeof(DigramSlot) * grammar->digram_table.capacity;
+}
+
+/**
+ * Called after every append. True if one of the arrays is
+ * about to grow and the grammar would then exceed its limit.
+ */
+bool sequitur_should_freeze(Grammar *grammar) {
+    GrammarSpill *spill = grammar->spill;
+    if(spill->countdown > 0) {
+        spill->countdown--;
+        return false;
+    }
+
+    size_t grow = 0;
+    if(grammar->free_symbols == 0 && grammar->symbols_used + SPILL_SLACK > grammar->symbols_capacity)
+        grow += sizeof(Symbol) * grammar->symbols_capacity;
+    if(grammar->free_rules == 0 && grammar->rules_used + SPILL_SLACK > grammar->rules_capacity)
+        grow += sizeof(Rule) * grammar->rules_capacity;
+    if((grammar->digram_table.count + SPILL_SLACK) * 2 > grammar->digram_table.capacity)
+        grow += sizeof(DigramSlot) * grammar->digram_table.capacity;
+
+    return grow > 0 && sequitur_memory(grammar) + grow > spill->max_bytes;
+}
+
+void sequitur_freeze(Grammar *grammar) {
+    GrammarSpill *spill = grammar->spill;
+    uint32_t main_rule = grammar->rules_head;
+    SymbolId body = RULE(grammar, main_rule)->body;
+    if(body == 0) return;
+
+    if(spill->fd < 0) {
+        spill->fd = open(spill->path, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+        if(spill->fd < 0) {
+            printf("[pilgrim] Open grammar spill file %s failed, the grammar memory is no longer bounded.\n", spill->path);
+            pilgrim_free(spill, sizeof(GrammarSpill));
+            grammar->spill = NULL;
+            return;
+        }
+    }
+
+    // 1. Pick the dictionary to keep
+    unsigned char *keep = pilgrim_malloc(grammar->rules_used);
+    uint32_t *stack = pilgrim_malloc(sizeof(uint32_t) * grammar->rules_used);
+    memset(keep, 0, grammar->rules_used);
+    SymbolId sym = SYMBOL(grammar, body)->prev;
+    for(int i = 0; i < SPILL_KEEP_SYMBOLS; i++) {
+        if(!IS_TERMINAL(SYMBOL(grammar, sym)))
+            mark_rules(grammar, keep, stack, SYMBOL(grammar, sym)->rule_head);
+        if(sym == body) break;
+        sym = SYMBOL(grammar, sym)->prev;
+    }
+
+    // 2. The main rule body becomes a segment
+    SpillBuffer buf = {NULL, 0, 0};
+    buffer_rule(grammar, &buf, SPILL_SEGMENT, grammar->rule_id--, main_rule);
+    delete_body(grammar, main_rule);
+    spill->segments++;
+    int records = 1;
+
+    // 3. Spill the other rules, pin the kept ones
+    uint32_t rule = RULE(grammar, main_rule)->next, next;
+    while(rule) {
+        next = RULE(grammar, rule)->next;
+        if(keep[rule]) {
+            if(RULE(grammar, rule)->ref < RULE_PINNED)
+                RULE(grammar, rule)->ref += RULE_PINNED;
+        } else {
+            buffer_rule(grammar, &buf, SPILL_RULE, RULE(grammar, rule)->val, rule);
+            delete_body(grammar, rule);
+            rule_delete(grammar, rule);
+            records++;
+        }
+        rule = next;
+    }
+
+    write_all(spill->fd, buf.data, sizeof(int) * buf.len);
+    spill->rules += records;
+    spill->symbols += (buf.len - 3 * records) / 2;
+    pilgrim_free(buf.data, sizeof(int) * buf.capacity);
+    pilgrim_free(keep, grammar->rules_used);
+    pilgrim_free(stack, sizeof(uint32_t) * grammar->rules_used);
+
+    // Give the dictionary a chance to pay off, even
+    // if it alone is already close to the limit
+    spill->countdown = SPILL_MIN_APPENDS;
+}
+
+// Add a rule with the given id, rather than the next one
+static uint32_t restore_rule(Grammar *grammar, int id) {
+    int rule_id = grammar->rule_id;
+    uint32_t rule = new_rule(grammar);
+    grammar->rule_id = rule_id;
+    RULE(grammar, rule)->val = id;
+    rule_put(grammar, rule);
+    return rule;
+}
+
+/**
+ * Turn a frozen grammar back into a normal one
+ * and remove its spill file. No more freezes after this.
+ *
+ * Return the number of segments
+ */
+int sequitur_load_spill(Grammar *grammar) {
+    GrammarSpill *spill = grammar->spill;
+    if(spill == NULL) return 0;
+    int segments = spill->segments;
+
+    if(spill->fd >= 0) {
+        size_t bytes = lseek(spill->fd, 0, SEEK_END);
+        size_t len = bytes / sizeof(int);
+        int *data = pilgrim_malloc(bytes);
+        read_all(spill->fd, data, bytes, 0);
+
+        // Rule index of every rule id handed out so far
+        int ids = grammar->start_rule_id - grammar->rule_id;
+        uint32_t *index = pilgrim_malloc(sizeof(uint32_t) * ids);
+        memset(index, 0, sizeof(uint32_t) * ids);
+        #define RULE_INDEX(id) index[grammar->start_rule_id - (id)]
+
+        // All references are back in memory, the ref counts are exact again
+        Rule *rule;
+        GRAMMAR_FOREACH_RULE(grammar, rule) {
+            RULE_INDEX(rule->val) = rule - grammar->rules;
+            if(rule->ref >= RULE_PINNED)
+                rule->ref -= RULE_PINNED;
+        }
+
+        // First pass creates the rules, the second their bodies,
+        // as a rule may use one that was spilled after it
+        for(size_t pos = 0; pos < len; pos += 3 + 2 * data[pos+2])
+            RULE_INDEX(data[pos+1]) = restore_rule(grammar, data[pos+1]);
+
+        SymbolId last_segment = 0;
+        for(size_t pos = 0; pos < len; pos += 3 + 2 * data[pos+2]) {
+            int kind = data[pos], id = data[pos+1], symbols = data[pos+2];
+            uint32_t r = RULE_INDEX(id);
+            SymbolId tail = 0;
+            for(int i = 0; i < symbols; i++) {
+                int val = data[pos+3+2*i], exp = data[pos+4+2*i];
+                bool terminal = val > grammar->start_rule_id;
+                SymbolId s = new_symbol(grammar, val, exp, terminal, terminal ? 0 : RULE_INDEX(val));
+                symbol_put(grammar, r, tail, s);
+                tail = s;
+            }
+
+            if(kind == SPILL_SEGMENT) {
+                SymbolId s = new_symbol(grammar, id, 1, false, r);
+                symbol_put(grammar, grammar->rules_head, last_segment, s);
+                last_segment = s;
+            }
+        }
+        #undef RULE_INDEX
+        if(grammar->parametric)
+            loop_params_update(grammar);
+
+        pilgrim_free(index, sizeof(uint32_t) * ids);
+        pilgrim_free(data, bytes);
+    }
+
+    sequitur_close_spill(grammar);
+    return segments;
+}
+
+/**
+ * Remap the terminal ids of the spill file in place,
+ * like sequitur_update() does for the rules in memory
+ */
+void sequitur_spill_update(Grammar *grammar, int *update_terminal_id) {
+    GrammarSpill *spill = grammar->spill;
+    if(spill == NULL || spill->fd < 0) return;
+
+    off_t bytes = lseek(spill->fd, 0, SEEK_END);
+    int *data = pilgrim_malloc(sizeof(int) * SPILL_CHUNK);
+    SpillCursor cursor = {FIELD_KIND, 0};
+    for(off_t offset = 0; offset < bytes; offset += sizeof(int) * SPILL_CHUNK) {
+        size_t len = (bytes - offset) / sizeof(int);
+        if(len > SPILL_CHUNK) len = SPILL_CHUNK;
+        read_all(spill->fd, data, sizeof(int) * len, offset);
+        for(size_t i = 0; i < len; i++)
+            if(next_field(&cursor, data[i]) == FIELD_VAL && data[i] >= 0)
+                data[i] = update_terminal_id[data[i]];
+        rewrite_all(spill->fd, data, sizeof(int) * len, offset);
+    }
+    pilgrim_free(data, sizeof(int) * SPILL_CHUNK);
+}
+
+/**
+ * Stream the spill file into the output of serialize_grammar():
+ * the spilled rules go to rules_data, | rule val | #symbols | val exp ... |
+ * and a (segment id, 1) symbol per segment goes to segments_data.
+ *
+ * The caller makes room for spill->rules rules with spill->symbols
+ * symbols in total, and for spill->segments symbols in front of
+ * the main rule body. Return the number of integers written to rules_data.
+ */
+int sequitur_spill_serialize(Grammar *grammar, int *segments_data, int *rules_data) {
+    GrammarSpill *spill = grammar->spill;
+    if(spill == NULL || spill->fd < 0) return 0;
+
+    off_t bytes = lseek(spill->fd, 0, SEEK_END);
+    int *data = pilgrim_malloc(sizeof(int) * SPILL_CHUNK);
+    SpillCursor cursor = {FIELD_KIND, 0};
+    int i = 0, kind = SPILL_RULE;
+    for(off_t offset = 0; offset < bytes; offset += sizeof(int) * SPILL_CHUNK) {
+        size_t len = (bytes - offset) / sizeof(int);
+        if(len > SPILL_CHUNK) len = SPILL_CHUNK;
+        read_all(spill->fd, data, sizeof(int) * len, offset);
+        for(size_t k = 0; k < len; k++) {
+            int field = next_field(&cursor, data[k]);
+            if(field == FIELD_KIND) {
+                kind = data[k];
+                continue;
+            }
+            if(field == FIELD_ID && kind == SPILL_SEGMENT) {
+                *(segments_data++) = data[k];
+                *(segments_data++) = 1;
+            }
+            rules_data[i++] = data[k];
+        }
+    }
+    pilgrim_free(data, sizeof(int) * SPILL_CHUNK);
+    return i;
+}
+
+// Remove the spill file, the grammar is no longer bounded
+void sequitur_close_spill(Grammar *grammar) {
+    GrammarSpill *spill = grammar->spill;
+    if(spill == NULL) return;
+    if(spill->fd >= 0) {
+        close(spill->fd);
+        unlink(spill->path);
+    }
+    pilgrim_free(spill, sizeof(GrammarSpill));
+    grammar->spill = NULL;
+}
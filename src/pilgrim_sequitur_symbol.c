@@ -4,89 +4,170 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "pilgrim_sequitur.h"
 #include "pilgrim_utils.h"
 
 
-Symbol* new_symbol(int val, int exp, bool terminal, Symbol *rule_head) {
-    Symbol* symbol = pilgrim_malloc(sizeof(Symbol));
+/*
+ * Index based versions of utlist's DL_PREPEND, DL_APPEND_ELEM,
+ * DL_APPEND and DL_DELETE. Work on both the symbol and
+ * rule arrays as their elements all have prev/next indices.
+ */
+#define IDX_DL_PREPEND(arr, head, add)                  \
+do {                                                    \
+    if(head) {                                          \
+        (arr)[add].next = (head);                       \
+        (arr)[add].prev = (arr)[head].prev;             \
+        (arr)[head].prev = (add);                       \
+    } else {                                            \
+        (arr)[add].next = 0;                            \
+        (arr)[add].prev = (add);                        \
+    }                                                   \
+    (head) = (add);                                     \
+} while(0)
+
+#define IDX_DL_APPEND_ELEM(arr, head, pos, add)         \
+do {                                                    \
+    (arr)[add].next = (arr)[pos].next;                  \
+    (arr)[add].prev = (pos);                            \
+    (arr)[pos].next = (add);                            \
+    if((arr)[add].next)                                 \
+        (arr)[(arr)[add].next].prev = (add);            \
+    else                                                \
+        (arr)[head].prev = (add);                       \
+} while(0)
+
+#define IDX_DL_APPEND(arr, head, add)                   \
+do {                                                    \
+    if(head) {                                          \
+        uint32_t _tail = (arr)[head].prev;              \
+        IDX_DL_APPEND_ELEM(arr, head, _tail, add);      \
+    } else                                              \
+        IDX_DL_PREPEND(arr, head, add);                 \
+} while(0)
+
+#define IDX_DL_DELETE(arr, head, del)                   \
+do {                                                    \
+    if((arr)[del].prev == (del)) {                      \
+        (head) = 0;                                     \
+    } else if((del) == (head)) {                        \
+        (arr)[(arr)[del].next].prev = (arr)[del].prev;  \
+        (head) = (arr)[del].next;                       \
+    } else {                                            \
+        (arr)[(arr)[del].prev].next = (arr)[del].next;  \
+        if((arr)[del].next)                             \
+            (arr)[(arr)[del].next].prev = (arr)[del].prev; \
+        else                                            \
+            (arr)[head].prev = (arr)[del].prev;         \
+    }                                                   \
+} while(0)
+
+
+static void* grow_array(void *arr, uint32_t *capacity, size_t elem_size) {
+    uint32_t new_capacity = *capacity * 2;
+    void *new_arr = pilgrim_malloc(elem_size * new_capacity);
+    memcpy(new_arr, arr, elem_size * (*capacity));
+    pilgrim_free(arr, elem_size * (*capacity));
+    *capacity = new_capacity;
+    return new_arr;
+}
+
+
+SymbolId new_symbol(Grammar *grammar, int val, int exp, bool terminal, uint32_t rule_head) {
+    SymbolId id = grammar->free_symbols;
+    if(id) {
+        grammar->free_symbols = SYMBOL(grammar, id)->next;
+    } else {
+        if(grammar->symbols_used == grammar->symbols_capacity)
+            grammar->symbols = grow_array(grammar->symbols, &grammar->symbols_capacity, sizeof(Symbol));
+        id = grammar->symbols_used++;
+    }
+
+    Symbol *symbol = SYMBOL(grammar, id);
     symbol->val = val;
     symbol->exp = exp;
     symbol->terminal = terminal;
-
-    symbol->ref = 0;
-    symbol->rule = NULL;
+    symbol->rule = 0;
     symbol->rule_head = rule_head;
-    symbol->rule_body = NULL;
-
-    symbol->prev = NULL;
-    symbol->next = NULL;
-    return symbol;
+    symbol->prev = 0;
+    symbol->next = 0;
+    return id;
 }
 
 
 /**
- * Insert a symbol after the pos in rule
+ * Insert a symbol after the pos in rule,
+ * pos = 0 inserts it as the first symbol
  *
- * `rule` of terminals and non-terminals point to the rule it belongs to
- *
- * rule_head of an non-terminal points to its corresponding rule
- *          and the rule_head filed in this case will be set before
- *          calling this function
+ * Inserting a non-terminal adds a reference
+ * to the rule it represents.
  */
-void symbol_put(Symbol *rule, Symbol *pos, Symbol *sym) {
-    if(!IS_RULE_HEAD(sym))
-        sym->rule = rule;
+void symbol_put(Grammar *grammar, uint32_t rule, SymbolId pos, SymbolId sym) {
+    Symbol *symbol = SYMBOL(grammar, sym);
+    symbol->rule = rule;
 
-    if(pos == NULL)     // insert as the head
-        DL_PREPEND_ELEM(rule->rule_body, rule->rule_body, sym);
+    if(pos == 0)     // insert as the head
+        IDX_DL_PREPEND(grammar->symbols, RULE(grammar, rule)->body, sym);
     else
-        DL_APPEND_ELEM(rule->rule_body, pos, sym);
+        IDX_DL_APPEND_ELEM(grammar->symbols, RULE(grammar, rule)->body, pos, sym);
 
-    if(IS_NONTERMINAL(sym))
-        rule_ref(sym->rule_head);
+    if(!IS_TERMINAL(symbol))
+        RULE(grammar, symbol->rule_head)->ref++;
 }
-void symbol_delete(Symbol *rule, Symbol *sym, bool deref) {
-    if(IS_NONTERMINAL(sym) && deref)
-        rule_deref(sym->rule_head);
 
-    DL_DELETE(rule->rule_body, sym);
-    pilgrim_free(sym, sizeof(Symbol));
-    sym = NULL;
+void symbol_delete(Grammar *grammar, SymbolId sym, bool deref) {
+    Symbol *symbol = SYMBOL(grammar, sym);
+    if(!IS_TERMINAL(symbol) && deref)
+        RULE(grammar, symbol->rule_head)->ref--;
+
+    IDX_DL_DELETE(grammar->symbols, RULE(grammar, symbol->rule)->body, sym);
+
+    // Mark it as deleted and reuse it later
+    symbol->rule = 0;
+    symbol->next = grammar->free_symbols;
+    grammar->free_symbols = sym;
 }
 
 
 /**
- * New rule head symbol
+ * New rule, its id is the current grammar->rule_id
  */
-Symbol* new_rule(Grammar *grammar) {
-    Symbol* rule = new_symbol(grammar->rule_id, 1, false, NULL);
+uint32_t new_rule(Grammar *grammar) {
+    uint32_t idx = grammar->free_rules;
+    if(idx) {
+        grammar->free_rules = RULE(grammar, idx)->next;
+    } else {
+        if(grammar->rules_used == grammar->rules_capacity)
+            grammar->rules = grow_array(grammar->rules, &grammar->rules_capacity, sizeof(Rule));
+        idx = grammar->rules_used++;
+    }
+
+    Rule *rule = RULE(grammar, idx);
+    rule->val = grammar->rule_id;
+    rule->ref = 0;
+    rule->body = 0;
+    rule->prev = 0;
+    rule->next = 0;
+    rule->params = false;
     grammar->rule_id = grammar->rule_id - 1;
-    return rule;
+    return idx;
 }
 
 /**
  * Insert a rule into the rule list
  *
  */
-void rule_put(Symbol **rules_head, Symbol *rule) {
-    DL_APPEND(*rules_head, rule);
+void rule_put(Grammar *grammar, uint32_t rule) {
+    IDX_DL_APPEND(grammar->rules, grammar->rules_head, rule);
 }
 
 /**
  * Delete a rule from the list
  *
  */
-void rule_delete(Symbol **rules_head, Symbol *rule) {
-    DL_DELETE(*rules_head, rule);
-    pilgrim_free(rule, sizeof(Symbol));
-    rule = NULL;
-}
-
-void rule_ref(Symbol *rule) {
-    rule->ref++;
-}
-
-void rule_deref(Symbol *rule) {
-    rule->ref--;
+void rule_delete(Grammar *grammar, uint32_t rule) {
+    IDX_DL_DELETE(grammar->rules, grammar->rules_head, rule);
+    RULE(grammar, rule)->next = grammar->free_rules;
+    grammar->free_rules = rule;
 }
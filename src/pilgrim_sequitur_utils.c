@@ -8,35 +8,33 @@
 #include "pilgrim_sequitur.h"
 
 void sequitur_print_digrams(Grammar *grammar) {
-    Digram *digram, *tmp;
-
-    printf("digrams count: %d\n", HASH_COUNT(grammar->digram_table));
-    HASH_ITER(hh, grammar->digram_table, digram, tmp) {
-        int v1, v2;
-        memcpy(&v1, digram->key, sizeof(int));
-        memcpy(&v2, digram->key+sizeof(int)*2, sizeof(int));
-
-        if(digram->symbol->rule)
-            printf("digram(%d, %d, rule:%d): %d %d\n", v1, v2, digram->symbol->rule->val, digram->symbol->val, digram->symbol->next->val);
-        else
-            printf("digram(%d, %d, rule:): %d %d\n", v1, v2, digram->symbol->val, digram->symbol->next->val);
+    DigramTable *table = &grammar->digram_table;
+
+    printf("digrams count: %u\n", table->count);
+    for(unsigned i = 0; i < table->capacity; i++) {
+        DigramSlot *slot = &table->slots[i];
+        if(slot->symbol == 0) continue;
+
+        int v1 = (int)(slot->k1 >> 32), v2 = (int)(slot->k2 >> 32);
+        Symbol *sym = SYMBOL(grammar, slot->symbol);
+        printf("digram(%d, %d, rule:%d): %d %d\n", v1, v2, RULE(grammar, sym->rule)->val,
+                sym->val, SYMBOL(grammar, sym->next)->val);
     }
 }
 
 void sequitur_print_rules(FILE* stream, Grammar *grammar) {
-    Symbol *rule, *sym;
+    Rule *rule;
+    Symbol *sym;
     int rules_count = 0, symbols_count = 0;
-    DL_COUNT(grammar->rules, rule, rules_count);
 
-    DL_FOREACH(grammar->rules, rule) {
-        int count;
-        DL_COUNT(rule->rule_body, sym, count);
-        symbols_count += count;
+    GRAMMAR_FOREACH_RULE(grammar, rule) {
+        rules_count++;
 
         //#ifdef DEBUG
         fprintf(stream, "Rule %d :-> ", rule->val);
 
-        DL_FOREACH(rule->rule_body, sym) {
+        RULE_FOREACH_SYMBOL(grammar, rule, sym) {
+            symbols_count++;
             if(sym->exp > 1)
                 fprintf(stream, "%d^%d ", sym->val, sym->exp);
             else
@@ -49,7 +47,7 @@ void sequitur_print_rules(FILE* stream, Grammar *grammar) {
     /*
     printf("\n=======================\nNumber of rule: %d\n", rules_count);
     printf("Number of symbols: %d\n", symbols_count);
-    printf("Number of Digrams: %d\n=======================\n", HASH_COUNT(grammar.digram_table));
+    printf("Number of Digrams: %d\n=======================\n", grammar.digram_table.count);
     */
     fprintf(stream, "[pilgrim] Rules: %d, Symbols: %d\n", rules_count, symbols_count);
 }
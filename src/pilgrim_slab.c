@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "pilgrim_slab.h"
+#include "pilgrim_utils.h"
+
+#define SLAB_SIZE_CLASS     16      // object sizes are rounded up to a multiple of this
+
+static int use_hugepages = -1;      // read PILGRIM_HUGEPAGES once
+
+static bool hugepages_enabled() {
+    if(use_hugepages == -1) {
+        const char *env = getenv("PILGRIM_HUGEPAGES");
+        use_hugepages = (env && atoi(env)) ? 1 : 0;
+    }
+    return use_hugepages == 1;
+}
+
+/*
+ * Map a 2MB aligned region so the kernel can back it
+ * with a transparent huge page. Over-map by 2MB and
+ * trim both ends to get the alignment.
+ */
+static SlabChunk* map_huge_chunk() {
+#ifdef MADV_HUGEPAGE
+    size_t len = SLAB_HUGE_CHUNK * 2;
+    char *raw = mmap(NULL, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(raw == MAP_FAILED)
+        return NULL;
+
+    char *aligned = (char*)(((uintptr_t)raw + SLAB_HUGE_CHUNK - 1) & ~((uintptr_t)SLAB_HUGE_CHUNK - 1));
+    if(aligned > raw)
+        munmap(raw, aligned - raw);
+    if(aligned + SLAB_HUGE_CHUNK < raw + len)
+        munmap(aligned + SLAB_HUGE_CHUNK, raw + len - aligned - SLAB_HUGE_CHUNK);
+
+    madvise(aligned, SLAB_HUGE_CHUNK, MADV_HUGEPAGE);
+
+    SlabChunk *chunk = (SlabChunk*) aligned;
+    chunk->size = SLAB_HUGE_CHUNK;
+    chunk->huge = true;
+    return chunk;
+#else
+    return NULL;
+#endif
+}
+
+void slab_init(Slab *slab, size_t obj_size) {
+    if(obj_size < sizeof(void*))
+        obj_size = sizeof(void*);
+    slab->obj_size = (obj_size + SLAB_SIZE_CLASS - 1) / SLAB_SIZE_CLASS * SLAB_SIZE_CLASS;
+    slab->cursor = NULL;
+    slab->end = NULL;
+    slab->free_list = NULL;
+    slab->chunks = NULL;
+    slab->next_chunk_size = SLAB_MIN_CHUNK;
+    slab->bytes = 0;
+}
+
+void slab_grow(Slab *slab) {
+    SlabChunk *chunk = NULL;
+
+    if(slab->next_chunk_size > SLAB_MAX_CHUNK && hugepages_enabled())
+        chunk = map_huge_chunk();
+
+    if(chunk == NULL) {
+        size_t size = slab->next_chunk_size;
+        if(size > SLAB_MAX_CHUNK)
+            size = SLAB_MAX_CHUNK;
+        chunk = pilgrim_malloc(size);
+        chunk->size = size;
+        chunk->huge = false;
+    }
+
+    if(slab->next_chunk_size <= SLAB_MAX_CHUNK)
+        slab->next_chunk_size *= 2;
+
+    chunk->next = slab->chunks;
+    slab->chunks = chunk;
+    slab->bytes += chunk->size;
+
+    // Keep the objects aligned to the size class
+    size_t header = (sizeof(SlabChunk) + SLAB_SIZE_CLASS - 1) / SLAB_SIZE_CLASS * SLAB_SIZE_CLASS;
+    slab->cursor = (char*)chunk + header;
+    slab->end = (char*)chunk + chunk->size;
+}
+
+void slab_release(Slab *slab) {
+    SlabChunk *chunk = slab->chunks, *next;
+    while(chunk) {
+        next = chunk->next;
+        if(chunk->huge)
+            munmap(chunk, chunk->size);
+        else
+            pilgrim_free(chunk, chunk->size);
+        chunk = next;
+    }
+    slab_init(slab, slab->obj_size);
+}
@@ -3,6 +3,7 @@
  *     See COPYRIGHT in top-level directory
  */
 #include <math.h>
+#include <errno.h>
 #include <limits.h>
 #include "pilgrim.h"
 #include "pilgrim_timings.h"
@@ -10,8 +11,6 @@
 #include "mpi.h"
 #include "zstd.h"
 
-#define REL_ERR     (0.1)
-#define BASE        (1.0+REL_ERR)
 #define ZERO_BIN_ID (9999999)
 
 // in seconds
@@ -137,8 +136,10 @@ void dump_timings(void* buf, size_t buf_size, const char* filename) {
 
     int size = (int) buf_size;
     int offset;
-    // A prefix sum to decide the offset of my write
+    // A prefix sum to decide the offset of my write,
+    // MPI_Scan is inclusive so take my own size out
     PMPI_Scan(&size, &offset, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    offset -= size;
 
     MPI_File file;
     PMPI_File_open(MPI_COMM_WORLD, filename, MPI_MODE_WRONLY|MPI_MODE_CREATE, MPI_INFO_NULL, &file);
@@ -203,6 +204,24 @@ void handle_cfg_timing(RecordHash* entry, Record* record, int *duration_id, int*
     */
 }
 
+/*
+ * Bins of a run of calls: the mean duration of its calls, the interval
+ * before its first call, and the mean interval between its calls
+ * (spacing_id, -1 if the run has only one call).
+ */
+static void handle_cfg_run_timing(RecordHash* entry, TimingRun* run, int *duration_id, int* interval_id, int* spacing_id) {
+    Record first = {.tstart = run->tstart, .tend = run->tstart + run->duration / run->count};
+    handle_cfg_timing(entry, &first, duration_id, interval_id);
+
+    *spacing_id = -1;
+    if(run->count > 1) {
+        int spacing_i = (run->last_tstart - run->tstart) / (run->count - 1) / TIME_RESOLUTION;
+        *spacing_id = get_bin_id_int(spacing_i);
+        entry->tstart = run->last_tstart;
+        entry->ext_tstart += (double)spacing_i * (run->count - 1) * TIME_RESOLUTION;
+    }
+}
+
 
 /**
  * We can also store lossless timing
@@ -226,10 +245,10 @@ void write_to_file(char* duration_path, char* interval_path, double* durations,
     fclose(f);
 }
 
-void write_text_timings(RecordHash* cst, int mpi_rank) {
+void write_text_timings(CallSignatureTable* cst, int mpi_rank) {
     if(mpi_rank != 1) return;
 
-    RecordHash *entry, *tmp;
+    RecordHash *entry;
     TimingNode *tn;
 
     char dur_path[64] = {0};
@@ -241,7 +260,7 @@ void write_text_timings(RecordHash* cst, int mpi_rank) {
     FILE* f_raw_dur = fopen(raw_dur_path, "w");
 
     int i = 0;
-    HASH_ITER(hh, cst, entry, tmp) {
+    CST_FOREACH(cst, entry) {
         int count;
         LL_COUNT(entry->durations, tn, count);
 
@@ -350,13 +369,13 @@ void report(size_t local_dur_bytes, size_t local_int_bytes, double total_calls,
     }
 }
 
-void* write_hist_timings_core(RecordHash* cst, int mpi_rank, bool dur, size_t* compressed_bytes) {
+void* write_hist_timings_core(CallSignatureTable* cst, int mpi_rank, bool dur, size_t* compressed_bytes) {
 
-    RecordHash *entry, *tmp;
+    RecordHash *entry;
     TimingNode *elt, *tmp2;
 
     int local_total = 0;
-    HASH_ITER(hh, cst, entry, tmp) {
+    CST_FOREACH(cst, entry) {
         int count = 0;
         LL_COUNT(entry->intervals, elt, count);
         local_total += count;
@@ -371,7 +390,7 @@ void* write_hist_timings_core(RecordHash* cst, int mpi_rank, bool dur, size_t* c
 
     double mse = 0, noise = 0, max_signal = 0, psnr = 0;
 
-    HASH_ITER(hh, cst, entry, tmp) {
+    CST_FOREACH(cst, entry) {
         int count;
         LL_COUNT(entry->durations, elt, count);
 
@@ -486,7 +505,7 @@ void* write_hist_timings_core(RecordHash* cst, int mpi_rank, bool dur, size_t* c
     return zstd_buff;
 }
 
-void write_hist_timings(RecordHash* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path) {
+void write_hist_timings(CallSignatureTable* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path) {
     PMPI_Barrier(MPI_COMM_WORLD);
     double t1 = PMPI_Wtime();
 
@@ -603,6 +622,27 @@ void write_cfg_timings(Grammar* duration_grammar, Grammar* interval_grammar, int
     sequitur_cleanup(interval_grammar);
 }
 
+/**
+ * CFG_JOINT mode, only rank 0 has the merged composite terminals, see JointTable.
+ * The timings themselves are in grammars.dat.
+ */
+void write_joint_timings(int* merged, int integers, int mpi_rank, double total_calls, char* dur_path) {
+    size_t bytes = 0;
+    if(mpi_rank == 0) {
+        errno = 0;
+        FILE *f = fopen(dur_path, "wb");
+        if(f) {
+            bytes = fwrite(merged, sizeof(int), integers, f) * sizeof(int);
+            fclose(f);
+        } else {
+            printf("[pilgrim] Open file: %s failed, errno: %d\n", dur_path, errno);
+        }
+    }
+
+    // Durations and intervals share one table, charge half of it to each
+    report(bytes/2, bytes/2, total_calls, 0, 0, 0, "CFG_JOINT");
+}
+
 #ifdef WITH_SZ
 void* write_sz_timings_core(double* buf, size_t count, size_t* compressed_bytes) {
     SZ_Init(NULL);
@@ -615,19 +655,19 @@ void* write_sz_timings_core(double* buf, size_t count, size_t* compressed_bytes)
     return raw_c;
 }
 
-void write_sz_timings(RecordHash* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
+void write_sz_timings(CallSignatureTable* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
                       TimingNode *g_durations, TimingNode* g_intervals, bool clustering) {
 
     PMPI_Barrier(MPI_COMM_WORLD);
     double t1 = PMPI_Wtime();
 
-    RecordHash *entry, *tmp;
+    RecordHash *entry;
     TimingNode *elt, *tmp2;
 
     // Local function calls count
     int local_total = 0;
     if(clustering) {
-        HASH_ITER(hh, cst, entry, tmp) {
+        CST_FOREACH(cst, entry) {
             int count = 0;
             LL_COUNT(entry->intervals, elt, count);
             local_total += count;
@@ -642,7 +682,7 @@ void write_sz_timings(RecordHash* cst, int mpi_rank, double total_calls, char* d
     // Combine all timestamps to form a 1D array
     int i = 0, j = 0;
     if(clustering) {
-        HASH_ITER(hh, cst, entry, tmp) {
+        CST_FOREACH(cst, entry) {
             LL_FOREACH_SAFE(entry->durations, elt, tmp2) {
                 local_durations[i++] = elt->val;
             }
@@ -728,19 +768,19 @@ void* write_zfp_timings_core(void* in, size_t count, size_t* outsize) {
     */
 }
 
-void write_zfp_timings(RecordHash* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
+void write_zfp_timings(CallSignatureTable* cst, int mpi_rank, double total_calls, char* dur_path, char* int_path,
                        TimingNode *g_durations, TimingNode* g_intervals, bool clustering) {
     PMPI_Barrier(MPI_COMM_WORLD);
     double t1 = PMPI_Wtime();
 
     // Identical pre-process code as in SZ
-    RecordHash *entry, *tmp;
+    RecordHash *entry;
     TimingNode *elt, *tmp2;
 
     // Local function calls count
     int local_total = 0;
     if(clustering) {
-        HASH_ITER(hh, cst, entry, tmp) {
+        CST_FOREACH(cst, entry) {
             int count = 0;
             LL_COUNT(entry->intervals, elt, count);
             local_total += count;
@@ -755,7 +795,7 @@ void write_zfp_timings(RecordHash* cst, int mpi_rank, double total_calls, char*
     // Combine all timestamps to form a 1D array
     int i = 0, j = 0;
     if(clustering) {
-        HASH_ITER(hh, cst, entry, tmp) {
+        CST_FOREACH(cst, entry) {
             LL_FOREACH_SAFE(entry->durations, elt, tmp2) {
                 local_durations[i++] = elt->val;
             }
@@ -796,11 +836,11 @@ void write_zfp_timings(RecordHash* cst, int mpi_rank, double total_calls, char*
 }
 #endif
 
-void write_zstd_timings(RecordHash* cst, int mpi_rank, int mpi_size,
+void write_zstd_timings(CallSignatureTable* cst, int mpi_rank, int mpi_size,
                         char* dur_path, char* int_path,
                         TimingNode *g_durations) {
 
-    RecordHash *entry, *tmp;
+    RecordHash *entry;
     TimingNode *elt, *tmp2;
 
     int local_total = 0;
@@ -825,3 +865,379 @@ void write_zstd_timings(RecordHash* cst, int mpi_rank, int mpi_size,
     PMPI_Barrier(MPI_COMM_WORLD);
     printf("ZSTD compression ratio: %f\n", (1.0*local_total/compressed_bytes*sizeof(double)));
 }
+
+
+/*
+ * Timing recorders
+ *
+ * See TimingRecorder in pilgrim_timings.h
+ */
+
+// Timing lists are kept in reverse order (we prepend),
+// so the later list goes in front.
+TimingNode* merge_timing_list(TimingNode *earlier, TimingNode *later) {
+    LL_CONCAT(later, earlier);
+    return later;
+}
+
+static void free_timing_list(TimingNode **head) {
+    TimingNode *elt, *tmp;
+    LL_FOREACH_SAFE(*head, elt, tmp) {
+        LL_DELETE(*head, elt);
+        pilgrim_free(elt, sizeof(TimingNode));
+    }
+}
+
+static void init_timings(TimingContext *tc) {
+    tc->cfg_ts = 0;
+    tc->g_durations = NULL;
+    tc->g_intervals = NULL;
+}
+
+static void init_cfg_timings(TimingContext *tc) {
+    init_timings(tc);
+    sequitur_init(&(tc->durations_grammar));
+    sequitur_init(&(tc->intervals_grammar));
+}
+
+/*
+ * CFG_JOINT mode, see JointTable
+ */
+#define JOINT_INITIAL_SLOTS     256
+#define JOINT_INITIAL_CAPACITY  128
+
+static inline unsigned joint_home_slot(JointTable *table, uint64_t composite) {
+    uint64_t h = composite * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 32;
+    return h & (table->num_slots - 1);
+}
+
+static void joint_table_init(JointTable *table) {
+    table->count = 0;
+    table->capacity = JOINT_INITIAL_CAPACITY;
+    table->composites = pilgrim_malloc(sizeof(uint64_t) * table->capacity);
+    table->num_slots = JOINT_INITIAL_SLOTS;
+    table->slots = pilgrim_malloc(sizeof(int) * table->num_slots);
+    memset(table->slots, 0, sizeof(int) * table->num_slots);
+    table->update_composite_id = NULL;
+}
+
+static void joint_table_cleanup(JointTable *table) {
+    pilgrim_free(table->composites, sizeof(uint64_t) * table->capacity);
+    pilgrim_free(table->slots, sizeof(int) * table->num_slots);
+    if(table->update_composite_id)
+        pilgrim_free(table->update_composite_id, sizeof(int) * table->count);
+    table->composites = NULL;
+    table->slots = NULL;
+    table->update_composite_id = NULL;
+    table->count = table->capacity = 0;
+    table->num_slots = 0;
+}
+
+// Keep the load factor at most 1/2
+static void joint_table_grow(JointTable *table) {
+    if(table->count == table->capacity) {
+        uint64_t *composites = pilgrim_malloc(sizeof(uint64_t) * table->capacity * 2);
+        memcpy(composites, table->composites, sizeof(uint64_t) * table->count);
+        pilgrim_free(table->composites, sizeof(uint64_t) * table->capacity);
+        table->composites = composites;
+        table->capacity *= 2;
+    }
+
+    if((unsigned) table->count * 2 > table->num_slots) {
+        pilgrim_free(table->slots, sizeof(int) * table->num_slots);
+        table->num_slots *= 2;
+        table->slots = pilgrim_malloc(sizeof(int) * table->num_slots);
+        memset(table->slots, 0, sizeof(int) * table->num_slots);
+
+        unsigned mask = table->num_slots - 1;
+        for(int id = 0; id < table->count; id++) {
+            unsigned idx = joint_home_slot(table, table->composites[id]);
+            while(table->slots[idx])
+                idx = (idx + 1) & mask;
+            table->slots[idx] = id + 1;
+        }
+    }
+}
+
+// Return the composite terminal of (terminal, bins), add it if new
+static int joint_intern(JointTable *table, int terminal, int bins) {
+    uint64_t composite = ((uint64_t)(uint32_t)terminal << 32) | (uint32_t)bins;
+    unsigned mask = table->num_slots - 1;
+    unsigned idx = joint_home_slot(table, composite);
+    while(table->slots[idx]) {
+        int id = table->slots[idx] - 1;
+        if(table->composites[id] == composite)
+            return id;
+        idx = (idx + 1) & mask;
+    }
+
+    int id = table->count++;
+    table->composites[id] = composite;
+    table->slots[idx] = id + 1;
+    if(table->count == table->capacity || (unsigned) table->count * 2 > table->num_slots)
+        joint_table_grow(table);
+    return id;
+}
+
+static inline int joint_terminal_of(uint64_t composite) {
+    return (int)(composite >> 32);
+}
+
+static inline int joint_bins_of(uint64_t composite) {
+    return (int)(uint32_t)composite;
+}
+
+static void init_joint_timings(TimingContext *tc) {
+    init_timings(tc);
+    joint_table_init(&tc->joint);
+    tc->joint_merged = NULL;
+    tc->joint_integers = 0;
+}
+
+// One composite for the whole run, with the mean duration of its calls
+// and the interval before its first call
+static int joint_terminal(TimingContext *tc, RecordHash *entry, TimingRun *run) {
+    int bins = JOINT_UNTIMED;
+    if(run) {
+        int duration_id, interval_id, spacing_id;
+        handle_cfg_run_timing(entry, run, &duration_id, &interval_id, &spacing_id);
+        bins = (duration_id << 16) | interval_id;
+    }
+    return joint_intern(&tc->joint, entry->terminal_id, bins);
+}
+
+static int* merge_joint_terminals(TimingContext *dst, TimingContext *src, int *update_terminal_id) {
+    JointTable *table = &src->joint;
+    table->update_composite_id = pilgrim_malloc(sizeof(int) * table->count);
+    for(int id = 0; id < table->count; id++) {
+        uint64_t composite = table->composites[id];
+        table->update_composite_id[id] = joint_intern(&dst->joint,
+                update_terminal_id[joint_terminal_of(composite)], joint_bins_of(composite));
+    }
+    return table->update_composite_id;
+}
+
+/*
+ * Merge the composite terminals of all ranks on rank 0, the same way
+ * as dump_cst() does for the call signatures. Rank 0 keeps the merged
+ * table for write_joint_timings(), each rank gets its global ids back.
+ */
+static int* dump_joint_terminals(TimingContext *tc, int *update_terminal_id) {
+    JointTable *table = &tc->joint;
+    int mpi_rank, mpi_size;
+    PMPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    PMPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    // With global call terminals
+    uint64_t *composites = pilgrim_malloc(sizeof(uint64_t) * table->count);
+    for(int id = 0; id < table->count; id++) {
+        uint64_t composite = table->composites[id];
+        composites[id] = ((uint64_t)(uint32_t)update_terminal_id[joint_terminal_of(composite)] << 32) |
+                         (uint32_t)joint_bins_of(composite);
+    }
+
+    int total = 0;
+    int *counts = NULL, *displs = NULL, *merged_ids = NULL;
+    uint64_t *gathered = NULL;
+    if(mpi_rank == 0) {
+        counts = pilgrim_malloc(sizeof(int) * mpi_size);
+        displs = pilgrim_malloc(sizeof(int) * mpi_size);
+    }
+    PMPI_Gather(&table->count, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if(mpi_rank == 0) {
+        for(int i = 0; i < mpi_size; i++) {
+            displs[i] = total;
+            total += counts[i];
+        }
+        gathered = pilgrim_malloc(sizeof(uint64_t) * total);
+        merged_ids = pilgrim_malloc(sizeof(int) * total);
+    }
+    PMPI_Gatherv(composites, table->count, MPI_UINT64_T, gathered, counts, displs, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+
+    if(mpi_rank == 0) {
+        JointTable merged;
+        joint_table_init(&merged);
+        for(int i = 0; i < total; i++)
+            merged_ids[i] = joint_intern(&merged, joint_terminal_of(gathered[i]), joint_bins_of(gathered[i]));
+
+        tc->joint_integers = 1 + 2 * merged.count;
+        tc->joint_merged = pilgrim_malloc(sizeof(int) * tc->joint_integers);
+        tc->joint_merged[0] = merged.count;
+        for(int id = 0; id < merged.count; id++) {
+            tc->joint_merged[1+2*id] = joint_terminal_of(merged.composites[id]);
+            tc->joint_merged[2+2*id] = joint_bins_of(merged.composites[id]);
+        }
+        joint_table_cleanup(&merged);
+    }
+
+    table->update_composite_id = pilgrim_malloc(sizeof(int) * table->count);
+    PMPI_Scatterv(merged_ids, counts, displs, MPI_INT, table->update_composite_id, table->count, MPI_INT, 0, MPI_COMM_WORLD);
+
+    if(mpi_rank == 0) {
+        pilgrim_free(counts, sizeof(int) * mpi_size);
+        pilgrim_free(displs, sizeof(int) * mpi_size);
+        pilgrim_free(gathered, sizeof(uint64_t) * total);
+        pilgrim_free(merged_ids, sizeof(int) * total);
+    }
+    pilgrim_free(composites, sizeof(uint64_t) * table->count);
+    return table->update_composite_id;
+}
+
+static void record_aggregated_timing(TimingContext *tc, RecordHash *entry, Record *record) {
+    handle_aggregated_timing(entry, record);
+}
+
+// Keep one duration and one interval bin per call, so the timing
+// grammars still line up with the calls. Untimed calls get CFG_UNTIMED_BIN.
+static void record_cfg_timing(TimingContext *tc, RecordHash *entry, TimingRun *run, bool timed) {
+    int duration_id = CFG_UNTIMED_BIN, interval_id = CFG_UNTIMED_BIN, spacing_id = CFG_UNTIMED_BIN;
+    if(timed)
+        handle_cfg_run_timing(entry, run, &duration_id, &interval_id, &spacing_id);
+    double t1 = PMPI_Wtime();
+    append_terminal(&(tc->intervals_grammar), interval_id, 1);
+    if(run->count > 1)
+        append_terminal(&(tc->intervals_grammar), spacing_id, run->count - 1);
+    append_terminal(&(tc->durations_grammar), duration_id, run->count);
+    double t2 = PMPI_Wtime();
+    tc->cfg_ts += (t2 - t1);
+}
+
+// For lossless mode, we directly store tstart in interval
+// and tend in duration for easier postprocessing
+static void record_lossless_timing(TimingContext *tc, RecordHash *entry, Record *record) {
+    TimingNode *tstart_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    TimingNode *tend_node   = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    tstart_node->val = record->tstart;
+    tend_node->val   = record->tend;
+    LL_PREPEND(tc->g_intervals, tstart_node);
+    LL_PREPEND(tc->g_durations, tend_node);
+}
+
+// For TEXT, ZSTD, HIST, SZ and ZFP, keep all durations and intervals,
+// both per call signature and globally, one sample for each run:
+// the mean duration of its calls and the interval before its first
+// call. The count of the run is the exp of its terminal.
+static void record_timing_lists(TimingContext *tc, RecordHash *entry, TimingRun *run, bool timed) {
+    if(!timed) return;
+
+    TimingNode *dur_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    TimingNode *int_node = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    dur_node->val = run->duration / run->count;
+    int_node->val = run->tstart - entry->tstart;
+    entry->tstart = run->last_tstart;
+
+    LL_PREPEND(entry->durations, dur_node);
+    LL_PREPEND(entry->intervals, int_node);
+
+    TimingNode *dur_node2 = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    dur_node2->val = dur_node->val;
+    LL_PREPEND(tc->g_durations, dur_node2);
+    TimingNode *int_node2 = (TimingNode*) pilgrim_malloc(sizeof(TimingNode));
+    int_node2->val = int_node->val;
+    LL_PREPEND(tc->g_intervals, int_node2);
+}
+
+static void merge_cfg_timings(TimingContext *dst, TimingContext *src) {
+    sequitur_append_grammar(&(dst->durations_grammar), &(src->durations_grammar), NULL);
+    sequitur_append_grammar(&(dst->intervals_grammar), &(src->intervals_grammar), NULL);
+    sequitur_cleanup(&(src->durations_grammar));
+    sequitur_cleanup(&(src->intervals_grammar));
+    dst->cfg_ts += src->cfg_ts;
+}
+
+static void merge_timing_lists(TimingContext *dst, TimingContext *src) {
+    dst->g_durations = merge_timing_list(dst->g_durations, src->g_durations);
+    dst->g_intervals = merge_timing_list(dst->g_intervals, src->g_intervals);
+    src->g_durations = NULL;
+    src->g_intervals = NULL;
+}
+
+static void write_cfg(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_cfg_timings(&(tc->durations_grammar), &(tc->intervals_grammar), out->mpi_rank, out->total_calls,
+                      out->dur_path, out->int_path, tc->cfg_ts);
+}
+
+static void write_text(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_text_timings(cst, out->mpi_rank);
+}
+
+static void write_joint(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_joint_timings(tc->joint_merged, tc->joint_integers, out->mpi_rank, out->total_calls, out->dur_path);
+}
+
+// Again, for lossless mode, we store tstarts in g_intervals
+// and tends in g_durations
+static void write_lossless(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_lossless_timings(tc->g_intervals, tc->g_durations, out->mpi_rank, out->mpi_size,
+                           out->dur_path, out->int_path);
+}
+
+static void write_hist(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_hist_timings(cst, out->mpi_rank, out->total_calls, out->dur_path, out->int_path);
+}
+
+static void write_zstd(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_zstd_timings(cst, out->mpi_rank, out->mpi_size, out->dur_path, out->int_path, tc->g_durations);
+}
+
+#ifdef WITH_ZFP
+static void write_zfp(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_zfp_timings(cst, out->mpi_rank, out->total_calls, out->dur_path, out->int_path,
+                      tc->g_durations, tc->g_intervals, false);
+}
+#endif
+
+#ifdef WITH_SZ
+static void write_sz(TimingContext *tc, CallSignatureTable *cst, TimingOutput *out) {
+    write_sz_timings(cst, out->mpi_rank, out->total_calls, out->dur_path, out->int_path,
+                     tc->g_durations, tc->g_intervals, false);
+}
+#endif
+
+// The two grammars are already released by write_cfg_timings()
+static void finalize_timings(TimingContext *tc) {
+    free_timing_list(&(tc->g_durations));
+    free_timing_list(&(tc->g_intervals));
+}
+
+static void finalize_joint_timings(TimingContext *tc) {
+    finalize_timings(tc);
+    joint_table_cleanup(&tc->joint);
+    if(tc->joint_merged)
+        pilgrim_free(tc->joint_merged, sizeof(int) * tc->joint_integers);
+    tc->joint_merged = NULL;
+}
+
+static const TimingRecorder timing_recorders[] = {
+    { TIMING_AGGREGATED, TIMING_MODE_AGGREGATED, init_timings, record_aggregated_timing, NULL,
+      NULL, NULL, NULL, NULL, NULL, finalize_timings },
+    { TIMING_LOSSLESS, TIMING_MODE_LOSSLESS, init_timings, record_lossless_timing, NULL,
+      merge_timing_lists, NULL, NULL, NULL, write_lossless, finalize_timings },
+    { TIMING_TEXT, TIMING_MODE_TEXT, init_timings, NULL, record_timing_lists,
+      merge_timing_lists, NULL, NULL, NULL, write_text, finalize_timings },
+    { TIMING_ZSTD, TIMING_MODE_ZSTD, init_timings, NULL, record_timing_lists,
+      merge_timing_lists, NULL, NULL, NULL, write_zstd, finalize_timings },
+    { TIMING_CFG, TIMING_MODE_CFG, init_cfg_timings, NULL, record_cfg_timing,
+      merge_cfg_timings, NULL, NULL, NULL, write_cfg, finalize_timings },
+    { TIMING_HIST, TIMING_MODE_HIST, init_timings, NULL, record_timing_lists,
+      merge_timing_lists, NULL, NULL, NULL, write_hist, finalize_timings },
+    { TIMING_CFG_JOINT, TIMING_MODE_CFG_JOINT, init_joint_timings, NULL, NULL,
+      NULL, joint_terminal, merge_joint_terminals, dump_joint_terminals, write_joint, finalize_joint_timings },
+#ifdef WITH_SZ
+    { TIMING_SZ, TIMING_MODE_SZ, init_timings, NULL, record_timing_lists,
+      merge_timing_lists, NULL, NULL, NULL, write_sz, finalize_timings },
+#endif
+#ifdef WITH_ZFP
+    { TIMING_ZFP, TIMING_MODE_ZFP, init_timings, NULL, record_timing_lists,
+      merge_timing_lists, NULL, NULL, NULL, write_zfp, finalize_timings },
+#endif
+};
+
+const TimingRecorder* timing_recorder_lookup(const char *name) {
+    for(size_t i = 0; i < sizeof(timing_recorders)/sizeof(TimingRecorder); i++) {
+        if(strcmp(timing_recorders[i].name, name) == 0)
+            return &timing_recorders[i];
+    }
+    return NULL;
+}
@@ -20,15 +20,17 @@
 static size_t memory_usage = 0;
 static size_t peak_memory = 0;
 
+// Can be called by multiple threads concurrently,
+// keep the counters consistent with atomic updates.
 void* pilgrim_malloc(size_t size) {
-    memory_usage += size;
-    if(memory_usage > peak_memory)
-        peak_memory = memory_usage;
+    size_t usage = __sync_add_and_fetch(&memory_usage, size);
+    if(usage > peak_memory)
+        peak_memory = usage;
     return dlmalloc(size);
 }
 
 void pilgrim_free(void *ptr, size_t size) {
-    memory_usage -= size;
+    __sync_sub_and_fetch(&memory_usage, size);
     dlfree(ptr);
 }
 
@@ -37,59 +39,66 @@ void pilgrim_report_memory_status() {
 }
 
 
-inline double pilgrim_wtime()
-{
-    return PMPI_Wtime();
-}
-
-/* Put many arguments (char *) in a list (char**) */
-inline void** assemble_args_list(int arg_count, ...) {
-    void** args = pilgrim_malloc(sizeof(void*) * arg_count);
-
-    int i;
-    va_list valist;
-    va_start(valist, arg_count);
-    for(i = 0; i < arg_count; i++)
-        args[i] = va_arg(valist, void*);
-    va_end(valist);
-    return args;
-}
-
-void* concat_function_args(short func_id, int tid, int arg_count, void** args, int* arg_sizes, int comm_size, int* key_len) {
+static inline void ensure_capacity(void **buf, int *capacity, int used, int needed) {
+    if(used + needed <= *capacity) return;
 
-    // Compute key length first, note func_id is a short type
-    int i;
-    *key_len = (sizeof(func_id) + sizeof(tid));
-    if(comm_size != -1)
-        *key_len += sizeof(comm_size);
+    int new_capacity = *capacity > 0 ? *capacity : 256;
+    while(new_capacity < used + needed)
+        new_capacity *= 2;
 
-    for(i = 0; i < arg_count; i++)
-        *key_len += arg_sizes[i];
+    void *new_buf = pilgrim_malloc(new_capacity);
+    if(*buf) {
+        memcpy(new_buf, *buf, used);
+        pilgrim_free(*buf, *capacity);
+    }
+    *buf = new_buf;
+    *capacity = new_capacity;
+}
 
-    // Actually set the key
+/**
+ * Encode the header of a call signature: func_id and comm_size
+ * (only if it is not -1), and reserve args_len bytes for the arguments.
+ * The tid is not part of it, each thread has its own grammar instead.
+ *
+ * @return: the header length
+ */
+int encode_signature_header(short func_id, int comm_size, int args_len, void** buf, int* capacity) {
     int pos = 0;
-    void *key = pilgrim_malloc(*key_len);
-    memcpy(key+pos, &func_id, sizeof(func_id));
-    pos += sizeof(func_id);
+    ensure_capacity(buf, capacity, pos, sizeof(func_id) + sizeof(comm_size) + args_len);
 
-    memcpy(key+pos, &tid, sizeof(tid));
-    pos += sizeof(tid);
+    memcpy(*buf+pos, &func_id, sizeof(func_id));
+    pos += sizeof(func_id);
 
     if(comm_size != -1) {
-        memcpy(key+pos, &comm_size, sizeof(comm_size));
+        memcpy(*buf+pos, &comm_size, sizeof(comm_size));
         pos += sizeof(comm_size);
     }
 
-    for(i = 0; i < arg_count; i++) {
+    return pos;
+}
+
+/**
+ * Encode the call signature (func_id, comm_size, args)
+ * into a caller owned buffer in a single pass.
+ *
+ * @buf, @capacity: the buffer and its size, it will be
+ * grown (and replaced) if the signature does not fit.
+ * @return: the key length
+ */
+int concat_function_args(short func_id, int arg_count, void** args, int* arg_sizes, int comm_size, void** buf, int* capacity) {
+    int pos = encode_signature_header(func_id, comm_size, 0, buf, capacity);
+
+    for(int i = 0; i < arg_count; i++) {
+        ensure_capacity(buf, capacity, pos, arg_sizes[i]);
         if(args[i])
-            memcpy(key+pos, args[i], arg_sizes[i]);
+            memcpy(*buf+pos, args[i], arg_sizes[i]);
         else
-            memset(key+pos, 0, arg_sizes[i]);
+            memset(*buf+pos, 0, arg_sizes[i]);
 
         pos += arg_sizes[i];
     }
 
-    return key;
+    return pos;
 }
 
 int randint() {
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <string.h>
+#include "pilgrim_varint.h"
+
+// Return the number of bytes written, at most VARINT_MAX_BYTES
+size_t varint_encode(uint64_t val, unsigned char *buf) {
+    size_t n = 0;
+    while(val >= 0x80) {
+        buf[n++] = (unsigned char)(val | 0x80);
+        val >>= 7;
+    }
+    buf[n++] = (unsigned char)val;
+    return n;
+}
+
+// Return the number of bytes read, 0 if buf ends in the middle of a varint
+size_t varint_decode(const unsigned char *buf, size_t len, uint64_t *val) {
+    uint64_t v = 0;
+    for(size_t n = 0; n < len && n < VARINT_MAX_BYTES; n++) {
+        v |= (uint64_t)(buf[n] & 0x7f) << (7*n);
+        if((buf[n] & 0x80) == 0) {
+            *val = v;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Decode n varints, return the number of bytes read, 0 on error.
+ * Most values are below 128, so check 8 bytes at a time and
+ * take them as they are if none has a continuation bit.
+ */
+size_t varint_decode_bulk(const unsigned char *buf, size_t len, uint64_t *vals, size_t n) {
+    size_t pos = 0, i = 0;
+    while(i < n) {
+        if(i + 8 <= n && pos + 8 <= len) {
+            uint64_t word;
+            memcpy(&word, buf + pos, sizeof(word));
+            if((word & 0x8080808080808080ULL) == 0) {
+                for(int k = 0; k < 8; k++)
+                    vals[i+k] = buf[pos+k];
+                i += 8;
+                pos += 8;
+                continue;
+            }
+        }
+        size_t bytes = varint_decode(buf + pos, len - pos, &vals[i++]);
+        if(bytes == 0)
+            return 0;
+        pos += bytes;
+    }
+    return pos;
+}
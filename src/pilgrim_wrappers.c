@@ -11,14 +11,42 @@
 static int placeholder = 0;
 static int g_local_rank;
 MPI_Status g_c_status;
+const short query_func_ids[NUM_QUERY_FUNCS] = {
+	ID_MPI_Get_count,
+	ID_MPI_Cartdim_get,
+	ID_MPI_Comm_size,
+	ID_MPI_Query_thread,
+	ID_MPI_Comm_test_inter,
+	ID_MPI_Type_size_x,
+	ID_MPI_Comm_rank,
+	ID_MPI_Type_get_extent_x,
+	ID_MPI_Is_thread_main,
+	ID_MPI_Type_get_extent,
+	ID_MPI_Comm_remote_size,
+	ID_MPI_Initialized,
+	ID_MPI_Finalized,
+	ID_MPI_Type_size,
+	ID_MPI_Group_size,
+	ID_MPI_Group_rank,
+	ID_MPI_Get_version,
+	ID_MPI_Type_get_true_extent,
+	ID_MPI_Type_get_true_extent_x,
+	ID_MPI_Get_processor_name,
+	ID_MPI_Get_library_version,
+	ID_MPI_Topo_test,
+	ID_MPI_Graphdims_get,
+};
 int c_MPI_Type_delete_attr(MPI_Datatype datatype, int type_keyval)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_delete_attr, (datatype, type_keyval));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &type_keyval);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, type_keyval };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_delete_attr(MPI_Datatype datatype, int type_keyval) { return c_MPI_Type_delete_attr(datatype, type_keyval); }
 extern void f_mpi_type_delete_attr(MPI_Fint* datatype, int* type_keyval, MPI_Fint *ierr) {
@@ -57,9 +85,19 @@ int c_MPI_Sendrecv_replace(void *buf, int count, MPI_Datatype datatype, int dest
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(recvtag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(9, &mem_attr_0, &count, &obj_id_0, &dest_rank, &sendtag, &source_rank, &recvtag, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(9, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+		int a8[2];
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, sendtag, source_rank, recvtag, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Sendrecv_replace(void *buf, int count, MPI_Datatype datatype, int dest, int sendtag, int source, int recvtag, MPI_Comm comm, MPI_Status *status) { return c_MPI_Sendrecv_replace(buf, count, datatype, dest, sendtag, source, recvtag, comm, status); }
 extern void f_mpi_sendrecv_replace(void* buf, int* count, MPI_Fint* datatype, int* dest, int* sendtag, int* source, int* recvtag, MPI_Fint* comm, MPI_Fint* status, MPI_Fint *ierr) {
@@ -94,9 +132,16 @@ int c_MPI_Win_create(void *base, MPI_Aint size, int disp_unit, MPI_Info info, MP
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, win);
-	void **args = assemble_args_list(6, &mem_attr_0, &size, &disp_unit, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MPI_Aint a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, size, disp_unit, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_create(void *base, MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, MPI_Win *win) { return c_MPI_Win_create(base, size, disp_unit, info, comm, win); }
 extern void f_mpi_win_create(void* base, MPI_Aint size, int* disp_unit, MPI_Fint* info, MPI_Fint* comm, MPI_Fint* win, MPI_Fint *ierr) {
@@ -130,9 +175,14 @@ int c_MPI_File_write_all_begin(MPI_File fh, const void *buf, int count, MPI_Data
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_all_begin(MPI_File fh, const void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_write_all_begin(fh, buf, count, datatype); }
 extern void f_mpi_file_write_all_begin(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -158,9 +208,12 @@ extern void mpi_file_write_all_begin__(MPI_Fint* fh, const void* buf, int* count
 int c_MPI_Error_class(int errorcode, int *errorclass)
 {
 	PILGRIM_TRACING_1(int, MPI_Error_class, (errorcode, errorclass));
-	void **args = assemble_args_list(2, &errorcode, errorclass);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { errorcode, (errorclass ? *errorclass : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Error_class(int errorcode, int *errorclass) { return c_MPI_Error_class(errorcode, errorclass); }
 extern void f_mpi_error_class(int* errorcode, int* errorclass, MPI_Fint *ierr) {
@@ -183,9 +236,11 @@ int c_MPI_Free_mem(void *base)
 	PILGRIM_TRACING_1(int, MPI_Free_mem, (base));
 	MemPtrAttr mem_attr_0;
 	addr2id(base, &mem_attr_0);
-	void **args = assemble_args_list(1, &mem_attr_0);
-	int sizes[] = { sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+	} scalars = { mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Free_mem(void *base) { return c_MPI_Free_mem(base); }
 extern void f_mpi_free_mem(void* base, MPI_Fint *ierr) {
@@ -209,9 +264,12 @@ int c_MPI_Win_get_info(MPI_Win win, MPI_Info *info_used)
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, info_used);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_get_info(MPI_Win win, MPI_Info *info_used) { return c_MPI_Win_get_info(win, info_used); }
 extern void f_mpi_win_get_info(MPI_Fint* win, MPI_Fint* info_used, MPI_Fint *ierr) {
@@ -239,9 +297,12 @@ int c_MPI_Buffer_detach(void *buffer_addr, int *size)
 	PILGRIM_TRACING_1(int, MPI_Buffer_detach, (buffer_addr, size));
 	MemPtrAttr mem_attr_0;
 	addr2id(buffer_addr, &mem_attr_0);
-	void **args = assemble_args_list(2, &mem_attr_0, size);
-	int sizes[] = { sizeof(MemPtrAttr), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+	} scalars = { mem_attr_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Buffer_detach(void *buffer_addr, int *size) { return c_MPI_Buffer_detach(buffer_addr, size); }
 extern void f_mpi_buffer_detach(void* buffer_addr, int* size, MPI_Fint *ierr) {
@@ -264,9 +325,11 @@ int c_MPI_Win_flush_local_all(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_flush_local_all, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_flush_local_all(MPI_Win win) { return c_MPI_Win_flush_local_all(win); }
 extern void f_mpi_win_flush_local_all(MPI_Fint* win, MPI_Fint *ierr) {
@@ -291,9 +354,12 @@ int c_MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI
 	PILGRIM_TRACING_1(int, MPI_Comm_create_keyval, (comm_copy_attr_fn, comm_delete_attr_fn, comm_keyval, extra_state));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(4, comm_copy_attr_fn, comm_delete_attr_fn, comm_keyval, &mem_attr_0);
-	int sizes[] = { 1*sizeof(MPI_Comm_copy_attr_function), 1*sizeof(MPI_Comm_delete_attr_function), 1*sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+	} scalars = { (comm_keyval ? *comm_keyval : 0), mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state) { return c_MPI_Comm_create_keyval(comm_copy_attr_fn, comm_delete_attr_fn, comm_keyval, extra_state); }
 extern void f_mpi_comm_create_keyval(MPI_Comm_copy_attr_function* comm_copy_attr_fn, MPI_Comm_delete_attr_function* comm_delete_attr_fn, int* comm_keyval, void* extra_state, MPI_Fint *ierr) {
@@ -315,9 +381,11 @@ int c_MPI_Comm_get_parent(MPI_Comm *parent)
 {
 	PILGRIM_TRACING_1(int, MPI_Comm_get_parent, (parent));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, parent);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_get_parent(MPI_Comm *parent) { return c_MPI_Comm_get_parent(parent); }
 extern void f_mpi_comm_get_parent(MPI_Fint* parent, MPI_Fint *ierr) {
@@ -343,9 +411,14 @@ int c_MPI_T_cvar_handle_alloc(int cvar_index, void *obj_handle, MPI_T_cvar_handl
 	PILGRIM_TRACING_1(int, MPI_T_cvar_handle_alloc, (cvar_index, obj_handle, handle, count));
 	MemPtrAttr mem_attr_0;
 	addr2id(obj_handle, &mem_attr_0);
-	void **args = assemble_args_list(4, &cvar_index, &mem_attr_0, handle, count);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), 1*sizeof(MPI_T_cvar_handle), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		MPI_T_cvar_handle a2;
+		int a3;
+	} scalars = { cvar_index, mem_attr_0, (handle ? *handle : 0), (count ? *count : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_handle_alloc(int cvar_index, void *obj_handle, MPI_T_cvar_handle *handle, int *count) { return c_MPI_T_cvar_handle_alloc(cvar_index, obj_handle, handle, count); }
 int c_MPI_Comm_idup(MPI_Comm comm, MPI_Comm *newcomm, MPI_Request *request)
@@ -354,9 +427,12 @@ int c_MPI_Comm_idup(MPI_Comm comm, MPI_Comm *newcomm, MPI_Request *request)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_idup(MPI_Comm comm, MPI_Comm *newcomm, MPI_Request *request) { return c_MPI_Comm_idup(comm, newcomm, request); }
 extern void f_mpi_comm_idup(MPI_Fint* comm, MPI_Fint* newcomm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -387,9 +463,13 @@ int c_MPI_Win_set_name(MPI_Win win, const char *win_name)
 	PILGRIM_TRACING_1(int, MPI_Win_set_name, (win, win_name));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, win_name);
-	int sizes[] = { sizeof(int), strlen(win_name)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(win_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(win_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_set_name(MPI_Win win, const char *win_name) { return c_MPI_Win_set_name(win, win_name); }
 extern void f_mpi_win_set_name(MPI_Fint* win, const char* win_name, MPI_Fint *ierr) {
@@ -416,9 +496,12 @@ int c_MPI_Type_dup(MPI_Datatype oldtype, MPI_Datatype *newtype)
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_dup(MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_dup(oldtype, newtype); }
 extern void f_mpi_type_dup(MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -444,17 +527,25 @@ extern void mpi_type_dup__(MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr)
 int c_MPI_T_pvar_get_index(const char *name, int var_class, int *pvar_index)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_get_index, (name, var_class, pvar_index));
-	void **args = assemble_args_list(3, name, &var_class, pvar_index);
-	int sizes[] = { strlen(name)+1, sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { var_class, (pvar_index ? *pvar_index : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_get_index(const char *name, int var_class, int *pvar_index) { return c_MPI_T_pvar_get_index(name, var_class, pvar_index); }
 int c_MPI_Add_error_code(int errorclass, int *errorcode)
 {
 	PILGRIM_TRACING_1(int, MPI_Add_error_code, (errorclass, errorcode));
-	void **args = assemble_args_list(2, &errorclass, errorcode);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { errorclass, (errorcode ? *errorcode : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Add_error_code(int errorclass, int *errorcode) { return c_MPI_Add_error_code(errorclass, errorcode); }
 extern void f_mpi_add_error_code(int* errorclass, int* errorcode, MPI_Fint *ierr) {
@@ -478,9 +569,14 @@ int c_MPI_Type_create_resized(MPI_Datatype oldtype, MPI_Aint lb, MPI_Aint extent
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(4, &obj_id_0, &lb, &extent, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MPI_Aint), sizeof(MPI_Aint), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Aint a1;
+		MPI_Aint a2;
+		int a3;
+	} scalars = { obj_id_0, lb, extent, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_resized(MPI_Datatype oldtype, MPI_Aint lb, MPI_Aint extent, MPI_Datatype *newtype) { return c_MPI_Type_create_resized(oldtype, lb, extent, newtype); }
 extern void f_mpi_type_create_resized(MPI_Fint* oldtype, MPI_Aint lb, MPI_Aint extent, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -508,9 +604,12 @@ int c_MPI_Get_address(const void *location, MPI_Aint *address)
 	PILGRIM_TRACING_1(int, MPI_Get_address, (location, address));
 	MemPtrAttr mem_attr_0;
 	addr2id(location, &mem_attr_0);
-	void **args = assemble_args_list(2, &mem_attr_0, address);
-	int sizes[] = { sizeof(MemPtrAttr), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MPI_Aint a1;
+	} scalars = { mem_attr_0, (address ? *address : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Get_address(const void *location, MPI_Aint *address) { return c_MPI_Get_address(location, address); }
 extern void f_mpi_get_address(const void* location, MPI_Aint* address, MPI_Fint *ierr) {
@@ -541,9 +640,17 @@ int c_MPI_Iallgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iallgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request); }
 extern void f_mpi_iallgather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -572,13 +679,17 @@ extern void mpi_iallgather__(const void* sendbuf, int* sendcount, MPI_Fint* send
 }
 int c_MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count)
 {
-	PILGRIM_TRACING_1(int, MPI_Get_count, (status, datatype, count));
+	PILGRIM_QUERY_1(int, MPI_Get_count, (status, datatype, count));
 	int status_arg[2] = {0};
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, status_arg, &obj_id_0, count);
-	int sizes[] = { sizeof(int)*2, sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0[2];
+		int a1;
+		int a2;
+	} scalars = { {status_arg[0], status_arg[1]}, obj_id_0, (count ? *count : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count) { return c_MPI_Get_count(status, datatype, count); }
 extern void f_mpi_get_count(MPI_Fint* status, MPI_Fint* datatype, int* count, MPI_Fint *ierr) {
@@ -605,9 +716,11 @@ int c_MPI_Grequest_start(MPI_Grequest_query_function *query_fn, MPI_Grequest_fre
 	PILGRIM_TRACING_1(int, MPI_Grequest_start, (query_fn, free_fn, cancel_fn, extra_state, request));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(4, query_fn, free_fn, cancel_fn, &mem_attr_0);
-	int sizes[] = { 1*sizeof(MPI_Grequest_query_function), 1*sizeof(MPI_Grequest_free_function), 1*sizeof(MPI_Grequest_cancel_function), sizeof(MemPtrAttr), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+	} scalars = { mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Grequest_start(MPI_Grequest_query_function *query_fn, MPI_Grequest_free_function *free_fn, MPI_Grequest_cancel_function *cancel_fn, void *extra_state, MPI_Request *request) { return c_MPI_Grequest_start(query_fn, free_fn, cancel_fn, extra_state, request); }
 extern void f_mpi_grequest_start(MPI_Grequest_query_function* query_fn, MPI_Grequest_free_function* free_fn, MPI_Grequest_cancel_function* cancel_fn, void* extra_state, MPI_Fint* request, MPI_Fint *ierr) {
@@ -630,12 +743,15 @@ extern void mpi_grequest_start__(MPI_Grequest_query_function* query_fn, MPI_Greq
 }
 int c_MPI_Cartdim_get(MPI_Comm comm, int *ndims)
 {
-	PILGRIM_TRACING_1(int, MPI_Cartdim_get, (comm, ndims));
+	PILGRIM_QUERY_1(int, MPI_Cartdim_get, (comm, ndims));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, ndims);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (ndims ? *ndims : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Cartdim_get(MPI_Comm comm, int *ndims) { return c_MPI_Cartdim_get(comm, ndims); }
 extern void f_mpi_cartdim_get(MPI_Fint* comm, int* ndims, MPI_Fint *ierr) {
@@ -668,9 +784,17 @@ int c_MPI_Allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, v
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm); }
 extern void f_mpi_allgather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -699,9 +823,15 @@ int c_MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int coords[])
 	PILGRIM_TRACING_1(int, MPI_Cart_coords, (comm, rank, maxdims, coords));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(4, &obj_id_0, &rank, &maxdims, coords);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), maxdims*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, rank, maxdims };
+	int tail_size_0 = maxdims*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(coords, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int coords[]) { return c_MPI_Cart_coords(comm, rank, maxdims, coords); }
 extern void f_mpi_cart_coords(MPI_Fint* comm, int* rank, int* maxdims, int coords[], MPI_Fint *ierr) {
@@ -723,6 +853,11 @@ extern void mpi_cart_coords__(MPI_Fint* comm, int* rank, int* maxdims, int coord
 }
 int c_MPI_Comm_split_type(MPI_Comm comm, int split_type, int key, MPI_Info info, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_split_type)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_split_type, (comm, split_type, key, info, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_split_type, (comm, split_type, key, info, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
@@ -730,9 +865,15 @@ int c_MPI_Comm_split_type(MPI_Comm comm, int split_type, int key, MPI_Info info,
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(5, &obj_id_0, &split_type, &key, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { obj_id_0, split_type, key, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key, MPI_Info info, MPI_Comm *newcomm) { return c_MPI_Comm_split_type(comm, split_type, key, info, newcomm); }
 extern void f_mpi_comm_split_type(MPI_Fint* comm, int* split_type, int* key, MPI_Fint* info, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -771,9 +912,16 @@ int c_MPI_Rsend(const void *buf, int count, MPI_Datatype datatype, int dest, int
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Rsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) { return c_MPI_Rsend(buf, count, datatype, dest, tag, comm); }
 extern void f_mpi_rsend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -800,9 +948,12 @@ int c_MPI_File_get_amode(MPI_File fh, int *amode)
 	PILGRIM_TRACING_1(int, MPI_File_get_amode, (fh, amode));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, amode);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (amode ? *amode : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_amode(MPI_File fh, int *amode) { return c_MPI_File_get_amode(fh, amode); }
 extern void f_mpi_file_get_amode(MPI_Fint* fh, int* amode, MPI_Fint *ierr) {
@@ -837,9 +988,20 @@ int c_MPI_Neighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype s
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Neighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Neighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm); }
 extern void f_mpi_neighbor_allgatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -869,9 +1031,11 @@ int c_MPI_Info_create(MPI_Info *info)
 {
 	PILGRIM_TRACING_1(int, MPI_Info_create, (info));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, info);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_create(MPI_Info *info) { return c_MPI_Info_create(info); }
 extern void f_mpi_info_create(MPI_Fint* info, MPI_Fint *ierr) {
@@ -896,9 +1060,13 @@ int c_MPI_Type_create_f90_complex(int p, int r, MPI_Datatype *newtype)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_create_f90_complex, (p, r, newtype));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(3, &p, &r, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { p, r, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_f90_complex(int p, int r, MPI_Datatype *newtype) { return c_MPI_Type_create_f90_complex(p, r, newtype); }
 extern void f_mpi_type_create_f90_complex(int* p, int* r, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -925,9 +1093,13 @@ int c_MPI_Status_set_elements_x(MPI_Status *status, MPI_Datatype datatype, MPI_C
 	int status_arg[2] = {0};
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, status_arg, &obj_id_0, &count);
-	int sizes[] = { sizeof(int)*2, sizeof(int), sizeof(MPI_Count) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0[2];
+		int a1;
+		MPI_Count a2;
+	} scalars = { {status_arg[0], status_arg[1]}, obj_id_0, count };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Status_set_elements_x(MPI_Status *status, MPI_Datatype datatype, MPI_Count count) { return c_MPI_Status_set_elements_x(status, datatype, count); }
 extern void f_mpi_status_set_elements_x(MPI_Fint* status, MPI_Fint* datatype, MPI_Count count, MPI_Fint *ierr) {
@@ -955,9 +1127,13 @@ int c_MPI_Comm_set_name(MPI_Comm comm, const char *comm_name)
 	PILGRIM_TRACING_1(int, MPI_Comm_set_name, (comm, comm_name));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, comm_name);
-	int sizes[] = { sizeof(int), strlen(comm_name)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(comm_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(comm_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_set_name(MPI_Comm comm, const char *comm_name) { return c_MPI_Comm_set_name(comm, comm_name); }
 extern void f_mpi_comm_set_name(MPI_Fint* comm, const char* comm_name, MPI_Fint *ierr) {
@@ -984,9 +1160,12 @@ int c_MPI_Comm_remote_group(MPI_Comm comm, MPI_Group *group)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, group);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_remote_group(MPI_Comm comm, MPI_Group *group) { return c_MPI_Comm_remote_group(comm, group); }
 extern void f_mpi_comm_remote_group(MPI_Fint* comm, MPI_Fint* group, MPI_Fint *ierr) {
@@ -1014,9 +1193,15 @@ int c_MPI_Cart_shift(MPI_Comm comm, int direction, int disp, int *rank_source, i
 	PILGRIM_TRACING_1(int, MPI_Cart_shift, (comm, direction, disp, rank_source, rank_dest));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, &direction, &disp, rank_source, rank_dest);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { obj_id_0, direction, disp, (rank_source ? *rank_source : 0), (rank_dest ? *rank_dest : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_shift(MPI_Comm comm, int direction, int disp, int *rank_source, int *rank_dest) { return c_MPI_Cart_shift(comm, direction, disp, rank_source, rank_dest); }
 extern void f_mpi_cart_shift(MPI_Fint* comm, int* direction, int* disp, int* rank_source, int* rank_dest, MPI_Fint *ierr) {
@@ -1038,12 +1223,15 @@ extern void mpi_cart_shift__(MPI_Fint* comm, int* direction, int* disp, int* ran
 }
 int c_MPI_Comm_size(MPI_Comm comm, int *size)
 {
-	PILGRIM_TRACING_1(int, MPI_Comm_size, (comm, size));
+	PILGRIM_QUERY_1(int, MPI_Comm_size, (comm, size));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Comm_size(MPI_Comm comm, int *size) { return c_MPI_Comm_size(comm, size); }
 extern void f_mpi_comm_size(MPI_Fint* comm, int* size, MPI_Fint *ierr) {
@@ -1066,9 +1254,11 @@ extern void mpi_comm_size__(MPI_Fint* comm, int* size, MPI_Fint *ierr) {
 int c_MPI_T_pvar_get_num(int *num_pvar)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_get_num, (num_pvar));
-	void **args = assemble_args_list(1, num_pvar);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (num_pvar ? *num_pvar : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_get_num(int *num_pvar) { return c_MPI_T_pvar_get_num(num_pvar); }
 int c_MPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status)
@@ -1079,9 +1269,13 @@ int c_MPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status)
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status) { return c_MPI_File_read_all_end(fh, buf, status); }
 extern void f_mpi_file_read_all_end(MPI_Fint* fh, void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -1119,9 +1313,16 @@ int c_MPI_Irsend(const void *buf, int count, MPI_Datatype datatype, int dest, in
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Irsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Irsend(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_irsend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -1153,9 +1354,13 @@ int c_MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int *result)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MPI_Comm obj_1 = comm2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, result);
-	int sizes[] = { sizeof(int), sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, (result ? *result : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int *result) { return c_MPI_Comm_compare(comm1, comm2, result); }
 extern void f_mpi_comm_compare(MPI_Fint* comm1, MPI_Fint* comm2, int* result, MPI_Fint *ierr) {
@@ -1190,9 +1395,17 @@ int c_MPI_Ineighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype se
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ineighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ineighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request); }
 extern void f_mpi_ineighbor_alltoall(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -1221,10 +1434,12 @@ extern void mpi_ineighbor_alltoall__(const void* sendbuf, int* sendcount, MPI_Fi
 }
 int c_MPI_Query_thread(int *provided)
 {
-	PILGRIM_TRACING_1(int, MPI_Query_thread, (provided));
-	void **args = assemble_args_list(1, provided);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Query_thread, (provided));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (provided ? *provided : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Query_thread(int *provided) { return c_MPI_Query_thread(provided); }
 extern void f_mpi_query_thread(int* provided, MPI_Fint *ierr) {
@@ -1245,9 +1460,13 @@ extern void mpi_query_thread__(int* provided, MPI_Fint *ierr) {
 int c_MPI_T_cvar_get_index(const char *name, int *cvar_index)
 {
 	PILGRIM_TRACING_1(int, MPI_T_cvar_get_index, (name, cvar_index));
-	void **args = assemble_args_list(2, name, cvar_index);
-	int sizes[] = { strlen(name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (cvar_index ? *cvar_index : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_get_index(const char *name, int *cvar_index) { return c_MPI_T_cvar_get_index(name, cvar_index); }
 int c_MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm)
@@ -1265,9 +1484,20 @@ int c_MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm); }
 extern void f_mpi_allgatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -1306,9 +1536,17 @@ int c_MPI_Neighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype se
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Neighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Neighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm); }
 extern void f_mpi_neighbor_allgather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -1335,17 +1573,24 @@ extern void mpi_neighbor_allgather__(const void* sendbuf, int* sendcount, MPI_Fi
 int c_MPI_T_category_get_pvars(int cat_index, int len, int indices[])
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_pvars, (cat_index, len, indices));
-	void **args = assemble_args_list(3, &cat_index, &len, indices);
-	int sizes[] = { sizeof(int), sizeof(int), len*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { cat_index, len };
+	int tail_size_0 = len*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(indices, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_pvars(int cat_index, int len, int indices[]) { return c_MPI_T_category_get_pvars(cat_index, len, indices); }
 int c_MPI_Comm_free_keyval(int *comm_keyval)
 {
 	PILGRIM_TRACING_1(int, MPI_Comm_free_keyval, (comm_keyval));
-	void **args = assemble_args_list(1, comm_keyval);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (comm_keyval ? *comm_keyval : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_free_keyval(int *comm_keyval) { return c_MPI_Comm_free_keyval(comm_keyval); }
 extern void f_mpi_comm_free_keyval(int* comm_keyval, MPI_Fint *ierr) {
@@ -1367,9 +1612,12 @@ int c_MPI_Op_create(MPI_User_function *user_fn, int commute, MPI_Op *op)
 {
 	PILGRIM_TRACING_1(int, MPI_Op_create, (user_fn, commute, op));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Op, op);
-	void **args = assemble_args_list(3, user_fn, &commute, &obj_id_0);
-	int sizes[] = { 1*sizeof(MPI_User_function), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { commute, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Op_create(MPI_User_function *user_fn, int commute, MPI_Op *op) { return c_MPI_Op_create(user_fn, commute, op); }
 extern void f_mpi_op_create(MPI_User_function* user_fn, int* commute, MPI_Fint* op, MPI_Fint *ierr) {
@@ -1393,9 +1641,15 @@ extern void mpi_op_create__(MPI_User_function* user_fn, int* commute, MPI_Fint*
 int c_MPI_T_enum_get_info(MPI_T_enum enumtype, int *num, char *name, int *name_len)
 {
 	PILGRIM_TRACING_1(int, MPI_T_enum_get_info, (enumtype, num, name, name_len));
-	void **args = assemble_args_list(4, &enumtype, num, name, name_len);
-	int sizes[] = { sizeof(MPI_T_enum), 1*sizeof(int), strlen(name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_enum a0;
+		int a1;
+		int a2;
+	} scalars = { enumtype, (num ? *num : 0), (name_len ? *name_len : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_enum_get_info(MPI_T_enum enumtype, int *num, char *name, int *name_len) { return c_MPI_T_enum_get_info(enumtype, num, name, name_len); }
 int c_MPI_Ssend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
@@ -1412,9 +1666,16 @@ int c_MPI_Ssend_init(const void *buf, int count, MPI_Datatype datatype, int dest
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ssend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ssend_init(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_ssend_init(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -1453,9 +1714,16 @@ int c_MPI_Rsend_init(const void *buf, int count, MPI_Datatype datatype, int dest
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Rsend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Rsend_init(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_rsend_init(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -1495,9 +1763,21 @@ int c_MPI_Igatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, vo
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, root, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Igatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Igatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, request); }
 extern void f_mpi_igatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -1528,17 +1808,28 @@ extern void mpi_igatherv__(const void* sendbuf, int* sendcount, MPI_Fint* sendty
 }
 int c_MPI_Mrecv(void *buf, int count, MPI_Datatype datatype, MPI_Message *message, MPI_Status *status)
 {
+	if(logger_paused(ID_MPI_Mrecv)) {
+		MPI_OBJ_RELEASE(MPI_Message, message);
+		PILGRIM_PMPI_CALL(int, MPI_Mrecv, (buf, count, datatype, message, status));
+		return res;
+	}
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Message, message);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &mem_attr_0, &count, &obj_id_0, &obj_id_1, status_arg);
 	MPI_OBJ_RELEASE(MPI_Message, message);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { mem_attr_0, count, obj_id_0, obj_id_1, {status_arg[0], status_arg[1]} };
 	PILGRIM_TRACING_1(int, MPI_Mrecv, (buf, count, datatype, message, status));
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Mrecv(void *buf, int count, MPI_Datatype datatype, MPI_Message *message, MPI_Status *status) { return c_MPI_Mrecv(buf, count, datatype, message, status); }
 extern void f_mpi_mrecv(void* buf, int* count, MPI_Fint* datatype, MPI_Fint* message, MPI_Fint* status, MPI_Fint *ierr) {
@@ -1570,9 +1861,15 @@ int c_MPI_Group_excl(MPI_Group group, int n, const int ranks[], MPI_Group *newgr
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(4, &obj_id_0, &n, ranks, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), n*sizeof(const int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, n, obj_id_1 };
+	int tail_size_0 = n*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(ranks, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_excl(MPI_Group group, int n, const int ranks[], MPI_Group *newgroup) { return c_MPI_Group_excl(group, n, ranks, newgroup); }
 extern void f_mpi_group_excl(MPI_Fint* group, int* n, const int ranks[], MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -1597,12 +1894,15 @@ extern void mpi_group_excl__(MPI_Fint* group, int* n, const int ranks[], MPI_Fin
 }
 int c_MPI_Comm_test_inter(MPI_Comm comm, int *flag)
 {
-	PILGRIM_TRACING_1(int, MPI_Comm_test_inter, (comm, flag));
+	PILGRIM_QUERY_1(int, MPI_Comm_test_inter, (comm, flag));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, flag);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Comm_test_inter(MPI_Comm comm, int *flag) { return c_MPI_Comm_test_inter(comm, flag); }
 extern void f_mpi_comm_test_inter(MPI_Fint* comm, int* flag, MPI_Fint *ierr) {
@@ -1631,9 +1931,14 @@ int c_MPI_File_read_all_begin(MPI_File fh, void *buf, int count, MPI_Datatype da
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_all_begin(MPI_File fh, void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_read_all_begin(fh, buf, count, datatype); }
 extern void f_mpi_file_read_all_begin(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -1663,9 +1968,13 @@ int c_MPI_Win_attach(MPI_Win win, void *base, MPI_Aint size)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(base, &mem_attr_0);
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, &size);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		MPI_Aint a2;
+	} scalars = { obj_id_0, mem_attr_0, size };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_attach(MPI_Win win, void *base, MPI_Aint size) { return c_MPI_Win_attach(win, base, size); }
 extern void f_mpi_win_attach(MPI_Fint* win, void* base, MPI_Aint size, MPI_Fint *ierr) {
@@ -1696,9 +2005,15 @@ int c_MPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count,
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read_at_all(fh, offset, buf, count, datatype, status); }
 extern void f_mpi_file_read_at_all(MPI_Fint* fh, MPI_Offset offset, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -1731,9 +2046,13 @@ int c_MPI_File_read_ordered_end(MPI_File fh, void *buf, MPI_Status *status)
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_ordered_end(MPI_File fh, void *buf, MPI_Status *status) { return c_MPI_File_read_ordered_end(fh, buf, status); }
 extern void f_mpi_file_read_ordered_end(MPI_Fint* fh, void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -1764,9 +2083,13 @@ int c_MPI_Type_set_attr(MPI_Datatype datatype, int type_keyval, void *attribute_
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(3, &obj_id_0, &type_keyval, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+	} scalars = { obj_id_0, type_keyval, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_set_attr(MPI_Datatype datatype, int type_keyval, void *attribute_val) { return c_MPI_Type_set_attr(datatype, type_keyval, attribute_val); }
 extern void f_mpi_type_set_attr(MPI_Fint* datatype, int* type_keyval, void* attribute_val, MPI_Fint *ierr) {
@@ -1795,9 +2118,13 @@ int c_MPI_Group_union(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup)
 	MPI_Group obj_1 = group2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_union(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup) { return c_MPI_Group_union(group1, group2, newgroup); }
 extern void f_mpi_group_union(MPI_Fint* group1, MPI_Fint* group2, MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -1829,9 +2156,20 @@ int c_MPI_Type_get_contents(MPI_Datatype datatype, int max_integers, int max_add
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1[max_datatypes];
 	for(int i=0; i<max_datatypes; i++) obj_id_1[i] = (array_of_datatypes==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &array_of_datatypes[i]);
-	void **args = assemble_args_list(7, &obj_id_0, &max_integers, &max_addresses, &max_datatypes, array_of_integers, array_of_addresses, obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int), max_integers*sizeof(int), max_addresses*sizeof(MPI_Aint), max_datatypes*sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, max_integers, max_addresses, max_datatypes };
+	int tail_size_0 = max_integers*sizeof(int);
+	int tail_size_1 = max_addresses*sizeof(MPI_Aint);
+	int tail_size_2 = max_datatypes*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, -1);
+	PILGRIM_ENCODE_TAIL(array_of_integers, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_addresses, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_1, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_get_contents(MPI_Datatype datatype, int max_integers, int max_addresses, int max_datatypes, int array_of_integers[], MPI_Aint array_of_addresses[], MPI_Datatype array_of_datatypes[]) { return c_MPI_Type_get_contents(datatype, max_integers, max_addresses, max_datatypes, array_of_integers, array_of_addresses, array_of_datatypes); }
 extern void f_mpi_type_get_contents(MPI_Fint* datatype, int* max_integers, int* max_addresses, int* max_datatypes, int array_of_integers[], MPI_Aint array_of_addresses[], MPI_Fint* array_of_datatypes, MPI_Fint *ierr) {
@@ -1859,9 +2197,14 @@ int c_MPI_Win_lock(int lock_type, int rank, int assert, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_lock, (lock_type, rank, assert, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(4, &lock_type, &rank, &assert, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { lock_type, rank, assert, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_lock(int lock_type, int rank, int assert, MPI_Win win) { return c_MPI_Win_lock(lock_type, rank, assert, win); }
 extern void f_mpi_win_lock(int* lock_type, int* rank, int* assert, MPI_Fint* win, MPI_Fint *ierr) {
@@ -1883,12 +2226,15 @@ extern void mpi_win_lock__(int* lock_type, int* rank, int* assert, MPI_Fint* win
 }
 int c_MPI_Type_size_x(MPI_Datatype datatype, MPI_Count *size)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_size_x, (datatype, size));
+	PILGRIM_QUERY_1(int, MPI_Type_size_x, (datatype, size));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Count) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Count a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_size_x(MPI_Datatype datatype, MPI_Count *size) { return c_MPI_Type_size_x(datatype, size); }
 extern void f_mpi_type_size_x(MPI_Fint* datatype, MPI_Count* size, MPI_Fint *ierr) {
@@ -1911,9 +2257,11 @@ extern void mpi_type_size_x__(MPI_Fint* datatype, MPI_Count* size, MPI_Fint *ier
 int c_MPI_T_category_changed(int *stamp)
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_changed, (stamp));
-	void **args = assemble_args_list(1, stamp);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (stamp ? *stamp : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_changed(int *stamp) { return c_MPI_T_category_changed(stamp); }
 int c_MPI_Comm_set_info(MPI_Comm comm, MPI_Info info)
@@ -1923,9 +2271,12 @@ int c_MPI_Comm_set_info(MPI_Comm comm, MPI_Info info)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_set_info(MPI_Comm comm, MPI_Info info) { return c_MPI_Comm_set_info(comm, info); }
 extern void f_mpi_comm_set_info(MPI_Fint* comm, MPI_Fint* info, MPI_Fint *ierr) {
@@ -1951,9 +2302,12 @@ extern void mpi_comm_set_info__(MPI_Fint* comm, MPI_Fint* info, MPI_Fint *ierr)
 int c_MPI_T_pvar_stop(MPI_T_pvar_session session, MPI_T_pvar_handle handle)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_stop, (session, handle));
-	void **args = assemble_args_list(2, &session, &handle);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+	} scalars = { session, handle };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_stop(MPI_T_pvar_session session, MPI_T_pvar_handle handle) { return c_MPI_T_pvar_stop(session, handle); }
 int c_MPI_Type_get_envelope(MPI_Datatype datatype, int *num_integers, int *num_addresses, int *num_datatypes, int *combiner)
@@ -1961,9 +2315,15 @@ int c_MPI_Type_get_envelope(MPI_Datatype datatype, int *num_integers, int *num_a
 	PILGRIM_TRACING_1(int, MPI_Type_get_envelope, (datatype, num_integers, num_addresses, num_datatypes, combiner));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, num_integers, num_addresses, num_datatypes, combiner);
-	int sizes[] = { sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { obj_id_0, (num_integers ? *num_integers : 0), (num_addresses ? *num_addresses : 0), (num_datatypes ? *num_datatypes : 0), (combiner ? *combiner : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_get_envelope(MPI_Datatype datatype, int *num_integers, int *num_addresses, int *num_datatypes, int *combiner) { return c_MPI_Type_get_envelope(datatype, num_integers, num_addresses, num_datatypes, combiner); }
 extern void f_mpi_type_get_envelope(MPI_Fint* datatype, int* num_integers, int* num_addresses, int* num_datatypes, int* combiner, MPI_Fint *ierr) {
@@ -1997,9 +2357,16 @@ int c_MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) { return c_MPI_Send(buf, count, datatype, dest, tag, comm); }
 extern void f_mpi_send(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -2026,9 +2393,12 @@ int c_MPI_Win_delete_attr(MPI_Win win, int win_keyval)
 	PILGRIM_TRACING_1(int, MPI_Win_delete_attr, (win, win_keyval));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &win_keyval);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, win_keyval };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_delete_attr(MPI_Win win, int win_keyval) { return c_MPI_Win_delete_attr(win, win_keyval); }
 extern void f_mpi_win_delete_attr(MPI_Fint* win, int* win_keyval, MPI_Fint *ierr) {
@@ -2055,9 +2425,16 @@ int c_MPI_Type_create_hindexed_block(int count, int blocklength, const MPI_Aint
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, &blocklength, array_of_displacements, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), count*sizeof(const MPI_Aint), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { count, blocklength, obj_id_0, obj_id_1 };
+	int tail_size_0 = count*sizeof(const MPI_Aint);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(array_of_displacements, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_hindexed_block(int count, int blocklength, const MPI_Aint array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_hindexed_block(count, blocklength, array_of_displacements, oldtype, newtype); }
 extern void f_mpi_type_create_hindexed_block(int* count, int* blocklength, const MPI_Aint array_of_displacements[], MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -2083,9 +2460,11 @@ extern void mpi_type_create_hindexed_block__(int* count, int* blocklength, const
 int c_MPI_Keyval_free(int *keyval)
 {
 	PILGRIM_TRACING_1(int, MPI_Keyval_free, (keyval));
-	void **args = assemble_args_list(1, keyval);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (keyval ? *keyval : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Keyval_free(int *keyval) { return c_MPI_Keyval_free(keyval); }
 extern void f_mpi_keyval_free(int* keyval, MPI_Fint *ierr) {
@@ -2110,9 +2489,13 @@ int c_MPI_Alloc_mem(MPI_Aint size, MPI_Info info, void *baseptr)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(baseptr, &mem_attr_0);
-	void **args = assemble_args_list(3, &size, &obj_id_0, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_Aint), sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_Aint a0;
+		int a1;
+		MemPtrAttr a2;
+	} scalars = { size, obj_id_0, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Alloc_mem(MPI_Aint size, MPI_Info info, void *baseptr) { return c_MPI_Alloc_mem(size, info, baseptr); }
 extern void f_mpi_alloc_mem(MPI_Aint size, MPI_Fint* info, void* baseptr, MPI_Fint *ierr) {
@@ -2137,9 +2520,12 @@ int c_MPI_File_get_atomicity(MPI_File fh, int *flag)
 	PILGRIM_TRACING_1(int, MPI_File_get_atomicity, (fh, flag));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, flag);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_atomicity(MPI_File fh, int *flag) { return c_MPI_File_get_atomicity(fh, flag); }
 extern void f_mpi_file_get_atomicity(MPI_Fint* fh, int* flag, MPI_Fint *ierr) {
@@ -2161,6 +2547,11 @@ extern void mpi_file_get_atomicity__(MPI_Fint* fh, int* flag, MPI_Fint *ierr) {
 }
 int c_MPI_Dist_graph_create(MPI_Comm comm_old, int n, const int sources[], const int degrees[], const int destinations[], const int weights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph)
 {
+	if(logger_paused(ID_MPI_Dist_graph_create)) {
+		PILGRIM_PMPI_CALL(int, MPI_Dist_graph_create, (comm_old, n, sources, degrees, destinations, weights, info, reorder, comm_dist_graph));
+		generate_intracomm_id(comm_dist_graph);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Dist_graph_create, (comm_old, n, sources, degrees, destinations, weights, info, reorder, comm_dist_graph));
 	generate_intracomm_id(comm_dist_graph);
 	MPI_Comm obj_0 = comm_old;
@@ -2168,9 +2559,21 @@ int c_MPI_Dist_graph_create(MPI_Comm comm_old, int n, const int sources[], const
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, comm_dist_graph);
-	void **args = assemble_args_list(9, &obj_id_0, &n, sources, degrees, destinations, weights, &obj_id_1, &reorder, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), n*sizeof(const int), n*sizeof(const int), 1*sizeof(const int), 1*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { obj_id_0, n, (destinations ? *destinations : 0), (weights ? *weights : 0), obj_id_1, reorder, obj_id_2 };
+	int tail_size_0 = n*sizeof(const int);
+	int tail_size_1 = n*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(sources, tail_size_0);
+	PILGRIM_ENCODE_TAIL(degrees, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Dist_graph_create(MPI_Comm comm_old, int n, const int sources[], const int degrees[], const int destinations[], const int weights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph) { return c_MPI_Dist_graph_create(comm_old, n, sources, degrees, destinations, weights, info, reorder, comm_dist_graph); }
 extern void f_mpi_dist_graph_create(MPI_Fint* comm_old, int* n, const int sources[], const int degrees[], const int destinations[], const int weights[], MPI_Fint* info, int* reorder, MPI_Fint* comm_dist_graph, MPI_Fint *ierr) {
@@ -2206,9 +2609,15 @@ int c_MPI_File_write_at(MPI_File fh, MPI_Offset offset, const void *buf, int cou
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_at(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write_at(fh, offset, buf, count, datatype, status); }
 extern void f_mpi_file_write_at(MPI_Fint* fh, MPI_Offset offset, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -2236,12 +2645,19 @@ extern void mpi_file_write_at__(MPI_Fint* fh, MPI_Offset offset, const void* buf
 }
 int c_MPI_File_close(MPI_File *fh)
 {
+	if(logger_paused(ID_MPI_File_close)) {
+		MPI_OBJ_RELEASE(MPI_File, fh);
+		PILGRIM_PMPI_CALL(int, MPI_File_close, (fh));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, fh);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_File, fh);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_File_close, (fh));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_close(MPI_File *fh) { return c_MPI_File_close(fh); }
 extern void f_mpi_file_close(MPI_Fint* fh, MPI_Fint *ierr) {
@@ -2267,9 +2683,12 @@ int c_MPI_Comm_call_errhandler(MPI_Comm comm, int errorcode)
 	PILGRIM_TRACING_1(int, MPI_Comm_call_errhandler, (comm, errorcode));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &errorcode);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, errorcode };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_call_errhandler(MPI_Comm comm, int errorcode) { return c_MPI_Comm_call_errhandler(comm, errorcode); }
 extern void f_mpi_comm_call_errhandler(MPI_Fint* comm, int* errorcode, MPI_Fint *ierr) {
@@ -2294,9 +2713,12 @@ int c_MPI_Win_flush_local(int rank, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_flush_local, (rank, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &rank, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { rank, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_flush_local(int rank, MPI_Win win) { return c_MPI_Win_flush_local(rank, win); }
 extern void f_mpi_win_flush_local(int* rank, MPI_Fint* win, MPI_Fint *ierr) {
@@ -2320,9 +2742,11 @@ int c_MPI_File_create_errhandler(MPI_File_errhandler_function *file_errhandler_f
 {
 	PILGRIM_TRACING_1(int, MPI_File_create_errhandler, (file_errhandler_fn, errhandler));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, file_errhandler_fn, &obj_id_0);
-	int sizes[] = { 1*sizeof(MPI_File_errhandler_function), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_create_errhandler(MPI_File_errhandler_function *file_errhandler_fn, MPI_Errhandler *errhandler) { return c_MPI_File_create_errhandler(file_errhandler_fn, errhandler); }
 extern void f_mpi_file_create_errhandler(MPI_File_errhandler_function* file_errhandler_fn, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -2345,12 +2769,19 @@ extern void mpi_file_create_errhandler__(MPI_File_errhandler_function* file_errh
 }
 int c_MPI_Group_free(MPI_Group *group)
 {
+	if(logger_paused(ID_MPI_Group_free)) {
+		MPI_OBJ_RELEASE(MPI_Group, group);
+		PILGRIM_PMPI_CALL(int, MPI_Group_free, (group));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, group);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Group, group);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Group_free, (group));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_free(MPI_Group *group) { return c_MPI_Group_free(group); }
 extern void f_mpi_group_free(MPI_Fint* group, MPI_Fint *ierr) {
@@ -2384,9 +2815,17 @@ int c_MPI_Ialltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, v
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ialltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ialltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request); }
 extern void f_mpi_ialltoall(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -2415,12 +2854,15 @@ extern void mpi_ialltoall__(const void* sendbuf, int* sendcount, MPI_Fint* sendt
 }
 int c_MPI_Comm_rank(MPI_Comm comm, int *rank)
 {
-	PILGRIM_TRACING_1(int, MPI_Comm_rank, (comm, rank));
+	PILGRIM_QUERY_1(int, MPI_Comm_rank, (comm, rank));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &placeholder);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, placeholder };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Comm_rank(MPI_Comm comm, int *rank) { return c_MPI_Comm_rank(comm, rank); }
 extern void f_mpi_comm_rank(MPI_Fint* comm, int* rank, MPI_Fint *ierr) {
@@ -2443,9 +2885,9 @@ extern void mpi_comm_rank__(MPI_Fint* comm, int* rank, MPI_Fint *ierr) {
 int c_MPI_Cancel(MPI_Request *request)
 {
 	PILGRIM_TRACING_1(int, MPI_Cancel, (request));
-	void **args = NULL;
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(0, sizes, args, -1);
+	char scalars[0];
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cancel(MPI_Request *request) { return c_MPI_Cancel(request); }
 extern void f_mpi_cancel(MPI_Fint* request, MPI_Fint *ierr) {
@@ -2472,9 +2914,13 @@ int c_MPI_Win_post(MPI_Group group, int assert, MPI_Win win)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	MPI_Win obj_1 = win;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Win, &obj_1);
-	void **args = assemble_args_list(3, &obj_id_0, &assert, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, assert, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_post(MPI_Group group, int assert, MPI_Win win) { return c_MPI_Win_post(group, assert, win); }
 extern void f_mpi_win_post(MPI_Fint* group, int* assert, MPI_Fint* win, MPI_Fint *ierr) {
@@ -2500,9 +2946,11 @@ int c_MPI_Type_commit(MPI_Datatype *datatype)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_commit, (datatype));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, datatype);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_commit(MPI_Datatype *datatype) { return c_MPI_Type_commit(datatype); }
 extern void f_mpi_type_commit(MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -2532,9 +2980,14 @@ int c_MPI_File_iwrite_shared(MPI_File fh, const void *buf, int count, MPI_Dataty
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iwrite_shared(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iwrite_shared(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iwrite_shared(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -2562,12 +3015,16 @@ extern void mpi_file_iwrite_shared__(MPI_Fint* fh, const void* buf, int* count,
 }
 int c_MPI_Type_get_extent_x(MPI_Datatype datatype, MPI_Count *lb, MPI_Count *extent)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_get_extent_x, (datatype, lb, extent));
+	PILGRIM_QUERY_1(int, MPI_Type_get_extent_x, (datatype, lb, extent));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, lb, extent);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Count), 1*sizeof(MPI_Count) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Count a1;
+		MPI_Count a2;
+	} scalars = { obj_id_0, (lb ? *lb : 0), (extent ? *extent : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_get_extent_x(MPI_Datatype datatype, MPI_Count *lb, MPI_Count *extent) { return c_MPI_Type_get_extent_x(datatype, lb, extent); }
 extern void f_mpi_type_get_extent_x(MPI_Fint* datatype, MPI_Count* lb, MPI_Count* extent, MPI_Fint *ierr) {
@@ -2600,9 +3057,14 @@ int c_MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status)
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(tag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(4, &source_rank, &my_tag, &obj_id_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3[2];
+	} scalars = { source_rank, my_tag, obj_id_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status) { return c_MPI_Probe(source, tag, comm, status); }
 extern void f_mpi_probe(int* source, int* tag, MPI_Fint* comm, MPI_Fint* status, MPI_Fint *ierr) {
@@ -2630,9 +3092,18 @@ int c_MPI_Cart_get(MPI_Comm comm, int maxdims, int dims[], int periods[], int co
 	PILGRIM_TRACING_1(int, MPI_Cart_get, (comm, maxdims, dims, periods, coords));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, &maxdims, dims, periods, coords);
-	int sizes[] = { sizeof(int), sizeof(int), maxdims*sizeof(int), maxdims*sizeof(int), maxdims*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, maxdims };
+	int tail_size_0 = maxdims*sizeof(int);
+	int tail_size_1 = maxdims*sizeof(int);
+	int tail_size_2 = maxdims*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, -1);
+	PILGRIM_ENCODE_TAIL(dims, tail_size_0);
+	PILGRIM_ENCODE_TAIL(periods, tail_size_1);
+	PILGRIM_ENCODE_TAIL(coords, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_get(MPI_Comm comm, int maxdims, int dims[], int periods[], int coords[]) { return c_MPI_Cart_get(comm, maxdims, dims, periods, coords); }
 extern void f_mpi_cart_get(MPI_Fint* comm, int* maxdims, int dims[], int periods[], int coords[], MPI_Fint *ierr) {
@@ -2657,9 +3128,12 @@ int c_MPI_Win_flush(int rank, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_flush, (rank, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &rank, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { rank, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_flush(int rank, MPI_Win win) { return c_MPI_Win_flush(rank, win); }
 extern void f_mpi_win_flush(int* rank, MPI_Fint* win, MPI_Fint *ierr) {
@@ -2681,6 +3155,11 @@ extern void mpi_win_flush__(int* rank, MPI_Fint* win, MPI_Fint *ierr) {
 }
 int c_MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm)
 {
+	if(logger_paused(ID_MPI_Intercomm_create)) {
+		PILGRIM_PMPI_CALL(int, MPI_Intercomm_create, (local_comm, local_leader, peer_comm, remote_leader, tag, newintercomm));
+		generate_intercomm_id(local_comm, newintercomm, tag);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Intercomm_create, (local_comm, local_leader, peer_comm, remote_leader, tag, newintercomm));
 	generate_intercomm_id(local_comm, newintercomm, tag);
 	MPI_Comm obj_0 = local_comm;
@@ -2690,9 +3169,16 @@ int c_MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_
 	int my_tag = tag;
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newintercomm);
-	void **args = assemble_args_list(6, &obj_id_0, &local_leader, &obj_id_1, &remote_leader, &my_tag, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { obj_id_0, local_leader, obj_id_1, remote_leader, my_tag, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm) { return c_MPI_Intercomm_create(local_comm, local_leader, peer_comm, remote_leader, tag, newintercomm); }
 extern void f_mpi_intercomm_create(MPI_Fint* local_comm, int* local_leader, MPI_Fint* peer_comm, int* remote_leader, int* tag, MPI_Fint* newintercomm, MPI_Fint *ierr) {
@@ -2730,9 +3216,16 @@ int c_MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) { return c_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm); }
 extern void f_mpi_allreduce(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -2762,9 +3255,13 @@ int c_MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype *newtype
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(3, &count, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { count, obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_contiguous(count, oldtype, newtype); }
 extern void f_mpi_type_contiguous(int* count, MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -2800,9 +3297,17 @@ int c_MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype dat
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm) { return c_MPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm); }
 extern void f_mpi_reduce(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -2831,9 +3336,12 @@ int c_MPI_File_get_position(MPI_File fh, MPI_Offset *offset)
 	PILGRIM_TRACING_1(int, MPI_File_get_position, (fh, offset));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, offset);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Offset) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Offset a1;
+	} scalars = { obj_id_0, (offset ? *offset : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_position(MPI_File fh, MPI_Offset *offset) { return c_MPI_File_get_position(fh, offset); }
 extern void f_mpi_file_get_position(MPI_Fint* fh, MPI_Offset* offset, MPI_Fint *ierr) {
@@ -2868,9 +3376,17 @@ int c_MPI_Recv_init(void *buf, int count, MPI_Datatype datatype, int source, int
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = create_request_id(request, false, ID_MPI_Recv_init, source, tag, obj_id_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &count, &obj_id_0, &source_rank, &my_tag, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, count, obj_id_0, source_rank, my_tag, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Recv_init(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Recv_init(buf, count, datatype, source, tag, comm, request); }
 extern void f_mpi_recv_init(void* buf, int* count, MPI_Fint* datatype, int* source, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -2901,9 +3417,12 @@ int c_MPI_Comm_group(MPI_Comm comm, MPI_Group *group)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, group);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_group(MPI_Comm comm, MPI_Group *group) { return c_MPI_Comm_group(comm, group); }
 extern void f_mpi_comm_group(MPI_Fint* comm, MPI_Fint* group, MPI_Fint *ierr) {
@@ -2928,10 +3447,12 @@ extern void mpi_comm_group__(MPI_Fint* comm, MPI_Fint* group, MPI_Fint *ierr) {
 }
 int c_MPI_Is_thread_main(int *flag)
 {
-	PILGRIM_TRACING_1(int, MPI_Is_thread_main, (flag));
-	void **args = assemble_args_list(1, flag);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Is_thread_main, (flag));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Is_thread_main(int *flag) { return c_MPI_Is_thread_main(flag); }
 extern void f_mpi_is_thread_main(int* flag, MPI_Fint *ierr) {
@@ -2958,9 +3479,14 @@ int c_MPI_File_iwrite_all(MPI_File fh, const void *buf, int count, MPI_Datatype
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iwrite_all(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iwrite_all(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iwrite_all(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -2992,9 +3518,16 @@ int c_MPI_Type_create_indexed_block(int count, int blocklength, const int array_
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, &blocklength, array_of_displacements, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), count*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { count, blocklength, obj_id_0, obj_id_1 };
+	int tail_size_0 = count*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(array_of_displacements, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_indexed_block(int count, int blocklength, const int array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_indexed_block(count, blocklength, array_of_displacements, oldtype, newtype); }
 extern void f_mpi_type_create_indexed_block(int* count, int* blocklength, const int array_of_displacements[], MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -3023,9 +3556,17 @@ int c_MPI_Type_create_hindexed(int count, const int array_of_blocklengths[], con
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, array_of_blocklengths, array_of_displacements, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), count*sizeof(const int), count*sizeof(const MPI_Aint), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { count, obj_id_0, obj_id_1 };
+	int tail_size_0 = count*sizeof(const int);
+	int tail_size_1 = count*sizeof(const MPI_Aint);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(array_of_blocklengths, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_displacements, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_hindexed(int count, const int array_of_blocklengths[], const MPI_Aint array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_hindexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype); }
 extern void f_mpi_type_create_hindexed(int* count, const int array_of_blocklengths[], const MPI_Aint array_of_displacements[], MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -3055,9 +3596,21 @@ int c_MPI_Dist_graph_neighbors(MPI_Comm comm, int maxindegree, int sources[], in
 	PMPI_Comm_size(comm, &comm_size);
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(7, &obj_id_0, &maxindegree, sources, sourceweights, &maxoutdegree, destinations, destweights);
-	int sizes[] = { sizeof(int), sizeof(int), maxindegree*sizeof(int), comm_size*sizeof(int), sizeof(int), maxoutdegree*sizeof(int), comm_size*sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, maxindegree, maxoutdegree };
+	int tail_size_0 = maxindegree*sizeof(int);
+	int tail_size_1 = comm_size*sizeof(int);
+	int tail_size_2 = maxoutdegree*sizeof(int);
+	int tail_size_3 = comm_size*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, comm_size);
+	PILGRIM_ENCODE_TAIL(sources, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sourceweights, tail_size_1);
+	PILGRIM_ENCODE_TAIL(destinations, tail_size_2);
+	PILGRIM_ENCODE_TAIL(destweights, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Dist_graph_neighbors(MPI_Comm comm, int maxindegree, int sources[], int sourceweights[], int maxoutdegree, int destinations[], int destweights[]) { return c_MPI_Dist_graph_neighbors(comm, maxindegree, sources, sourceweights, maxoutdegree, destinations, destweights); }
 extern void f_mpi_dist_graph_neighbors(MPI_Fint* comm, int* maxindegree, int sources[], int sourceweights[], int* maxoutdegree, int destinations[], int destweights[], MPI_Fint *ierr) {
@@ -3082,9 +3635,14 @@ extern void mpi_dist_graph_neighbors__(MPI_Fint* comm, int* maxindegree, int sou
 int c_MPI_Error_string(int errorcode, char *string, int *resultlen)
 {
 	PILGRIM_TRACING_1(int, MPI_Error_string, (errorcode, string, resultlen));
-	void **args = assemble_args_list(3, &errorcode, string, resultlen);
-	int sizes[] = { sizeof(int), strlen(string)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { errorcode, (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(string)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(string, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Error_string(int errorcode, char *string, int *resultlen) { return c_MPI_Error_string(errorcode, string, resultlen); }
 extern void f_mpi_error_string(int* errorcode, char* string, int* resultlen, MPI_Fint *ierr) {
@@ -3107,9 +3665,11 @@ int c_MPI_File_sync(MPI_File fh)
 	PILGRIM_TRACING_1(int, MPI_File_sync, (fh));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_sync(MPI_File fh) { return c_MPI_File_sync(fh); }
 extern void f_mpi_file_sync(MPI_Fint* fh, MPI_Fint *ierr) {
@@ -3145,9 +3705,20 @@ int c_MPI_Ineighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ineighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ineighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request); }
 extern void f_mpi_ineighbor_allgatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -3189,9 +3760,17 @@ int c_MPI_Compare_and_swap(const void *origin_addr, const void *compare_addr, vo
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Win obj_1 = win;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Win, &obj_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &mem_attr_1, &mem_attr_2, &obj_id_0, &target_rank, &target_disp, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+		MPI_Aint a5;
+		int a6;
+	} scalars = { mem_attr_0, mem_attr_1, mem_attr_2, obj_id_0, target_rank, target_disp, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Compare_and_swap(const void *origin_addr, const void *compare_addr, void *result_addr, MPI_Datatype datatype, int target_rank, MPI_Aint target_disp, MPI_Win win) { return c_MPI_Compare_and_swap(origin_addr, compare_addr, result_addr, datatype, target_rank, target_disp, win); }
 extern void f_mpi_compare_and_swap(const void* origin_addr, const void* compare_addr, void* result_addr, MPI_Fint* datatype, int* target_rank, MPI_Aint target_disp, MPI_Fint* win, MPI_Fint *ierr) {
@@ -3218,9 +3797,11 @@ int c_MPI_Win_unlock_all(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_unlock_all, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_unlock_all(MPI_Win win) { return c_MPI_Win_unlock_all(win); }
 extern void f_mpi_win_unlock_all(MPI_Fint* win, MPI_Fint *ierr) {
@@ -3247,9 +3828,14 @@ int c_MPI_Type_get_attr(MPI_Datatype datatype, int type_keyval, void *attribute_
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(4, &obj_id_0, &type_keyval, &mem_attr_0, flag);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+	} scalars = { obj_id_0, type_keyval, mem_attr_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_get_attr(MPI_Datatype datatype, int type_keyval, void *attribute_val, int *flag) { return c_MPI_Type_get_attr(datatype, type_keyval, attribute_val, flag); }
 extern void f_mpi_type_get_attr(MPI_Fint* datatype, int* type_keyval, void* attribute_val, int* flag, MPI_Fint *ierr) {
@@ -3273,9 +3859,11 @@ int c_MPI_Comm_disconnect(MPI_Comm *comm)
 {
 	PILGRIM_TRACING_1(int, MPI_Comm_disconnect, (comm));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, comm);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_disconnect(MPI_Comm *comm) { return c_MPI_Comm_disconnect(comm); }
 extern void f_mpi_comm_disconnect(MPI_Fint* comm, MPI_Fint *ierr) {
@@ -3301,9 +3889,13 @@ int c_MPI_T_pvar_readreset(MPI_T_pvar_session session, MPI_T_pvar_handle handle,
 	PILGRIM_TRACING_1(int, MPI_T_pvar_readreset, (session, handle, buf));
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
-	void **args = assemble_args_list(3, &session, &handle, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+		MemPtrAttr a2;
+	} scalars = { session, handle, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_readreset(MPI_T_pvar_session session, MPI_T_pvar_handle handle, void *buf) { return c_MPI_T_pvar_readreset(session, handle, buf); }
 int c_MPI_Attr_get(MPI_Comm comm, int keyval, void *attribute_val, int *flag)
@@ -3313,9 +3905,14 @@ int c_MPI_Attr_get(MPI_Comm comm, int keyval, void *attribute_val, int *flag)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(4, &obj_id_0, &keyval, &mem_attr_0, flag);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+	} scalars = { obj_id_0, keyval, mem_attr_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Attr_get(MPI_Comm comm, int keyval, void *attribute_val, int *flag) { return c_MPI_Attr_get(comm, keyval, attribute_val, flag); }
 extern void f_mpi_attr_get(MPI_Fint* comm, int* keyval, void* attribute_val, int* flag, MPI_Fint *ierr) {
@@ -3338,17 +3935,26 @@ extern void mpi_attr_get__(MPI_Fint* comm, int* keyval, void* attribute_val, int
 int c_MPI_T_cvar_handle_free(MPI_T_cvar_handle *handle)
 {
 	PILGRIM_TRACING_1(int, MPI_T_cvar_handle_free, (handle));
-	void **args = assemble_args_list(1, handle);
-	int sizes[] = { 1*sizeof(MPI_T_cvar_handle) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_cvar_handle a0;
+	} scalars = { (handle ? *handle : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_handle_free(MPI_T_cvar_handle *handle) { return c_MPI_T_cvar_handle_free(handle); }
 int c_MPI_T_enum_get_item(MPI_T_enum enumtype, int index, int *value, char *name, int *name_len)
 {
 	PILGRIM_TRACING_1(int, MPI_T_enum_get_item, (enumtype, index, value, name, name_len));
-	void **args = assemble_args_list(5, &enumtype, &index, value, name, name_len);
-	int sizes[] = { sizeof(MPI_T_enum), sizeof(int), 1*sizeof(int), strlen(name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_enum a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { enumtype, index, (value ? *value : 0), (name_len ? *name_len : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_enum_get_item(MPI_T_enum enumtype, int index, int *value, char *name, int *name_len) { return c_MPI_T_enum_get_item(enumtype, index, value, name, name_len); }
 int c_MPI_File_call_errhandler(MPI_File fh, int errorcode)
@@ -3356,9 +3962,12 @@ int c_MPI_File_call_errhandler(MPI_File fh, int errorcode)
 	PILGRIM_TRACING_1(int, MPI_File_call_errhandler, (fh, errorcode));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &errorcode);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, errorcode };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_call_errhandler(MPI_File fh, int errorcode) { return c_MPI_File_call_errhandler(fh, errorcode); }
 extern void f_mpi_file_call_errhandler(MPI_Fint* fh, int* errorcode, MPI_Fint *ierr) {
@@ -3385,9 +3994,13 @@ int c_MPI_Group_compare(MPI_Group group1, MPI_Group group2, int *result)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	MPI_Group obj_1 = group2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, result);
-	int sizes[] = { sizeof(int), sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, (result ? *result : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_compare(MPI_Group group1, MPI_Group group2, int *result) { return c_MPI_Group_compare(group1, group2, result); }
 extern void f_mpi_group_compare(MPI_Fint* group1, MPI_Fint* group2, int* result, MPI_Fint *ierr) {
@@ -3411,16 +4024,26 @@ extern void mpi_group_compare__(MPI_Fint* group1, MPI_Fint* group2, int* result,
 }
 int c_MPI_Imrecv(void *buf, int count, MPI_Datatype datatype, MPI_Message *message, MPI_Request *request)
 {
+	if(logger_paused(ID_MPI_Imrecv)) {
+		MPI_OBJ_RELEASE(MPI_Message, message);
+		PILGRIM_PMPI_CALL(int, MPI_Imrecv, (buf, count, datatype, message, request));
+		return res;
+	}
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Message, message);
-	void **args = assemble_args_list(4, &mem_attr_0, &count, &obj_id_0, &obj_id_1);
 	MPI_OBJ_RELEASE(MPI_Message, message);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { mem_attr_0, count, obj_id_0, obj_id_1 };
 	PILGRIM_TRACING_1(int, MPI_Imrecv, (buf, count, datatype, message, request));
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Imrecv(void *buf, int count, MPI_Datatype datatype, MPI_Message *message, MPI_Request *request) { return c_MPI_Imrecv(buf, count, datatype, message, request); }
 extern void f_mpi_imrecv(void* buf, int* count, MPI_Fint* datatype, MPI_Fint* message, MPI_Fint* request, MPI_Fint *ierr) {
@@ -3449,18 +4072,25 @@ extern void mpi_imrecv__(void* buf, int* count, MPI_Fint* datatype, MPI_Fint* me
 int c_MPI_T_category_get_index(const char *name, int *cat_index)
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_index, (name, cat_index));
-	void **args = assemble_args_list(2, name, cat_index);
-	int sizes[] = { strlen(name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (cat_index ? *cat_index : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_index(const char *name, int *cat_index) { return c_MPI_T_category_get_index(name, cat_index); }
 int c_MPI_Test_cancelled(const MPI_Status *status, int *flag)
 {
 	PILGRIM_TRACING_1(int, MPI_Test_cancelled, (status, flag));
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(2, status_arg, flag);
-	int sizes[] = { sizeof(int)*2, 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0[2];
+		int a1;
+	} scalars = { {status_arg[0], status_arg[1]}, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Test_cancelled(const MPI_Status *status, int *flag) { return c_MPI_Test_cancelled(status, flag); }
 extern void f_mpi_test_cancelled(MPI_Fint* status, int* flag, MPI_Fint *ierr) {
@@ -3485,9 +4115,12 @@ int c_MPI_Buffer_attach(void *buffer, int size)
 	PILGRIM_TRACING_1(int, MPI_Buffer_attach, (buffer, size));
 	MemPtrAttr mem_attr_0;
 	addr2id(buffer, &mem_attr_0);
-	void **args = assemble_args_list(2, &mem_attr_0, &size);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+	} scalars = { mem_attr_0, size };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Buffer_attach(void *buffer, int size) { return c_MPI_Buffer_attach(buffer, size); }
 extern void f_mpi_buffer_attach(void* buffer, int* size, MPI_Fint *ierr) {
@@ -3510,9 +4143,12 @@ int c_MPI_Win_call_errhandler(MPI_Win win, int errorcode)
 	PILGRIM_TRACING_1(int, MPI_Win_call_errhandler, (win, errorcode));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &errorcode);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, errorcode };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_call_errhandler(MPI_Win win, int errorcode) { return c_MPI_Win_call_errhandler(win, errorcode); }
 extern void f_mpi_win_call_errhandler(MPI_Fint* win, int* errorcode, MPI_Fint *ierr) {
@@ -3537,9 +4173,13 @@ int c_MPI_Graph_neighbors_count(MPI_Comm comm, int rank, int *nneighbors)
 	PILGRIM_TRACING_1(int, MPI_Graph_neighbors_count, (comm, rank, nneighbors));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, &rank, nneighbors);
-	int sizes[] = { sizeof(int), sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, rank, (nneighbors ? *nneighbors : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Graph_neighbors_count(MPI_Comm comm, int rank, int *nneighbors) { return c_MPI_Graph_neighbors_count(comm, rank, nneighbors); }
 extern void f_mpi_graph_neighbors_count(MPI_Fint* comm, int* rank, int* nneighbors, MPI_Fint *ierr) {
@@ -3564,9 +4204,12 @@ int c_MPI_File_get_position_shared(MPI_File fh, MPI_Offset *offset)
 	PILGRIM_TRACING_1(int, MPI_File_get_position_shared, (fh, offset));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, offset);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Offset) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Offset a1;
+	} scalars = { obj_id_0, (offset ? *offset : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_position_shared(MPI_File fh, MPI_Offset *offset) { return c_MPI_File_get_position_shared(fh, offset); }
 extern void f_mpi_file_get_position_shared(MPI_Fint* fh, MPI_Offset* offset, MPI_Fint *ierr) {
@@ -3591,9 +4234,17 @@ int c_MPI_Cart_map(MPI_Comm comm, int ndims, const int dims[], const int periods
 	PILGRIM_TRACING_1(int, MPI_Cart_map, (comm, ndims, dims, periods, newrank));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, &ndims, dims, periods, newrank);
-	int sizes[] = { sizeof(int), sizeof(int), ndims*sizeof(const int), ndims*sizeof(const int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, ndims, (newrank ? *newrank : 0) };
+	int tail_size_0 = ndims*sizeof(const int);
+	int tail_size_1 = ndims*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(dims, tail_size_0);
+	PILGRIM_ENCODE_TAIL(periods, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_map(MPI_Comm comm, int ndims, const int dims[], const int periods[], int *newrank) { return c_MPI_Cart_map(comm, ndims, dims, periods, newrank); }
 extern void f_mpi_cart_map(MPI_Fint* comm, int* ndims, const int dims[], const int periods[], int* newrank, MPI_Fint *ierr) {
@@ -3622,9 +4273,14 @@ int c_MPI_File_iread(MPI_File fh, void *buf, int count, MPI_Datatype datatype, M
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iread(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iread(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iread(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -3655,9 +4311,14 @@ int c_MPI_Dist_graph_neighbors_count(MPI_Comm comm, int *indegree, int *outdegre
 	PILGRIM_TRACING_1(int, MPI_Dist_graph_neighbors_count, (comm, indegree, outdegree, weighted));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(4, &obj_id_0, indegree, outdegree, weighted);
-	int sizes[] = { sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, (indegree ? *indegree : 0), (outdegree ? *outdegree : 0), (weighted ? *weighted : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Dist_graph_neighbors_count(MPI_Comm comm, int *indegree, int *outdegree, int *weighted) { return c_MPI_Dist_graph_neighbors_count(comm, indegree, outdegree, weighted); }
 extern void f_mpi_dist_graph_neighbors_count(MPI_Fint* comm, int* indegree, int* outdegree, int* weighted, MPI_Fint *ierr) {
@@ -3681,9 +4342,22 @@ int c_MPI_T_cvar_get_info(int cvar_index, char *name, int *name_len, int *verbos
 {
 	PILGRIM_TRACING_1(int, MPI_T_cvar_get_info, (cvar_index, name, name_len, verbosity, datatype, enumtype, desc, desc_len, bind, scope));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, datatype);
-	void **args = assemble_args_list(10, &cvar_index, name, name_len, verbosity, &obj_id_0, enumtype, desc, desc_len, bind, scope);
-	int sizes[] = { sizeof(int), strlen(name)+1, 1*sizeof(int), 1*sizeof(int), sizeof(int), 1*sizeof(MPI_T_enum), strlen(desc)+1, 1*sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(10, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_T_enum a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { cvar_index, (name_len ? *name_len : 0), (verbosity ? *verbosity : 0), obj_id_0, (enumtype ? *enumtype : 0), (desc_len ? *desc_len : 0), (bind ? *bind : 0), (scope ? *scope : 0) };
+	int tail_size_0 = strlen(name)+1;
+	int tail_size_1 = strlen(desc)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(desc, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_get_info(int cvar_index, char *name, int *name_len, int *verbosity, MPI_Datatype *datatype, MPI_T_enum *enumtype, char *desc, int *desc_len, int *bind, int *scope) { return c_MPI_T_cvar_get_info(cvar_index, name, name_len, verbosity, datatype, enumtype, desc, desc_len, bind, scope); }
 int c_MPI_T_pvar_read(MPI_T_pvar_session session, MPI_T_pvar_handle handle, void *buf)
@@ -3691,9 +4365,13 @@ int c_MPI_T_pvar_read(MPI_T_pvar_session session, MPI_T_pvar_handle handle, void
 	PILGRIM_TRACING_1(int, MPI_T_pvar_read, (session, handle, buf));
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
-	void **args = assemble_args_list(3, &session, &handle, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+		MemPtrAttr a2;
+	} scalars = { session, handle, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_read(MPI_T_pvar_session session, MPI_T_pvar_handle handle, void *buf) { return c_MPI_T_pvar_read(session, handle, buf); }
 int c_MPI_Type_set_name(MPI_Datatype datatype, const char *type_name)
@@ -3701,9 +4379,13 @@ int c_MPI_Type_set_name(MPI_Datatype datatype, const char *type_name)
 	PILGRIM_TRACING_1(int, MPI_Type_set_name, (datatype, type_name));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, type_name);
-	int sizes[] = { sizeof(int), strlen(type_name)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(type_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(type_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_set_name(MPI_Datatype datatype, const char *type_name) { return c_MPI_Type_set_name(datatype, type_name); }
 extern void f_mpi_type_set_name(MPI_Fint* datatype, const char* type_name, MPI_Fint *ierr) {
@@ -3739,9 +4421,25 @@ int c_MPI_Neighbor_alltoallw(const void *sendbuf, const int sendcounts[], const
 	for(int i=0; i<comm_size; i++) obj_id_1[i] = (recvtypes==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &recvtypes[i]);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, obj_id_0, &mem_attr_1, recvcounts, rdispls, obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const MPI_Aint), (comm_size)*sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const MPI_Aint), (comm_size)*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const MPI_Aint);
+	int tail_size_2 = (comm_size)*sizeof(int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	int tail_size_4 = comm_size*sizeof(const MPI_Aint);
+	int tail_size_5 = (comm_size)*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3 + tail_size_4 + tail_size_5, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_2);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_3);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_4);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_1, tail_size_5);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Neighbor_alltoallw(const void *sendbuf, const int sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm) { return c_MPI_Neighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm); }
 extern void f_mpi_neighbor_alltoallw(const void* sendbuf, const int sendcounts[], const MPI_Aint sdispls[], MPI_Fint* sendtypes, void* recvbuf, const int recvcounts[], const MPI_Aint rdispls[], MPI_Fint* recvtypes, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -3782,9 +4480,23 @@ int c_MPI_Neighbor_alltoallv(const void *sendbuf, const int sendcounts[], const
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, &obj_id_0, &mem_attr_1, recvcounts, rdispls, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = comm_size*sizeof(const int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_2);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Neighbor_alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm); }
 extern void f_mpi_neighbor_alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -3815,9 +4527,15 @@ int c_MPI_Publish_name(const char *service_name, MPI_Info info, const char *port
 	PILGRIM_TRACING_1(int, MPI_Publish_name, (service_name, info, port_name));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(3, service_name, &obj_id_0, port_name);
-	int sizes[] = { strlen(service_name)+1, sizeof(int), strlen(port_name)+1 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(service_name)+1;
+	int tail_size_1 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(service_name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Publish_name(const char *service_name, MPI_Info info, const char *port_name) { return c_MPI_Publish_name(service_name, info, port_name); }
 extern void f_mpi_publish_name(const char* service_name, MPI_Fint* info, const char* port_name, MPI_Fint *ierr) {
@@ -3839,12 +4557,16 @@ extern void mpi_publish_name__(const char* service_name, MPI_Fint* info, const c
 }
 int c_MPI_Type_get_extent(MPI_Datatype datatype, MPI_Aint *lb, MPI_Aint *extent)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_get_extent, (datatype, lb, extent));
+	PILGRIM_QUERY_1(int, MPI_Type_get_extent, (datatype, lb, extent));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, lb, extent);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Aint), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Aint a1;
+		MPI_Aint a2;
+	} scalars = { obj_id_0, (lb ? *lb : 0), (extent ? *extent : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_get_extent(MPI_Datatype datatype, MPI_Aint *lb, MPI_Aint *extent) { return c_MPI_Type_get_extent(datatype, lb, extent); }
 extern void f_mpi_type_get_extent(MPI_Fint* datatype, MPI_Aint* lb, MPI_Aint* extent, MPI_Fint *ierr) {
@@ -3866,14 +4588,27 @@ extern void mpi_type_get_extent__(MPI_Fint* datatype, MPI_Aint* lb, MPI_Aint* ex
 }
 int c_MPI_Graph_create(MPI_Comm comm_old, int nnodes, const int index[], const int edges[], int reorder, MPI_Comm *comm_graph)
 {
+	if(logger_paused(ID_MPI_Graph_create)) {
+		PILGRIM_PMPI_CALL(int, MPI_Graph_create, (comm_old, nnodes, index, edges, reorder, comm_graph));
+		generate_intracomm_id(comm_graph);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Graph_create, (comm_old, nnodes, index, edges, reorder, comm_graph));
 	generate_intracomm_id(comm_graph);
 	MPI_Comm obj_0 = comm_old;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, comm_graph);
-	void **args = assemble_args_list(6, &obj_id_0, &nnodes, index, edges, &reorder, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), nnodes*sizeof(const int), 1*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { obj_id_0, nnodes, (edges ? *edges : 0), reorder, obj_id_1 };
+	int tail_size_0 = nnodes*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(index, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Graph_create(MPI_Comm comm_old, int nnodes, const int index[], const int edges[], int reorder, MPI_Comm *comm_graph) { return c_MPI_Graph_create(comm_old, nnodes, index, edges, reorder, comm_graph); }
 extern void f_mpi_graph_create(MPI_Fint* comm_old, int* nnodes, const int index[], const int edges[], int* reorder, MPI_Fint* comm_graph, MPI_Fint *ierr) {
@@ -3907,9 +4642,18 @@ int c_MPI_Put(const void *origin_addr, int origin_count, MPI_Datatype origin_dat
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Win obj_2 = win;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Put(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win) { return c_MPI_Put(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win); }
 extern void f_mpi_put(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* win, MPI_Fint *ierr) {
@@ -3941,9 +4685,13 @@ int c_MPI_Win_create_dynamic(MPI_Info info, MPI_Comm comm, MPI_Win *win)
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, win);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_create_dynamic(MPI_Info info, MPI_Comm comm, MPI_Win *win) { return c_MPI_Win_create_dynamic(info, comm, win); }
 extern void f_mpi_win_create_dynamic(MPI_Fint* info, MPI_Fint* comm, MPI_Fint* win, MPI_Fint *ierr) {
@@ -3982,9 +4730,16 @@ int c_MPI_Ibsend(const void *buf, int count, MPI_Datatype datatype, int dest, in
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ibsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ibsend(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_ibsend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4014,9 +4769,11 @@ int c_MPI_Win_complete(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_complete, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_complete(MPI_Win win) { return c_MPI_Win_complete(win); }
 extern void f_mpi_win_complete(MPI_Fint* win, MPI_Fint *ierr) {
@@ -4043,9 +4800,18 @@ int c_MPI_Graph_map(MPI_Comm comm, int nnodes, const int index[], const int edge
 	PMPI_Comm_size(comm, &comm_size);
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, &nnodes, index, edges, newrank);
-	int sizes[] = { sizeof(int), sizeof(int), nnodes*sizeof(const int), comm_size*sizeof(const int), comm_size*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, nnodes };
+	int tail_size_0 = nnodes*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = comm_size*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, comm_size);
+	PILGRIM_ENCODE_TAIL(index, tail_size_0);
+	PILGRIM_ENCODE_TAIL(edges, tail_size_1);
+	PILGRIM_ENCODE_TAIL(newrank, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Graph_map(MPI_Comm comm, int nnodes, const int index[], const int edges[], int *newrank) { return c_MPI_Graph_map(comm, nnodes, index, edges, newrank); }
 extern void f_mpi_graph_map(MPI_Fint* comm, int* nnodes, const int index[], const int edges[], int* newrank, MPI_Fint *ierr) {
@@ -4072,9 +4838,15 @@ int c_MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *
 	PILGRIM_TRACING_1(int, MPI_Info_get_valuelen, (info, key, valuelen, flag));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(4, &obj_id_0, key, valuelen, flag);
-	int sizes[] = { sizeof(int), strlen(key)+1, 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, (valuelen ? *valuelen : 0), (flag ? *flag : 0) };
+	int tail_size_0 = strlen(key)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(key, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag) { return c_MPI_Info_get_valuelen(info, key, valuelen, flag); }
 extern void f_mpi_info_get_valuelen(MPI_Fint* info, const char* key, int* valuelen, int* flag, MPI_Fint *ierr) {
@@ -4096,6 +4868,11 @@ extern void mpi_info_get_valuelen__(MPI_Fint* info, const char* key, int* valuel
 }
 int c_MPI_Cart_sub(MPI_Comm comm, const int remain_dims[], MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Cart_sub)) {
+		PILGRIM_PMPI_CALL(int, MPI_Cart_sub, (comm, remain_dims, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Cart_sub, (comm, remain_dims, newcomm));
 	generate_intracomm_id(newcomm);
 	int comm_size;
@@ -4103,9 +4880,14 @@ int c_MPI_Cart_sub(MPI_Comm comm, const int remain_dims[], MPI_Comm *newcomm)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(3, &obj_id_0, remain_dims, &obj_id_1);
-	int sizes[] = { sizeof(int), comm_size*sizeof(const int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, comm_size);
+	PILGRIM_ENCODE_TAIL(remain_dims, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_sub(MPI_Comm comm, const int remain_dims[], MPI_Comm *newcomm) { return c_MPI_Cart_sub(comm, remain_dims, newcomm); }
 extern void f_mpi_cart_sub(MPI_Fint* comm, const int remain_dims[], MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -4135,9 +4917,17 @@ int c_MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, in
 	PILGRIM_TRACING_1(int, MPI_Info_get, (info, key, valuelen, value, flag));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, key, &valuelen, value, flag);
-	int sizes[] = { sizeof(int), strlen(key)+1, sizeof(int), strlen(value)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, valuelen, (flag ? *flag : 0) };
+	int tail_size_0 = strlen(key)+1;
+	int tail_size_1 = strlen(value)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(key, tail_size_0);
+	PILGRIM_ENCODE_TAIL(value, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag) { return c_MPI_Info_get(info, key, valuelen, value, flag); }
 extern void f_mpi_info_get(MPI_Fint* info, const char* key, int* valuelen, char* value, int* flag, MPI_Fint *ierr) {
@@ -4167,9 +4957,14 @@ int c_MPI_File_iwrite_at(MPI_File fh, MPI_Offset offset, const void *buf, int co
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iwrite_at(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iwrite_at(fh, offset, buf, count, datatype, request); }
 extern void f_mpi_file_iwrite_at(MPI_Fint* fh, MPI_Offset offset, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4197,6 +4992,11 @@ extern void mpi_file_iwrite_at__(MPI_Fint* fh, MPI_Offset offset, const void* bu
 }
 int c_MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[])
 {
+	if(logger_paused(ID_MPI_Comm_spawn)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_spawn, (command, argv, maxprocs, info, root, comm, intercomm, array_of_errcodes));
+		generate_intercomm_id(comm, intercomm, 0);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_spawn, (command, argv, maxprocs, info, root, comm, intercomm, array_of_errcodes));
 	generate_intercomm_id(comm, intercomm, 0);
 	int comm_size;
@@ -4206,9 +5006,19 @@ int c_MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info i
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, intercomm);
-	void **args = assemble_args_list(8, command, argv, &maxprocs, &obj_id_0, &root, &obj_id_1, &obj_id_2, array_of_errcodes);
-	int sizes[] = { strlen(command)+1, sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), comm_size*sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { maxprocs, obj_id_0, root, obj_id_1, obj_id_2 };
+	int tail_size_0 = strlen(command)+1;
+	int tail_size_1 = comm_size*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(command, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_errcodes, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]) { return c_MPI_Comm_spawn(command, argv, maxprocs, info, root, comm, intercomm, array_of_errcodes); }
 extern void f_mpi_comm_spawn(const char* command, char* argv[], int* maxprocs, MPI_Fint* info, int* root, MPI_Fint* comm, MPI_Fint* intercomm, int array_of_errcodes[], MPI_Fint *ierr) {
@@ -4243,9 +5053,13 @@ int c_MPI_Group_intersection(MPI_Group group1, MPI_Group group2, MPI_Group *newg
 	MPI_Group obj_1 = group2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_intersection(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup) { return c_MPI_Group_intersection(group1, group2, newgroup); }
 extern void f_mpi_group_intersection(MPI_Fint* group1, MPI_Fint* group2, MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -4285,9 +5099,20 @@ int c_MPI_Iallgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iallgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request); }
 extern void f_mpi_iallgatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4325,9 +5150,15 @@ int c_MPI_Ibcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_C
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(5, &mem_attr_0, &count, &obj_id_0, &root, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, count, obj_id_0, root, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ibcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ibcast(buffer, count, datatype, root, comm, request); }
 extern void f_mpi_ibcast(void* buffer, int* count, MPI_Fint* datatype, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4362,9 +5193,14 @@ int c_MPI_File_read_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf, int
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_read_at_all_begin(fh, offset, buf, count, datatype); }
 extern void f_mpi_file_read_at_all_begin(MPI_Fint* fh, MPI_Offset offset, void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -4391,9 +5227,14 @@ int c_MPI_Info_get_nthkey(MPI_Info info, int n, char *key)
 	PILGRIM_TRACING_1(int, MPI_Info_get_nthkey, (info, n, key));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, &n, key);
-	int sizes[] = { sizeof(int), sizeof(int), strlen(key)+1 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, n };
+	int tail_size_0 = strlen(key)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(key, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_get_nthkey(MPI_Info info, int n, char *key) { return c_MPI_Info_get_nthkey(info, n, key); }
 extern void f_mpi_info_get_nthkey(MPI_Fint* info, int* n, char* key, MPI_Fint *ierr) {
@@ -4418,9 +5259,12 @@ int c_MPI_File_get_size(MPI_File fh, MPI_Offset *size)
 	PILGRIM_TRACING_1(int, MPI_File_get_size, (fh, size));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Offset) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Offset a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_size(MPI_File fh, MPI_Offset *size) { return c_MPI_File_get_size(fh, size); }
 extern void f_mpi_file_get_size(MPI_Fint* fh, MPI_Offset* size, MPI_Fint *ierr) {
@@ -4451,9 +5295,18 @@ int c_MPI_Rput(const void *origin_addr, int origin_count, MPI_Datatype origin_da
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Win obj_2 = win;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Rput(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request) { return c_MPI_Rput(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request); }
 extern void f_mpi_rput(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* win, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4486,9 +5339,17 @@ int c_MPI_Type_indexed(int count, const int array_of_blocklengths[], const int a
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, array_of_blocklengths, array_of_displacements, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), count*sizeof(const int), count*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { count, obj_id_0, obj_id_1 };
+	int tail_size_0 = count*sizeof(const int);
+	int tail_size_1 = count*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(array_of_blocklengths, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_displacements, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_indexed(int count, const int array_of_blocklengths[], const int array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_indexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype); }
 extern void f_mpi_type_indexed(int* count, const int array_of_blocklengths[], const int array_of_displacements[], MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -4525,9 +5386,16 @@ int c_MPI_Send_init(const void *buf, int count, MPI_Datatype datatype, int dest,
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Send_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Send_init(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_send_init(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -4562,9 +5430,15 @@ int c_MPI_File_write(MPI_File fh, const void *buf, int count, MPI_Datatype datat
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write(fh, buf, count, datatype, status); }
 extern void f_mpi_file_write(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -4597,9 +5471,12 @@ int c_MPI_File_set_info(MPI_File fh, MPI_Info info)
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_set_info(MPI_File fh, MPI_Info info) { return c_MPI_File_set_info(fh, info); }
 extern void f_mpi_file_set_info(MPI_Fint* fh, MPI_Fint* info, MPI_Fint *ierr) {
@@ -4627,9 +5504,12 @@ int c_MPI_File_set_atomicity(MPI_File fh, int flag)
 	PILGRIM_TRACING_1(int, MPI_File_set_atomicity, (fh, flag));
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &flag);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, flag };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_set_atomicity(MPI_File fh, int flag) { return c_MPI_File_set_atomicity(fh, flag); }
 extern void f_mpi_file_set_atomicity(MPI_Fint* fh, int* flag, MPI_Fint *ierr) {
@@ -4655,9 +5535,17 @@ int c_MPI_Graph_get(MPI_Comm comm, int maxindex, int maxedges, int index[], int
 	PILGRIM_TRACING_1(int, MPI_Graph_get, (comm, maxindex, maxedges, index, edges));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(5, &obj_id_0, &maxindex, &maxedges, index, edges);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), maxindex*sizeof(int), maxedges*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, maxindex, maxedges };
+	int tail_size_0 = maxindex*sizeof(int);
+	int tail_size_1 = maxedges*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(index, tail_size_0);
+	PILGRIM_ENCODE_TAIL(edges, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Graph_get(MPI_Comm comm, int maxindex, int maxedges, int index[], int edges[]) { return c_MPI_Graph_get(comm, maxindex, maxedges, index, edges); }
 extern void f_mpi_graph_get(MPI_Fint* comm, int* maxindex, int* maxedges, int index[], int edges[], MPI_Fint *ierr) {
@@ -4682,9 +5570,15 @@ int c_MPI_Pack_external_size(const char datarep[], int incount, MPI_Datatype dat
 	PILGRIM_TRACING_1(int, MPI_Pack_external_size, (datarep, incount, datatype, size));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(4, datarep, &incount, &obj_id_0, size);
-	int sizes[] = { strlen(datarep)+1, sizeof(int), sizeof(int), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MPI_Aint a2;
+	} scalars = { incount, obj_id_0, (size ? *size : 0) };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Pack_external_size(const char datarep[], int incount, MPI_Datatype datatype, MPI_Aint *size) { return c_MPI_Pack_external_size(datarep, incount, datatype, size); }
 extern void f_mpi_pack_external_size(const char datarep[], int* incount, MPI_Fint* datatype, MPI_Aint* size, MPI_Fint *ierr) {
@@ -4710,9 +5604,24 @@ int c_MPI_Type_create_darray(int size, int rank, int ndims, const int array_of_g
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(10, &size, &rank, &ndims, array_of_gsizes, array_of_distribs, array_of_dargs, array_of_psizes, &order, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), ndims*sizeof(const int), ndims*sizeof(const int), ndims*sizeof(const int), ndims*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(10, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { size, rank, ndims, order, obj_id_0, obj_id_1 };
+	int tail_size_0 = ndims*sizeof(const int);
+	int tail_size_1 = ndims*sizeof(const int);
+	int tail_size_2 = ndims*sizeof(const int);
+	int tail_size_3 = ndims*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, -1);
+	PILGRIM_ENCODE_TAIL(array_of_gsizes, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_distribs, tail_size_1);
+	PILGRIM_ENCODE_TAIL(array_of_dargs, tail_size_2);
+	PILGRIM_ENCODE_TAIL(array_of_psizes, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_darray(int size, int rank, int ndims, const int array_of_gsizes[], const int array_of_distribs[], const int array_of_dargs[], const int array_of_psizes[], int order, MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_darray(size, rank, ndims, array_of_gsizes, array_of_distribs, array_of_dargs, array_of_psizes, order, oldtype, newtype); }
 extern void f_mpi_type_create_darray(int* size, int* rank, int* ndims, const int array_of_gsizes[], const int array_of_distribs[], const int array_of_dargs[], const int array_of_psizes[], int* order, MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -4742,9 +5651,12 @@ int c_MPI_Win_set_errhandler(MPI_Win win, MPI_Errhandler errhandler)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MPI_Errhandler obj_1 = errhandler;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_set_errhandler(MPI_Win win, MPI_Errhandler errhandler) { return c_MPI_Win_set_errhandler(win, errhandler); }
 extern void f_mpi_win_set_errhandler(MPI_Fint* win, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -4772,9 +5684,12 @@ int c_MPI_Type_create_keyval(MPI_Type_copy_attr_function *type_copy_attr_fn, MPI
 	PILGRIM_TRACING_1(int, MPI_Type_create_keyval, (type_copy_attr_fn, type_delete_attr_fn, type_keyval, extra_state));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(4, type_copy_attr_fn, type_delete_attr_fn, type_keyval, &mem_attr_0);
-	int sizes[] = { 1*sizeof(MPI_Type_copy_attr_function), 1*sizeof(MPI_Type_delete_attr_function), 1*sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+	} scalars = { (type_keyval ? *type_keyval : 0), mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_keyval(MPI_Type_copy_attr_function *type_copy_attr_fn, MPI_Type_delete_attr_function *type_delete_attr_fn, int *type_keyval, void *extra_state) { return c_MPI_Type_create_keyval(type_copy_attr_fn, type_delete_attr_fn, type_keyval, extra_state); }
 extern void f_mpi_type_create_keyval(MPI_Type_copy_attr_function* type_copy_attr_fn, MPI_Type_delete_attr_function* type_delete_attr_fn, int* type_keyval, void* extra_state, MPI_Fint *ierr) {
@@ -4794,6 +5709,11 @@ extern void mpi_type_create_keyval__(MPI_Type_copy_attr_function* type_copy_attr
 }
 int c_MPI_Comm_accept(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_accept)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_accept, (port_name, info, root, comm, newcomm));
+		generate_intercomm_id(comm, newcomm, 0);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_accept, (port_name, info, root, comm, newcomm));
 	generate_intercomm_id(comm, newcomm, 0);
 	MPI_Info obj_0 = info;
@@ -4801,9 +5721,16 @@ int c_MPI_Comm_accept(const char *port_name, MPI_Info info, int root, MPI_Comm c
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(5, port_name, &obj_id_0, &root, &obj_id_1, &obj_id_2);
-	int sizes[] = { strlen(port_name)+1, sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, root, obj_id_1, obj_id_2 };
+	int tail_size_0 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_accept(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm) { return c_MPI_Comm_accept(port_name, info, root, comm, newcomm); }
 extern void f_mpi_comm_accept(const char* port_name, MPI_Fint* info, int* root, MPI_Fint* comm, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -4834,9 +5761,18 @@ int c_MPI_Type_create_struct(int count, const int array_of_blocklengths[], const
 	int obj_id_0[count];
 	for(int i=0; i<count; i++) obj_id_0[i] = (array_of_types==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &array_of_types[i]);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, array_of_blocklengths, array_of_displacements, obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), count*sizeof(const int), count*sizeof(const MPI_Aint), count*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { count, obj_id_1 };
+	int tail_size_0 = count*sizeof(const int);
+	int tail_size_1 = count*sizeof(const MPI_Aint);
+	int tail_size_2 = count*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, -1);
+	PILGRIM_ENCODE_TAIL(array_of_blocklengths, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_displacements, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_struct(int count, const int array_of_blocklengths[], const MPI_Aint array_of_displacements[], const MPI_Datatype array_of_types[], MPI_Datatype *newtype) { return c_MPI_Type_create_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, newtype); }
 extern void f_mpi_type_create_struct(int* count, const int array_of_blocklengths[], const MPI_Aint array_of_displacements[], MPI_Fint* array_of_types, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -4872,9 +5808,18 @@ int c_MPI_Gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) { return c_MPI_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm); }
 extern void f_mpi_gather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -4901,9 +5846,11 @@ extern void mpi_gather__(const void* sendbuf, int* sendcount, MPI_Fint* sendtype
 int c_MPI_Close_port(const char *port_name)
 {
 	PILGRIM_TRACING_1(int, MPI_Close_port, (port_name));
-	void **args = assemble_args_list(1, port_name);
-	int sizes[] = { strlen(port_name)+1 };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	char scalars[0];
+	int tail_size_0 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Close_port(const char *port_name) { return c_MPI_Close_port(port_name); }
 extern void f_mpi_close_port(const char* port_name, MPI_Fint *ierr) {
@@ -4926,9 +5873,11 @@ int c_MPI_Win_sync(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_sync, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_sync(MPI_Win win) { return c_MPI_Win_sync(win); }
 extern void f_mpi_win_sync(MPI_Fint* win, MPI_Fint *ierr) {
@@ -4954,9 +5903,20 @@ int c_MPI_Type_create_subarray(int ndims, const int array_of_sizes[], const int
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(7, &ndims, array_of_sizes, array_of_subsizes, array_of_starts, &order, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), ndims*sizeof(const int), ndims*sizeof(const int), ndims*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { ndims, order, obj_id_0, obj_id_1 };
+	int tail_size_0 = ndims*sizeof(const int);
+	int tail_size_1 = ndims*sizeof(const int);
+	int tail_size_2 = ndims*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, -1);
+	PILGRIM_ENCODE_TAIL(array_of_sizes, tail_size_0);
+	PILGRIM_ENCODE_TAIL(array_of_subsizes, tail_size_1);
+	PILGRIM_ENCODE_TAIL(array_of_starts, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_subarray(int ndims, const int array_of_sizes[], const int array_of_subsizes[], const int array_of_starts[], int order, MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_subarray(ndims, array_of_sizes, array_of_subsizes, array_of_starts, order, oldtype, newtype); }
 extern void f_mpi_type_create_subarray(int* ndims, const int array_of_sizes[], const int array_of_subsizes[], const int array_of_starts[], int* order, MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -4982,9 +5942,11 @@ extern void mpi_type_create_subarray__(int* ndims, const int array_of_sizes[], c
 int c_MPI_Win_free_keyval(int *win_keyval)
 {
 	PILGRIM_TRACING_1(int, MPI_Win_free_keyval, (win_keyval));
-	void **args = assemble_args_list(1, win_keyval);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (win_keyval ? *win_keyval : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_free_keyval(int *win_keyval) { return c_MPI_Win_free_keyval(win_keyval); }
 extern void f_mpi_win_free_keyval(int* win_keyval, MPI_Fint *ierr) {
@@ -5010,9 +5972,13 @@ int c_MPI_File_write_at_all_end(MPI_File fh, const void *buf, MPI_Status *status
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_at_all_end(MPI_File fh, const void *buf, MPI_Status *status) { return c_MPI_File_write_at_all_end(fh, buf, status); }
 extern void f_mpi_file_write_at_all_end(MPI_Fint* fh, const void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -5053,9 +6019,22 @@ int c_MPI_Rget_accumulate(const void *origin_addr, int origin_count, MPI_Datatyp
 	int obj_id_3 = MPI_OBJ_ID(MPI_Op, &obj_3);
 	MPI_Win obj_4 = win;
 	int obj_id_4 = MPI_OBJ_ID(MPI_Win, &obj_4);
-	void **args = assemble_args_list(12, &mem_attr_0, &origin_count, &obj_id_0, &mem_attr_1, &result_count, &obj_id_1, &target_rank, &target_disp, &target_count, &obj_id_2, &obj_id_3, &obj_id_4);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(12, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		MPI_Aint a7;
+		int a8;
+		int a9;
+		int a10;
+		int a11;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, mem_attr_1, result_count, obj_id_1, target_rank, target_disp, target_count, obj_id_2, obj_id_3, obj_id_4 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Rget_accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, void *result_addr, int result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request) { return c_MPI_Rget_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request); }
 extern void f_mpi_rget_accumulate(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, void* result_addr, int* result_count, MPI_Fint* result_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* op, MPI_Fint* win, MPI_Fint* request, MPI_Fint *ierr) {
@@ -5091,9 +6070,12 @@ int c_MPI_Comm_delete_attr(MPI_Comm comm, int comm_keyval)
 	PILGRIM_TRACING_1(int, MPI_Comm_delete_attr, (comm, comm_keyval));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &comm_keyval);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, comm_keyval };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_delete_attr(MPI_Comm comm, int comm_keyval) { return c_MPI_Comm_delete_attr(comm, comm_keyval); }
 extern void f_mpi_comm_delete_attr(MPI_Fint* comm, int* comm_keyval, MPI_Fint *ierr) {
@@ -5118,9 +6100,11 @@ int c_MPI_Comm_create_errhandler(MPI_Comm_errhandler_function *comm_errhandler_f
 {
 	PILGRIM_TRACING_1(int, MPI_Comm_create_errhandler, (comm_errhandler_fn, errhandler));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, comm_errhandler_fn, &obj_id_0);
-	int sizes[] = { 1*sizeof(MPI_Comm_errhandler_function), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_create_errhandler(MPI_Comm_errhandler_function *comm_errhandler_fn, MPI_Errhandler *errhandler) { return c_MPI_Comm_create_errhandler(comm_errhandler_fn, errhandler); }
 extern void f_mpi_comm_create_errhandler(MPI_Comm_errhandler_function* comm_errhandler_fn, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -5146,9 +6130,11 @@ int c_MPI_Barrier(MPI_Comm comm)
 	PILGRIM_TRACING_1(int, MPI_Barrier, (comm));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Barrier(MPI_Comm comm) { return c_MPI_Barrier(comm); }
 extern void f_mpi_barrier(MPI_Fint* comm, MPI_Fint *ierr) {
@@ -5175,9 +6161,14 @@ int c_MPI_Win_get_attr(MPI_Win win, int win_keyval, void *attribute_val, int *fl
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(4, &obj_id_0, &win_keyval, &mem_attr_0, flag);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+	} scalars = { obj_id_0, win_keyval, mem_attr_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_get_attr(MPI_Win win, int win_keyval, void *attribute_val, int *flag) { return c_MPI_Win_get_attr(win, win_keyval, attribute_val, flag); }
 extern void f_mpi_win_get_attr(MPI_Fint* win, int* win_keyval, void* attribute_val, int* flag, MPI_Fint *ierr) {
@@ -5203,9 +6194,12 @@ int c_MPI_File_get_byte_offset(MPI_File fh, MPI_Offset offset, MPI_Offset *disp)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	append_offset(offset);
-	void **args = assemble_args_list(2, &obj_id_0, disp);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Offset) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Offset a1;
+	} scalars = { obj_id_0, (disp ? *disp : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_byte_offset(MPI_File fh, MPI_Offset offset, MPI_Offset *disp) { return c_MPI_File_get_byte_offset(fh, offset, disp); }
 extern void f_mpi_file_get_byte_offset(MPI_Fint* fh, MPI_Offset offset, MPI_Offset* disp, MPI_Fint *ierr) {
@@ -5230,9 +6224,12 @@ int c_MPI_Win_lock_all(int assert, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_lock_all, (assert, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &assert, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { assert, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_lock_all(int assert, MPI_Win win) { return c_MPI_Win_lock_all(assert, win); }
 extern void f_mpi_win_lock_all(int* assert, MPI_Fint* win, MPI_Fint *ierr) {
@@ -5257,9 +6254,14 @@ int c_MPI_Comm_get_name(MPI_Comm comm, char *comm_name, int *resultlen)
 	PILGRIM_TRACING_1(int, MPI_Comm_get_name, (comm, comm_name, resultlen));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, comm_name, resultlen);
-	int sizes[] = { sizeof(int), strlen(comm_name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(comm_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(comm_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_get_name(MPI_Comm comm, char *comm_name, int *resultlen) { return c_MPI_Comm_get_name(comm, comm_name, resultlen); }
 extern void f_mpi_comm_get_name(MPI_Fint* comm, char* comm_name, int* resultlen, MPI_Fint *ierr) {
@@ -5285,9 +6287,15 @@ int c_MPI_Group_range_excl(MPI_Group group, int n, int ranges[][3], MPI_Group *n
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(4, &obj_id_0, &n, ranges, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), n*3*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, n, obj_id_1 };
+	int tail_size_0 = n*3*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(ranges, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_range_excl(MPI_Group group, int n, int ranges[][3], MPI_Group *newgroup) { return c_MPI_Group_range_excl(group, n, ranges, newgroup); }
 extern void f_mpi_group_range_excl(MPI_Fint* group, int* n, int ranges[][3], MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -5315,9 +6323,15 @@ int c_MPI_T_pvar_handle_alloc(MPI_T_pvar_session session, int pvar_index, void *
 	PILGRIM_TRACING_1(int, MPI_T_pvar_handle_alloc, (session, pvar_index, obj_handle, handle, count));
 	MemPtrAttr mem_attr_0;
 	addr2id(obj_handle, &mem_attr_0);
-	void **args = assemble_args_list(5, &session, &pvar_index, &mem_attr_0, handle, count);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(int), sizeof(MemPtrAttr), 1*sizeof(MPI_T_pvar_handle), 1*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		int a1;
+		MemPtrAttr a2;
+		MPI_T_pvar_handle a3;
+		int a4;
+	} scalars = { session, pvar_index, mem_attr_0, (handle ? *handle : 0), (count ? *count : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_handle_alloc(MPI_T_pvar_session session, int pvar_index, void *obj_handle, MPI_T_pvar_handle *handle, int *count) { return c_MPI_T_pvar_handle_alloc(session, pvar_index, obj_handle, handle, count); }
 int c_MPI_File_read_ordered_begin(MPI_File fh, void *buf, int count, MPI_Datatype datatype)
@@ -5329,9 +6343,14 @@ int c_MPI_File_read_ordered_begin(MPI_File fh, void *buf, int count, MPI_Datatyp
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_ordered_begin(MPI_File fh, void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_read_ordered_begin(fh, buf, count, datatype); }
 extern void f_mpi_file_read_ordered_begin(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -5364,9 +6383,15 @@ int c_MPI_File_read_ordered(MPI_File fh, void *buf, int count, MPI_Datatype data
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_ordered(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read_ordered(fh, buf, count, datatype, status); }
 extern void f_mpi_file_read_ordered(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -5397,9 +6422,12 @@ int c_MPI_Attr_delete(MPI_Comm comm, int keyval)
 	PILGRIM_TRACING_1(int, MPI_Attr_delete, (comm, keyval));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &keyval);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, keyval };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Attr_delete(MPI_Comm comm, int keyval) { return c_MPI_Attr_delete(comm, keyval); }
 extern void f_mpi_attr_delete(MPI_Fint* comm, int* keyval, MPI_Fint *ierr) {
@@ -5426,9 +6454,12 @@ int c_MPI_Win_get_errhandler(MPI_Win win, MPI_Errhandler *errhandler)
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_get_errhandler(MPI_Win win, MPI_Errhandler *errhandler) { return c_MPI_Win_get_errhandler(win, errhandler); }
 extern void f_mpi_win_get_errhandler(MPI_Fint* win, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -5457,9 +6488,12 @@ int c_MPI_File_get_info(MPI_File fh, MPI_Info *info_used)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, info_used);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_info(MPI_File fh, MPI_Info *info_used) { return c_MPI_File_get_info(fh, info_used); }
 extern void f_mpi_file_get_info(MPI_Fint* fh, MPI_Fint* info_used, MPI_Fint *ierr) {
@@ -5488,9 +6522,12 @@ int c_MPI_Info_dup(MPI_Info info, MPI_Info *newinfo)
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, newinfo);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_dup(MPI_Info info, MPI_Info *newinfo) { return c_MPI_Info_dup(info, newinfo); }
 extern void f_mpi_info_dup(MPI_Fint* info, MPI_Fint* newinfo, MPI_Fint *ierr) {
@@ -5523,9 +6560,15 @@ int c_MPI_File_write_shared(MPI_File fh, const void *buf, int count, MPI_Datatyp
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_shared(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write_shared(fh, buf, count, datatype, status); }
 extern void f_mpi_file_write_shared(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -5561,9 +6604,14 @@ int c_MPI_File_iread_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MP
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iread_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iread_at(fh, offset, buf, count, datatype, request); }
 extern void f_mpi_file_iread_at(MPI_Fint* fh, MPI_Offset offset, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -5596,9 +6644,13 @@ int c_MPI_File_write_all_end(MPI_File fh, const void *buf, MPI_Status *status)
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_all_end(MPI_File fh, const void *buf, MPI_Status *status) { return c_MPI_File_write_all_end(fh, buf, status); }
 extern void f_mpi_file_write_all_end(MPI_Fint* fh, const void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -5624,12 +6676,15 @@ extern void mpi_file_write_all_end__(MPI_Fint* fh, const void* buf, MPI_Fint* st
 }
 int c_MPI_Comm_remote_size(MPI_Comm comm, int *size)
 {
-	PILGRIM_TRACING_1(int, MPI_Comm_remote_size, (comm, size));
+	PILGRIM_QUERY_1(int, MPI_Comm_remote_size, (comm, size));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Comm_remote_size(MPI_Comm comm, int *size) { return c_MPI_Comm_remote_size(comm, size); }
 extern void f_mpi_comm_remote_size(MPI_Fint* comm, int* size, MPI_Fint *ierr) {
@@ -5654,9 +6709,14 @@ int c_MPI_Type_get_name(MPI_Datatype datatype, char *type_name, int *resultlen)
 	PILGRIM_TRACING_1(int, MPI_Type_get_name, (datatype, type_name, resultlen));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, type_name, resultlen);
-	int sizes[] = { sizeof(int), strlen(type_name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(type_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(type_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_get_name(MPI_Datatype datatype, char *type_name, int *resultlen) { return c_MPI_Type_get_name(datatype, type_name, resultlen); }
 extern void f_mpi_type_get_name(MPI_Fint* datatype, char* type_name, int* resultlen, MPI_Fint *ierr) {
@@ -5687,9 +6747,15 @@ int c_MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, const void *buf, int
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write_at_all(fh, offset, buf, count, datatype, status); }
 extern void f_mpi_file_write_at_all(MPI_Fint* fh, MPI_Offset offset, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -5721,9 +6787,12 @@ int c_MPI_File_get_group(MPI_File fh, MPI_Group *group)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, group);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_group(MPI_File fh, MPI_Group *group) { return c_MPI_File_get_group(fh, group); }
 extern void f_mpi_file_get_group(MPI_Fint* fh, MPI_Fint* group, MPI_Fint *ierr) {
@@ -5752,9 +6821,11 @@ int c_MPI_File_preallocate(MPI_File fh, MPI_Offset size)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	append_offset(size);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_preallocate(MPI_File fh, MPI_Offset size) { return c_MPI_File_preallocate(fh, size); }
 extern void f_mpi_file_preallocate(MPI_Fint* fh, MPI_Offset size, MPI_Fint *ierr) {
@@ -5784,9 +6855,14 @@ int c_MPI_File_iread_all(MPI_File fh, void *buf, int count, MPI_Datatype datatyp
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iread_all(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iread_all(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iread_all(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -5817,9 +6893,12 @@ int c_MPI_T_cvar_write(MPI_T_cvar_handle handle, const void *buf)
 	PILGRIM_TRACING_1(int, MPI_T_cvar_write, (handle, buf));
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
-	void **args = assemble_args_list(2, &handle, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_T_cvar_handle), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_cvar_handle a0;
+		MemPtrAttr a1;
+	} scalars = { handle, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_write(MPI_T_cvar_handle handle, const void *buf) { return c_MPI_T_cvar_write(handle, buf); }
 int c_MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[], MPI_Group group2, int ranks2[])
@@ -5829,9 +6908,17 @@ int c_MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[], MPI
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	MPI_Group obj_1 = group2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
-	void **args = assemble_args_list(5, &obj_id_0, &n, ranks1, &obj_id_1, ranks2);
-	int sizes[] = { sizeof(int), sizeof(int), n*sizeof(const int), sizeof(int), n*sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, n, obj_id_1 };
+	int tail_size_0 = n*sizeof(const int);
+	int tail_size_1 = n*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(ranks1, tail_size_0);
+	PILGRIM_ENCODE_TAIL(ranks2, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[], MPI_Group group2, int ranks2[]) { return c_MPI_Group_translate_ranks(group1, n, ranks1, group2, ranks2); }
 extern void f_mpi_group_translate_ranks(MPI_Fint* group1, int* n, const int ranks1[], MPI_Fint* group2, int ranks2[], MPI_Fint *ierr) {
@@ -5859,9 +6946,15 @@ int c_MPI_Type_create_hvector(int count, int blocklength, MPI_Aint stride, MPI_D
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, &blocklength, &stride, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MPI_Aint a2;
+		int a3;
+		int a4;
+	} scalars = { count, blocklength, stride, obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_hvector(int count, int blocklength, MPI_Aint stride, MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_create_hvector(count, blocklength, stride, oldtype, newtype); }
 extern void f_mpi_type_create_hvector(int* count, int* blocklength, MPI_Aint stride, MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -5891,9 +6984,14 @@ int c_MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(4, &obj_id_0, &comm_keyval, &mem_attr_0, flag);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+	} scalars = { obj_id_0, comm_keyval, mem_attr_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag) { return c_MPI_Comm_get_attr(comm, comm_keyval, attribute_val, flag); }
 extern void f_mpi_comm_get_attr(MPI_Fint* comm, int* comm_keyval, void* attribute_val, int* flag, MPI_Fint *ierr) {
@@ -5915,10 +7013,12 @@ extern void mpi_comm_get_attr__(MPI_Fint* comm, int* comm_keyval, void* attribut
 }
 int c_MPI_Initialized(int *flag)
 {
-	PILGRIM_TRACING_1(int, MPI_Initialized, (flag));
-	void **args = assemble_args_list(1, flag);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Initialized, (flag));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Initialized(int *flag) { return c_MPI_Initialized(flag); }
 extern void f_mpi_initialized(int* flag, MPI_Fint *ierr) {
@@ -5938,6 +7038,11 @@ extern void mpi_initialized__(int* flag, MPI_Fint *ierr) {
 }
 int c_MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_create_group)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_create_group, (comm, group, tag, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_create_group, (comm, group, tag, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
@@ -5947,9 +7052,14 @@ int c_MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag, MPI_Comm *n
 	int my_tag = tag;
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(4, &obj_id_0, &obj_id_1, &my_tag, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, obj_id_1, my_tag, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag, MPI_Comm *newcomm) { return c_MPI_Comm_create_group(comm, group, tag, newcomm); }
 extern void f_mpi_comm_create_group(MPI_Fint* comm, MPI_Fint* group, int* tag, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -5979,9 +7089,11 @@ int c_MPI_Grequest_complete(MPI_Request request)
 	PILGRIM_TRACING_1(int, MPI_Grequest_complete, (request));
 	MPI_Request obj_0 = request;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Request, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Grequest_complete(MPI_Request request) { return c_MPI_Grequest_complete(request); }
 extern void f_mpi_grequest_complete(MPI_Fint* request, MPI_Fint *ierr) {
@@ -6019,9 +7131,22 @@ int c_MPI_Get_accumulate(const void *origin_addr, int origin_count, MPI_Datatype
 	int obj_id_3 = MPI_OBJ_ID(MPI_Op, &obj_3);
 	MPI_Win obj_4 = win;
 	int obj_id_4 = MPI_OBJ_ID(MPI_Win, &obj_4);
-	void **args = assemble_args_list(12, &mem_attr_0, &origin_count, &obj_id_0, &mem_attr_1, &result_count, &obj_id_1, &target_rank, &target_disp, &target_count, &obj_id_2, &obj_id_3, &obj_id_4);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(12, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		MPI_Aint a7;
+		int a8;
+		int a9;
+		int a10;
+		int a11;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, mem_attr_1, result_count, obj_id_1, target_rank, target_disp, target_count, obj_id_2, obj_id_3, obj_id_4 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Get_accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, void *result_addr, int result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win) { return c_MPI_Get_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win); }
 extern void f_mpi_get_accumulate(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, void* result_addr, int* result_count, MPI_Fint* result_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* op, MPI_Fint* win, MPI_Fint *ierr) {
@@ -6053,9 +7178,11 @@ int c_MPI_Win_create_errhandler(MPI_Win_errhandler_function *win_errhandler_fn,
 {
 	PILGRIM_TRACING_1(int, MPI_Win_create_errhandler, (win_errhandler_fn, errhandler));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, win_errhandler_fn, &obj_id_0);
-	int sizes[] = { 1*sizeof(MPI_Win_errhandler_function), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_create_errhandler(MPI_Win_errhandler_function *win_errhandler_fn, MPI_Errhandler *errhandler) { return c_MPI_Win_create_errhandler(win_errhandler_fn, errhandler); }
 extern void f_mpi_win_create_errhandler(MPI_Win_errhandler_function* win_errhandler_fn, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -6081,9 +7208,12 @@ int c_MPI_Win_fence(int assert, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_fence, (assert, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &assert, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { assert, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_fence(int assert, MPI_Win win) { return c_MPI_Win_fence(assert, win); }
 extern void f_mpi_win_fence(int* assert, MPI_Fint* win, MPI_Fint *ierr) {
@@ -6106,9 +7236,20 @@ extern void mpi_win_fence__(int* assert, MPI_Fint* win, MPI_Fint *ierr) {
 int c_MPI_T_category_get_info(int cat_index, char *name, int *name_len, char *desc, int *desc_len, int *num_cvars, int *num_pvars, int *num_categories)
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_info, (cat_index, name, name_len, desc, desc_len, num_cvars, num_pvars, num_categories));
-	void **args = assemble_args_list(8, &cat_index, name, name_len, desc, desc_len, num_cvars, num_pvars, num_categories);
-	int sizes[] = { sizeof(int), strlen(name)+1, 1*sizeof(int), strlen(desc)+1, 1*sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { cat_index, (name_len ? *name_len : 0), (desc_len ? *desc_len : 0), (num_cvars ? *num_cvars : 0), (num_pvars ? *num_pvars : 0), (num_categories ? *num_categories : 0) };
+	int tail_size_0 = strlen(name)+1;
+	int tail_size_1 = strlen(desc)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(desc, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_info(int cat_index, char *name, int *name_len, char *desc, int *desc_len, int *num_cvars, int *num_pvars, int *num_categories) { return c_MPI_T_category_get_info(cat_index, name, name_len, desc, desc_len, num_cvars, num_pvars, num_categories); }
 int c_MPI_Group_difference(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup)
@@ -6119,9 +7260,13 @@ int c_MPI_Group_difference(MPI_Group group1, MPI_Group group2, MPI_Group *newgro
 	MPI_Group obj_1 = group2;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_difference(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup) { return c_MPI_Group_difference(group1, group2, newgroup); }
 extern void f_mpi_group_difference(MPI_Fint* group1, MPI_Fint* group2, MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -6149,9 +7294,12 @@ extern void mpi_group_difference__(MPI_Fint* group1, MPI_Fint* group2, MPI_Fint*
 int c_MPI_T_pvar_start(MPI_T_pvar_session session, MPI_T_pvar_handle handle)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_start, (session, handle));
-	void **args = assemble_args_list(2, &session, &handle);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+	} scalars = { session, handle };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_start(MPI_T_pvar_session session, MPI_T_pvar_handle handle) { return c_MPI_T_pvar_start(session, handle); }
 int c_MPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen)
@@ -6159,9 +7307,14 @@ int c_MPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen)
 	PILGRIM_TRACING_1(int, MPI_Win_get_name, (win, win_name, resultlen));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, win_name, resultlen);
-	int sizes[] = { sizeof(int), strlen(win_name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(win_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(win_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen) { return c_MPI_Win_get_name(win, win_name, resultlen); }
 extern void f_mpi_win_get_name(MPI_Fint* win, char* win_name, int* resultlen, MPI_Fint *ierr) {
@@ -6186,9 +7339,11 @@ int c_MPI_Win_wait(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_wait, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_wait(MPI_Win win) { return c_MPI_Win_wait(win); }
 extern void f_mpi_win_wait(MPI_Fint* win, MPI_Fint *ierr) {
@@ -6223,9 +7378,21 @@ int c_MPI_Scatterv(const void *sendbuf, const int sendcounts[], const int displs
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, displs, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Scatterv(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) { return c_MPI_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm); }
 extern void f_mpi_scatterv(const void* sendbuf, const int sendcounts[], const int displs[], MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -6261,9 +7428,15 @@ int c_MPI_File_write_all(MPI_File fh, const void *buf, int count, MPI_Datatype d
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_all(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write_all(fh, buf, count, datatype, status); }
 extern void f_mpi_file_write_all(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -6291,6 +7464,11 @@ extern void mpi_file_write_all__(MPI_Fint* fh, const void* buf, int* count, MPI_
 }
 int c_MPI_Comm_connect(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_connect)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_connect, (port_name, info, root, comm, newcomm));
+		generate_intercomm_id(comm, newcomm, 0);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_connect, (port_name, info, root, comm, newcomm));
 	generate_intercomm_id(comm, newcomm, 0);
 	MPI_Info obj_0 = info;
@@ -6298,9 +7476,16 @@ int c_MPI_Comm_connect(const char *port_name, MPI_Info info, int root, MPI_Comm
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(5, port_name, &obj_id_0, &root, &obj_id_1, &obj_id_2);
-	int sizes[] = { strlen(port_name)+1, sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, root, obj_id_1, obj_id_2 };
+	int tail_size_0 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_connect(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm) { return c_MPI_Comm_connect(port_name, info, root, comm, newcomm); }
 extern void f_mpi_comm_connect(const char* port_name, MPI_Fint* info, int* root, MPI_Fint* comm, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -6330,9 +7515,11 @@ int c_MPI_Win_flush_all(MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_flush_all, (win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_flush_all(MPI_Win win) { return c_MPI_Win_flush_all(win); }
 extern void f_mpi_win_flush_all(MPI_Fint* win, MPI_Fint *ierr) {
@@ -6358,9 +7545,12 @@ int c_MPI_Win_get_group(MPI_Win win, MPI_Group *group)
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, group);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_get_group(MPI_Win win, MPI_Group *group) { return c_MPI_Win_get_group(win, group); }
 extern void f_mpi_win_get_group(MPI_Fint* win, MPI_Fint* group, MPI_Fint *ierr) {
@@ -6389,9 +7579,11 @@ int c_MPI_File_set_size(MPI_File fh, MPI_Offset size)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	append_offset(size);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_set_size(MPI_File fh, MPI_Offset size) { return c_MPI_File_set_size(fh, size); }
 extern void f_mpi_file_set_size(MPI_Fint* fh, MPI_Offset size, MPI_Fint *ierr) {
@@ -6416,9 +7608,12 @@ int c_MPI_Status_set_cancelled(MPI_Status *status, int flag)
 {
 	PILGRIM_TRACING_1(int, MPI_Status_set_cancelled, (status, flag));
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(2, status_arg, &flag);
-	int sizes[] = { sizeof(int)*2, sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0[2];
+		int a1;
+	} scalars = { {status_arg[0], status_arg[1]}, flag };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Status_set_cancelled(MPI_Status *status, int flag) { return c_MPI_Status_set_cancelled(status, flag); }
 extern void f_mpi_status_set_cancelled(MPI_Fint* status, int* flag, MPI_Fint *ierr) {
@@ -6450,9 +7645,15 @@ int c_MPI_Reduce_local(const void *inbuf, void *inoutbuf, int count, MPI_Datatyp
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Op obj_1 = op;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
-	void **args = assemble_args_list(5, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Reduce_local(const void *inbuf, void *inoutbuf, int count, MPI_Datatype datatype, MPI_Op op) { return c_MPI_Reduce_local(inbuf, inoutbuf, count, datatype, op); }
 extern void f_mpi_reduce_local(const void* inbuf, void* inoutbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint *ierr) {
@@ -6479,9 +7680,13 @@ int c_MPI_T_pvar_write(MPI_T_pvar_session session, MPI_T_pvar_handle handle, con
 	PILGRIM_TRACING_1(int, MPI_T_pvar_write, (session, handle, buf));
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
-	void **args = assemble_args_list(3, &session, &handle, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+		MemPtrAttr a2;
+	} scalars = { session, handle, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_write(MPI_T_pvar_session session, MPI_T_pvar_handle handle, const void *buf) { return c_MPI_T_pvar_write(session, handle, buf); }
 int c_MPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors, int neighbors[])
@@ -6489,9 +7694,15 @@ int c_MPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors, int neighbo
 	PILGRIM_TRACING_1(int, MPI_Graph_neighbors, (comm, rank, maxneighbors, neighbors));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(4, &obj_id_0, &rank, &maxneighbors, neighbors);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), maxneighbors*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, rank, maxneighbors };
+	int tail_size_0 = maxneighbors*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(neighbors, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors, int neighbors[]) { return c_MPI_Graph_neighbors(comm, rank, maxneighbors, neighbors); }
 extern void f_mpi_graph_neighbors(MPI_Fint* comm, int* rank, int* maxneighbors, int neighbors[], MPI_Fint *ierr) {
@@ -6514,9 +7725,14 @@ extern void mpi_graph_neighbors__(MPI_Fint* comm, int* rank, int* maxneighbors,
 int c_MPI_Dims_create(int nnodes, int ndims, int dims[])
 {
 	PILGRIM_TRACING_1(int, MPI_Dims_create, (nnodes, ndims, dims));
-	void **args = assemble_args_list(3, &nnodes, &ndims, dims);
-	int sizes[] = { sizeof(int), sizeof(int), ndims*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { nnodes, ndims };
+	int tail_size_0 = ndims*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(dims, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Dims_create(int nnodes, int ndims, int dims[]) { return c_MPI_Dims_create(nnodes, ndims, dims); }
 extern void f_mpi_dims_create(int* nnodes, int* ndims, int dims[], MPI_Fint *ierr) {
@@ -6547,9 +7763,18 @@ int c_MPI_Scatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, voi
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Scatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) { return c_MPI_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm); }
 extern void f_mpi_scatter(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -6586,9 +7811,16 @@ int c_MPI_Ireduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcoun
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &recvcount, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, recvcount, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ireduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ireduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm, request); }
 extern void f_mpi_ireduce_scatter_block(const void* sendbuf, void* recvbuf, int* recvcount, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -6630,9 +7862,25 @@ int c_MPI_Ialltoallw(const void *sendbuf, const int sendcounts[], const int sdis
 	for(int i=0; i<comm_size; i++) obj_id_1[i] = (recvtypes==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &recvtypes[i]);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, obj_id_0, &mem_attr_1, recvcounts, rdispls, obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), (comm_size)*sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), (comm_size)*sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = (comm_size)*sizeof(int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	int tail_size_4 = comm_size*sizeof(const int);
+	int tail_size_5 = (comm_size)*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3 + tail_size_4 + tail_size_5, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_2);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_3);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_4);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_1, tail_size_5);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ialltoallw(const void *sendbuf, const int sendcounts[], const int sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const int rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request) { return c_MPI_Ialltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request); }
 extern void f_mpi_ialltoallw(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtypes, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtypes, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -6676,9 +7924,23 @@ int c_MPI_Ialltoallv(const void *sendbuf, const int sendcounts[], const int sdis
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, &obj_id_0, &mem_attr_1, recvcounts, rdispls, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = comm_size*sizeof(const int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_2);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ialltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request); }
 extern void f_mpi_ialltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -6709,12 +7971,19 @@ extern void mpi_ialltoallv__(const void* sendbuf, const int sendcounts[], const
 }
 int c_MPI_Comm_free(MPI_Comm *comm)
 {
+	if(logger_paused(ID_MPI_Comm_free)) {
+		MPI_OBJ_RELEASE(MPI_Comm, comm);
+		PILGRIM_PMPI_CALL(int, MPI_Comm_free, (comm));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, comm);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Comm, comm);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Comm_free, (comm));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_free(MPI_Comm *comm) { return c_MPI_Comm_free(comm); }
 extern void f_mpi_comm_free(MPI_Fint* comm, MPI_Fint *ierr) {
@@ -6740,9 +8009,12 @@ int c_MPI_T_cvar_read(MPI_T_cvar_handle handle, void *buf)
 	PILGRIM_TRACING_1(int, MPI_T_cvar_read, (handle, buf));
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
-	void **args = assemble_args_list(2, &handle, &mem_attr_0);
-	int sizes[] = { sizeof(MPI_T_cvar_handle), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_cvar_handle a0;
+		MemPtrAttr a1;
+	} scalars = { handle, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_read(MPI_T_cvar_handle handle, void *buf) { return c_MPI_T_cvar_read(handle, buf); }
 int c_MPI_Neighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm)
@@ -6758,9 +8030,17 @@ int c_MPI_Neighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sen
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Neighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Neighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm); }
 extern void f_mpi_neighbor_alltoall(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -6797,9 +8077,17 @@ int c_MPI_Alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, vo
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm); }
 extern void f_mpi_alltoall(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -6825,6 +8113,11 @@ extern void mpi_alltoall__(const void* sendbuf, int* sendcount, MPI_Fint* sendty
 }
 int c_MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[])
 {
+	if(logger_paused(ID_MPI_Comm_spawn_multiple)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_spawn_multiple, (count, array_of_commands, array_of_argv, array_of_maxprocs, array_of_info, root, comm, intercomm, array_of_errcodes));
+		generate_intercomm_id(comm, intercomm, 0);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_spawn_multiple, (count, array_of_commands, array_of_argv, array_of_maxprocs, array_of_info, root, comm, intercomm, array_of_errcodes));
 	generate_intercomm_id(comm, intercomm, 0);
 	int comm_size;
@@ -6834,9 +8127,20 @@ int c_MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, intercomm);
-	void **args = assemble_args_list(9, &count, array_of_commands, array_of_argv, array_of_maxprocs, obj_id_0, &root, &obj_id_1, &obj_id_2, array_of_errcodes);
-	int sizes[] = { sizeof(int), count*sizeof(const int), count*sizeof(int), sizeof(int), sizeof(int), sizeof(int), comm_size*sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { count, root, obj_id_1, obj_id_2 };
+	int tail_size_0 = count*sizeof(const int);
+	int tail_size_1 = count*sizeof(int);
+	int tail_size_2 = comm_size*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2, comm_size);
+	PILGRIM_ENCODE_TAIL(array_of_maxprocs, tail_size_0);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_1);
+	PILGRIM_ENCODE_TAIL(array_of_errcodes, tail_size_2);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]) { return c_MPI_Comm_spawn_multiple(count, array_of_commands, array_of_argv, array_of_maxprocs, array_of_info, root, comm, intercomm, array_of_errcodes); }
 extern void f_mpi_comm_spawn_multiple(int* count, char* array_of_commands[], char** array_of_argv[], const int array_of_maxprocs[], MPI_Fint* array_of_info, int* root, MPI_Fint* comm, MPI_Fint* intercomm, int array_of_errcodes[], MPI_Fint *ierr) {
@@ -6865,6 +8169,11 @@ extern void mpi_comm_spawn_multiple__(int* count, char* array_of_commands[], cha
 }
 int c_MPI_Comm_dup_with_info(MPI_Comm comm, MPI_Info info, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_dup_with_info)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_dup_with_info, (comm, info, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_dup_with_info, (comm, info, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
@@ -6872,9 +8181,13 @@ int c_MPI_Comm_dup_with_info(MPI_Comm comm, MPI_Info info, MPI_Comm *newcomm)
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_dup_with_info(MPI_Comm comm, MPI_Info info, MPI_Comm *newcomm) { return c_MPI_Comm_dup_with_info(comm, info, newcomm); }
 extern void f_mpi_comm_dup_with_info(MPI_Fint* comm, MPI_Fint* info, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -6902,19 +8215,29 @@ extern void mpi_comm_dup_with_info__(MPI_Fint* comm, MPI_Fint* info, MPI_Fint* n
 int c_MPI_T_pvar_handle_free(MPI_T_pvar_session session, MPI_T_pvar_handle *handle)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_handle_free, (session, handle));
-	void **args = assemble_args_list(2, &session, handle);
-	int sizes[] = { sizeof(MPI_T_pvar_session), 1*sizeof(MPI_T_pvar_handle) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+	} scalars = { session, (handle ? *handle : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_handle_free(MPI_T_pvar_session session, MPI_T_pvar_handle *handle) { return c_MPI_T_pvar_handle_free(session, handle); }
 int c_MPI_Type_free(MPI_Datatype *datatype)
 {
+	if(logger_paused(ID_MPI_Type_free)) {
+		MPI_OBJ_RELEASE(MPI_Datatype, datatype);
+		PILGRIM_PMPI_CALL(int, MPI_Type_free, (datatype));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, datatype);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Datatype, datatype);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Type_free, (datatype));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_free(MPI_Datatype *datatype) { return c_MPI_Type_free(datatype); }
 extern void f_mpi_type_free(MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -6940,9 +8263,12 @@ int c_MPI_Win_test(MPI_Win win, int *flag)
 	PILGRIM_TRACING_1(int, MPI_Win_test, (win, flag));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, flag);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_test(MPI_Win win, int *flag) { return c_MPI_Win_test(win, flag); }
 extern void f_mpi_win_test(MPI_Fint* win, int* flag, MPI_Fint *ierr) {
@@ -6972,9 +8298,14 @@ int c_MPI_File_write_at_all_begin(MPI_File fh, MPI_Offset offset, const void *bu
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_at_all_begin(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_write_at_all_begin(fh, offset, buf, count, datatype); }
 extern void f_mpi_file_write_at_all_begin(MPI_Fint* fh, MPI_Offset offset, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -7003,9 +8334,12 @@ int c_MPI_Comm_get_errhandler(MPI_Comm comm, MPI_Errhandler *errhandler)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_get_errhandler(MPI_Comm comm, MPI_Errhandler *errhandler) { return c_MPI_Comm_get_errhandler(comm, errhandler); }
 extern void f_mpi_comm_get_errhandler(MPI_Fint* comm, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -7042,9 +8376,15 @@ int c_MPI_Mprobe(int source, int tag, MPI_Comm comm, MPI_Message *message, MPI_S
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(tag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(5, &source_rank, &my_tag, &obj_id_0, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { source_rank, my_tag, obj_id_0, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Mprobe(int source, int tag, MPI_Comm comm, MPI_Message *message, MPI_Status *status) { return c_MPI_Mprobe(source, tag, comm, message, status); }
 extern void f_mpi_mprobe(int* source, int* tag, MPI_Fint* comm, MPI_Fint* message, MPI_Fint* status, MPI_Fint *ierr) {
@@ -7075,9 +8415,12 @@ int c_MPI_Info_get_nkeys(MPI_Info info, int *nkeys)
 	PILGRIM_TRACING_1(int, MPI_Info_get_nkeys, (info, nkeys));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, nkeys);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (nkeys ? *nkeys : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_get_nkeys(MPI_Info info, int *nkeys) { return c_MPI_Info_get_nkeys(info, nkeys); }
 extern void f_mpi_info_get_nkeys(MPI_Fint* info, int* nkeys, MPI_Fint *ierr) {
@@ -7099,10 +8442,12 @@ extern void mpi_info_get_nkeys__(MPI_Fint* info, int* nkeys, MPI_Fint *ierr) {
 }
 int c_MPI_Finalized(int *flag)
 {
-	PILGRIM_TRACING_1(int, MPI_Finalized, (flag));
-	void **args = assemble_args_list(1, flag);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Finalized, (flag));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (flag ? *flag : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Finalized(int *flag) { return c_MPI_Finalized(flag); }
 extern void f_mpi_finalized(int* flag, MPI_Fint *ierr) {
@@ -7125,9 +8470,12 @@ int c_MPI_Op_commutative(MPI_Op op, int *commute)
 	PILGRIM_TRACING_1(int, MPI_Op_commutative, (op, commute));
 	MPI_Op obj_0 = op;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Op, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, commute);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (commute ? *commute : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Op_commutative(MPI_Op op, int *commute) { return c_MPI_Op_commutative(op, commute); }
 extern void f_mpi_op_commutative(MPI_Fint* op, int* commute, MPI_Fint *ierr) {
@@ -7149,6 +8497,11 @@ extern void mpi_op_commutative__(MPI_Fint* op, int* commute, MPI_Fint *ierr) {
 }
 int c_MPI_Dist_graph_create_adjacent(MPI_Comm comm_old, int indegree, const int sources[], const int sourceweights[], int outdegree, const int destinations[], const int destweights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph)
 {
+	if(logger_paused(ID_MPI_Dist_graph_create_adjacent)) {
+		PILGRIM_PMPI_CALL(int, MPI_Dist_graph_create_adjacent, (comm_old, indegree, sources, sourceweights, outdegree, destinations, destweights, info, reorder, comm_dist_graph));
+		generate_intracomm_id(comm_dist_graph);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Dist_graph_create_adjacent, (comm_old, indegree, sources, sourceweights, outdegree, destinations, destweights, info, reorder, comm_dist_graph));
 	generate_intracomm_id(comm_dist_graph);
 	MPI_Comm obj_0 = comm_old;
@@ -7156,9 +8509,22 @@ int c_MPI_Dist_graph_create_adjacent(MPI_Comm comm_old, int indegree, const int
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, comm_dist_graph);
-	void **args = assemble_args_list(10, &obj_id_0, &indegree, sources, sourceweights, &outdegree, destinations, destweights, &obj_id_1, &reorder, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), indegree*sizeof(const int), 1*sizeof(const int), sizeof(int), outdegree*sizeof(const int), 1*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(10, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { obj_id_0, indegree, (sourceweights ? *sourceweights : 0), outdegree, (destweights ? *destweights : 0), obj_id_1, reorder, obj_id_2 };
+	int tail_size_0 = indegree*sizeof(const int);
+	int tail_size_1 = outdegree*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(sources, tail_size_0);
+	PILGRIM_ENCODE_TAIL(destinations, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Dist_graph_create_adjacent(MPI_Comm comm_old, int indegree, const int sources[], const int sourceweights[], int outdegree, const int destinations[], const int destweights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph) { return c_MPI_Dist_graph_create_adjacent(comm_old, indegree, sources, sourceweights, outdegree, destinations, destweights, info, reorder, comm_dist_graph); }
 extern void f_mpi_dist_graph_create_adjacent(MPI_Fint* comm_old, int* indegree, const int sources[], const int sourceweights[], int* outdegree, const int destinations[], const int destweights[], MPI_Fint* info, int* reorder, MPI_Fint* comm_dist_graph, MPI_Fint *ierr) {
@@ -7188,9 +8554,13 @@ int c_MPI_Info_delete(MPI_Info info, const char *key)
 	PILGRIM_TRACING_1(int, MPI_Info_delete, (info, key));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, key);
-	int sizes[] = { sizeof(int), strlen(key)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(key)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(key, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_delete(MPI_Info info, const char *key) { return c_MPI_Info_delete(info, key); }
 extern void f_mpi_info_delete(MPI_Fint* info, const char* key, MPI_Fint *ierr) {
@@ -7221,9 +8591,14 @@ int c_MPI_File_iread_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iread_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iread_at_all(fh, offset, buf, count, datatype, request); }
 extern void f_mpi_file_iread_at_all(MPI_Fint* fh, MPI_Offset offset, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -7255,9 +8630,15 @@ int c_MPI_Cart_rank(MPI_Comm comm, const int coords[], int *rank)
 	PMPI_Comm_size(comm, &comm_size);
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, coords, rank);
-	int sizes[] = { sizeof(int), comm_size*sizeof(const int), comm_size*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(coords, tail_size_0);
+	PILGRIM_ENCODE_TAIL(rank, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_rank(MPI_Comm comm, const int coords[], int *rank) { return c_MPI_Cart_rank(comm, coords, rank); }
 extern void f_mpi_cart_rank(MPI_Fint* comm, const int coords[], int* rank, MPI_Fint *ierr) {
@@ -7290,9 +8671,15 @@ int c_MPI_File_read_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read_at(fh, offset, buf, count, datatype, status); }
 extern void f_mpi_file_read_at(MPI_Fint* fh, MPI_Offset offset, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -7330,9 +8717,16 @@ int c_MPI_Iallreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iallreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request); }
 extern void f_mpi_iallreduce(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -7361,12 +8755,15 @@ extern void mpi_iallreduce__(const void* sendbuf, void* recvbuf, int* count, MPI
 }
 int c_MPI_Type_size(MPI_Datatype datatype, int *size)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_size, (datatype, size));
+	PILGRIM_QUERY_1(int, MPI_Type_size, (datatype, size));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_size(MPI_Datatype datatype, int *size) { return c_MPI_Type_size(datatype, size); }
 extern void f_mpi_type_size(MPI_Fint* datatype, int* size, MPI_Fint *ierr) {
@@ -7399,9 +8796,17 @@ int c_MPI_Fetch_and_op(const void *origin_addr, void *result_addr, MPI_Datatype
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Win obj_2 = win;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &mem_attr_1, &obj_id_0, &target_rank, &target_disp, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_0, target_rank, target_disp, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Fetch_and_op(const void *origin_addr, void *result_addr, MPI_Datatype datatype, int target_rank, MPI_Aint target_disp, MPI_Op op, MPI_Win win) { return c_MPI_Fetch_and_op(origin_addr, result_addr, datatype, target_rank, target_disp, op, win); }
 extern void f_mpi_fetch_and_op(const void* origin_addr, void* result_addr, MPI_Fint* datatype, int* target_rank, MPI_Aint target_disp, MPI_Fint* op, MPI_Fint* win, MPI_Fint *ierr) {
@@ -7438,9 +8843,16 @@ int c_MPI_Reduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcount
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &recvcount, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, recvcount, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Reduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) { return c_MPI_Reduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm); }
 extern void f_mpi_reduce_scatter_block(const void* sendbuf, void* recvbuf, int* recvcount, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -7475,9 +8887,18 @@ int c_MPI_Rget(void *origin_addr, int origin_count, MPI_Datatype origin_datatype
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Win obj_2 = win;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Rget(void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request) { return c_MPI_Rget(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request); }
 extern void f_mpi_rget(void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* win, MPI_Fint* request, MPI_Fint *ierr) {
@@ -7511,9 +8932,13 @@ int c_MPI_Win_set_attr(MPI_Win win, int win_keyval, void *attribute_val)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(3, &obj_id_0, &win_keyval, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+	} scalars = { obj_id_0, win_keyval, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_set_attr(MPI_Win win, int win_keyval, void *attribute_val) { return c_MPI_Win_set_attr(win, win_keyval, attribute_val); }
 extern void f_mpi_win_set_attr(MPI_Fint* win, int* win_keyval, void* attribute_val, MPI_Fint *ierr) {
@@ -7538,9 +8963,12 @@ int c_MPI_Type_create_f90_integer(int r, MPI_Datatype *newtype)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_create_f90_integer, (r, newtype));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(2, &r, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { r, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_f90_integer(int r, MPI_Datatype *newtype) { return c_MPI_Type_create_f90_integer(r, newtype); }
 extern void f_mpi_type_create_f90_integer(int* r, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -7576,9 +9004,21 @@ int c_MPI_Iscatterv(const void *sendbuf, const int sendcounts[], const int displ
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, displs, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iscatterv(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iscatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, request); }
 extern void f_mpi_iscatterv(const void* sendbuf, const int sendcounts[], const int displs[], MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -7612,9 +9052,13 @@ int c_MPI_File_delete(const char *filename, MPI_Info info)
 	PILGRIM_TRACING_1(int, MPI_File_delete, (filename, info));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(2, filename, &obj_id_0);
-	int sizes[] = { strlen(filename)+1, sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(filename)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(filename, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_delete(const char *filename, MPI_Info info) { return c_MPI_File_delete(filename, info); }
 extern void f_mpi_file_delete(const char* filename, MPI_Fint* info, MPI_Fint *ierr) {
@@ -7644,9 +9088,15 @@ int c_MPI_File_read_all(MPI_File fh, void *buf, int count, MPI_Datatype datatype
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_all(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read_all(fh, buf, count, datatype, status); }
 extern void f_mpi_file_read_all(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -7674,12 +9124,15 @@ extern void mpi_file_read_all__(MPI_Fint* fh, void* buf, int* count, MPI_Fint* d
 }
 int c_MPI_Group_size(MPI_Group group, int *size)
 {
-	PILGRIM_TRACING_1(int, MPI_Group_size, (group, size));
+	PILGRIM_QUERY_1(int, MPI_Group_size, (group, size));
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, size);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Group_size(MPI_Group group, int *size) { return c_MPI_Group_size(group, size); }
 extern void f_mpi_group_size(MPI_Fint* group, int* size, MPI_Fint *ierr) {
@@ -7706,9 +9159,13 @@ int c_MPI_Attr_put(MPI_Comm comm, int keyval, void *attribute_val)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(3, &obj_id_0, &keyval, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+	} scalars = { obj_id_0, keyval, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Attr_put(MPI_Comm comm, int keyval, void *attribute_val) { return c_MPI_Attr_put(comm, keyval, attribute_val); }
 extern void f_mpi_attr_put(MPI_Fint* comm, int* keyval, void* attribute_val, MPI_Fint *ierr) {
@@ -7742,9 +9199,18 @@ int c_MPI_Iscatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, vo
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iscatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iscatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request); }
 extern void f_mpi_iscatter(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -7778,9 +9244,13 @@ int c_MPI_Win_start(MPI_Group group, int assert, MPI_Win win)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	MPI_Win obj_1 = win;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Win, &obj_1);
-	void **args = assemble_args_list(3, &obj_id_0, &assert, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, assert, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_start(MPI_Group group, int assert, MPI_Win win) { return c_MPI_Win_start(group, assert, win); }
 extern void f_mpi_win_start(MPI_Fint* group, int* assert, MPI_Fint* win, MPI_Fint *ierr) {
@@ -7804,12 +9274,19 @@ extern void mpi_win_start__(MPI_Fint* group, int* assert, MPI_Fint* win, MPI_Fin
 }
 int c_MPI_Win_free(MPI_Win *win)
 {
+	if(logger_paused(ID_MPI_Win_free)) {
+		MPI_OBJ_RELEASE(MPI_Win, win);
+		PILGRIM_PMPI_CALL(int, MPI_Win_free, (win));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, win);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Win, win);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Win_free, (win));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_free(MPI_Win *win) { return c_MPI_Win_free(win); }
 extern void f_mpi_win_free(MPI_Fint* win, MPI_Fint *ierr) {
@@ -7845,9 +9322,25 @@ int c_MPI_Alltoallw(const void *sendbuf, const int sendcounts[], const int sdisp
 	for(int i=0; i<comm_size; i++) obj_id_1[i] = (recvtypes==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &recvtypes[i]);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, obj_id_0, &mem_attr_1, recvcounts, rdispls, obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), (comm_size)*sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), (comm_size)*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = (comm_size)*sizeof(int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	int tail_size_4 = comm_size*sizeof(const int);
+	int tail_size_5 = (comm_size)*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3 + tail_size_4 + tail_size_5, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_2);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_3);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_4);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_1, tail_size_5);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Alltoallw(const void *sendbuf, const int sendcounts[], const int sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const int rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm) { return c_MPI_Alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm); }
 extern void f_mpi_alltoallw(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtypes, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtypes, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -7888,9 +9381,23 @@ int c_MPI_Alltoallv(const void *sendbuf, const int sendcounts[], const int sdisp
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, &obj_id_0, &mem_attr_1, recvcounts, rdispls, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = comm_size*sizeof(const int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_2);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm) { return c_MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm); }
 extern void f_mpi_alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -7929,9 +9436,16 @@ int c_MPI_Exscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype dat
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Exscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) { return c_MPI_Exscan(sendbuf, recvbuf, count, datatype, op, comm); }
 extern void f_mpi_exscan(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -7957,12 +9471,19 @@ extern void mpi_exscan__(const void* sendbuf, void* recvbuf, int* count, MPI_Fin
 }
 int c_MPI_Op_free(MPI_Op *op)
 {
+	if(logger_paused(ID_MPI_Op_free)) {
+		MPI_OBJ_RELEASE(MPI_Op, op);
+		PILGRIM_PMPI_CALL(int, MPI_Op_free, (op));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Op, op);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Op, op);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Op_free, (op));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Op_free(MPI_Op *op) { return c_MPI_Op_free(op); }
 extern void f_mpi_op_free(MPI_Fint* op, MPI_Fint *ierr) {
@@ -7996,9 +9517,16 @@ int c_MPI_Iscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype data
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iscan(sendbuf, recvbuf, count, datatype, op, comm, request); }
 extern void f_mpi_iscan(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8030,9 +9558,12 @@ int c_MPI_Keyval_create(MPI_Copy_function *copy_fn, MPI_Delete_function *delete_
 	PILGRIM_TRACING_1(int, MPI_Keyval_create, (copy_fn, delete_fn, keyval, extra_state));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(4, copy_fn, delete_fn, keyval, &mem_attr_0);
-	int sizes[] = { 1*sizeof(MPI_Copy_function), 1*sizeof(MPI_Delete_function), 1*sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+	} scalars = { (keyval ? *keyval : 0), mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Keyval_create(MPI_Copy_function *copy_fn, MPI_Delete_function *delete_fn, int *keyval, void *extra_state) { return c_MPI_Keyval_create(copy_fn, delete_fn, keyval, extra_state); }
 extern void f_mpi_keyval_create(MPI_Copy_function* copy_fn, MPI_Delete_function* delete_fn, int* keyval, void* extra_state, MPI_Fint *ierr) {
@@ -8056,9 +9587,15 @@ int c_MPI_Type_vector(int count, int blocklength, int stride, MPI_Datatype oldty
 	MPI_Datatype obj_0 = oldtype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(5, &count, &blocklength, &stride, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { count, blocklength, stride, obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_vector(int count, int blocklength, int stride, MPI_Datatype oldtype, MPI_Datatype *newtype) { return c_MPI_Type_vector(count, blocklength, stride, oldtype, newtype); }
 extern void f_mpi_type_vector(int* count, int* blocklength, int* stride, MPI_Fint* oldtype, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -8086,9 +9623,12 @@ int c_MPI_Win_create_keyval(MPI_Win_copy_attr_function *win_copy_attr_fn, MPI_Wi
 	PILGRIM_TRACING_1(int, MPI_Win_create_keyval, (win_copy_attr_fn, win_delete_attr_fn, win_keyval, extra_state));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(4, win_copy_attr_fn, win_delete_attr_fn, win_keyval, &mem_attr_0);
-	int sizes[] = { 1*sizeof(MPI_Win_copy_attr_function), 1*sizeof(MPI_Win_delete_attr_function), 1*sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+	} scalars = { (win_keyval ? *win_keyval : 0), mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_create_keyval(MPI_Win_copy_attr_function *win_copy_attr_fn, MPI_Win_delete_attr_function *win_delete_attr_fn, int *win_keyval, void *extra_state) { return c_MPI_Win_create_keyval(win_copy_attr_fn, win_delete_attr_fn, win_keyval, extra_state); }
 extern void f_mpi_win_create_keyval(MPI_Win_copy_attr_function* win_copy_attr_fn, MPI_Win_delete_attr_function* win_delete_attr_fn, int* win_keyval, void* extra_state, MPI_Fint *ierr) {
@@ -8110,9 +9650,13 @@ int c_MPI_Type_match_size(int typeclass, int size, MPI_Datatype *datatype)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_match_size, (typeclass, size, datatype));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, datatype);
-	void **args = assemble_args_list(3, &typeclass, &size, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { typeclass, size, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_match_size(int typeclass, int size, MPI_Datatype *datatype) { return c_MPI_Type_match_size(typeclass, size, datatype); }
 extern void f_mpi_type_match_size(int* typeclass, int* size, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -8146,9 +9690,16 @@ int c_MPI_Scan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datat
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Scan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) { return c_MPI_Scan(sendbuf, recvbuf, count, datatype, op, comm); }
 extern void f_mpi_scan(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -8178,9 +9729,12 @@ int c_MPI_File_seek_shared(MPI_File fh, MPI_Offset offset, int whence)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	append_offset(offset);
-	void **args = assemble_args_list(2, &obj_id_0, &whence);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, whence };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_seek_shared(MPI_File fh, MPI_Offset offset, int whence) { return c_MPI_File_seek_shared(fh, offset, whence); }
 extern void f_mpi_file_seek_shared(MPI_Fint* fh, MPI_Offset offset, int* whence, MPI_Fint *ierr) {
@@ -8204,9 +9758,11 @@ extern void mpi_file_seek_shared__(MPI_Fint* fh, MPI_Offset offset, int* whence,
 int c_MPI_Add_error_class(int *errorclass)
 {
 	PILGRIM_TRACING_1(int, MPI_Add_error_class, (errorclass));
-	void **args = assemble_args_list(1, errorclass);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (errorclass ? *errorclass : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Add_error_class(int *errorclass) { return c_MPI_Add_error_class(errorclass); }
 extern void f_mpi_add_error_class(int* errorclass, MPI_Fint *ierr) {
@@ -8237,9 +9793,18 @@ int c_MPI_Igather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, voi
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Igather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Igather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request); }
 extern void f_mpi_igather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8268,12 +9833,19 @@ extern void mpi_igather__(const void* sendbuf, int* sendcount, MPI_Fint* sendtyp
 }
 int c_MPI_Info_free(MPI_Info *info)
 {
+	if(logger_paused(ID_MPI_Info_free)) {
+		MPI_OBJ_RELEASE(MPI_Info, info);
+		PILGRIM_PMPI_CALL(int, MPI_Info_free, (info));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, info);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Info, info);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Info_free, (info));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Info_free(MPI_Info *info) { return c_MPI_Info_free(info); }
 extern void f_mpi_info_free(MPI_Fint* info, MPI_Fint *ierr) {
@@ -8299,9 +9871,13 @@ int c_MPI_Open_port(MPI_Info info, char *port_name)
 	PILGRIM_TRACING_1(int, MPI_Open_port, (info, port_name));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, port_name);
-	int sizes[] = { sizeof(int), strlen(port_name)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Open_port(MPI_Info info, char *port_name) { return c_MPI_Open_port(info, port_name); }
 extern void f_mpi_open_port(MPI_Fint* info, char* port_name, MPI_Fint *ierr) {
@@ -8331,9 +9907,16 @@ int c_MPI_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm com
 	MemPtrAttr mem_attr_0;
 	addr2id(baseptr, &mem_attr_0);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, win);
-	void **args = assemble_args_list(6, &size, &disp_unit, &obj_id_0, &obj_id_1, &mem_attr_0, &obj_id_2);
-	int sizes[] = { sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_Aint a0;
+		int a1;
+		int a2;
+		int a3;
+		MemPtrAttr a4;
+		int a5;
+	} scalars = { size, disp_unit, obj_id_0, obj_id_1, mem_attr_0, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win) { return c_MPI_Win_allocate(size, disp_unit, info, comm, baseptr, win); }
 extern void f_mpi_win_allocate(MPI_Aint size, int* disp_unit, MPI_Fint* info, MPI_Fint* comm, void* baseptr, MPI_Fint* win, MPI_Fint *ierr) {
@@ -8365,9 +9948,12 @@ int c_MPI_Win_set_info(MPI_Win win, MPI_Info info)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_set_info(MPI_Win win, MPI_Info info) { return c_MPI_Win_set_info(win, info); }
 extern void f_mpi_win_set_info(MPI_Fint* win, MPI_Fint* info, MPI_Fint *ierr) {
@@ -8395,9 +9981,15 @@ int c_MPI_Unpublish_name(const char *service_name, MPI_Info info, const char *po
 	PILGRIM_TRACING_1(int, MPI_Unpublish_name, (service_name, info, port_name));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(3, service_name, &obj_id_0, port_name);
-	int sizes[] = { strlen(service_name)+1, sizeof(int), strlen(port_name)+1 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(service_name)+1;
+	int tail_size_1 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(service_name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Unpublish_name(const char *service_name, MPI_Info info, const char *port_name) { return c_MPI_Unpublish_name(service_name, info, port_name); }
 extern void f_mpi_unpublish_name(const char* service_name, MPI_Fint* info, const char* port_name, MPI_Fint *ierr) {
@@ -8419,12 +10011,15 @@ extern void mpi_unpublish_name__(const char* service_name, MPI_Fint* info, const
 }
 int c_MPI_Group_rank(MPI_Group group, int *rank)
 {
-	PILGRIM_TRACING_1(int, MPI_Group_rank, (group, rank));
+	PILGRIM_QUERY_1(int, MPI_Group_rank, (group, rank));
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, rank);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (rank ? *rank : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Group_rank(MPI_Group group, int *rank) { return c_MPI_Group_rank(group, rank); }
 extern void f_mpi_group_rank(MPI_Fint* group, int* rank, MPI_Fint *ierr) {
@@ -8449,9 +10044,15 @@ int c_MPI_Lookup_name(const char *service_name, MPI_Info info, char *port_name)
 	PILGRIM_TRACING_1(int, MPI_Lookup_name, (service_name, info, port_name));
 	MPI_Info obj_0 = info;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Info, &obj_0);
-	void **args = assemble_args_list(3, service_name, &obj_id_0, port_name);
-	int sizes[] = { strlen(service_name)+1, sizeof(int), strlen(port_name)+1 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	int tail_size_0 = strlen(service_name)+1;
+	int tail_size_1 = strlen(port_name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(service_name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(port_name, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Lookup_name(const char *service_name, MPI_Info info, char *port_name) { return c_MPI_Lookup_name(service_name, info, port_name); }
 extern void f_mpi_lookup_name(const char* service_name, MPI_Fint* info, char* port_name, MPI_Fint *ierr) {
@@ -8488,9 +10089,17 @@ int c_MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag,
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(tag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(7, &mem_attr_0, &count, &obj_id_0, &source_rank, &my_tag, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6[2];
+	} scalars = { mem_attr_0, count, obj_id_0, source_rank, my_tag, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status) { return c_MPI_Recv(buf, count, datatype, source, tag, comm, status); }
 extern void f_mpi_recv(void* buf, int* count, MPI_Fint* datatype, int* source, int* tag, MPI_Fint* comm, MPI_Fint* status, MPI_Fint *ierr) {
@@ -8518,9 +10127,11 @@ extern void mpi_recv__(void* buf, int* count, MPI_Fint* datatype, int* source, i
 int c_MPI_Type_free_keyval(int *type_keyval)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_free_keyval, (type_keyval));
-	void **args = assemble_args_list(1, type_keyval);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (type_keyval ? *type_keyval : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_free_keyval(int *type_keyval) { return c_MPI_Type_free_keyval(type_keyval); }
 extern void f_mpi_type_free_keyval(int* type_keyval, MPI_Fint *ierr) {
@@ -8544,9 +10155,12 @@ int c_MPI_Comm_get_info(MPI_Comm comm, MPI_Info *info_used)
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, info_used);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_get_info(MPI_Comm comm, MPI_Info *info_used) { return c_MPI_Comm_get_info(comm, info_used); }
 extern void f_mpi_comm_get_info(MPI_Fint* comm, MPI_Fint* info_used, MPI_Fint *ierr) {
@@ -8572,17 +10186,22 @@ extern void mpi_comm_get_info__(MPI_Fint* comm, MPI_Fint* info_used, MPI_Fint *i
 int c_MPI_T_pvar_session_create(MPI_T_pvar_session *session)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_session_create, (session));
-	void **args = assemble_args_list(1, session);
-	int sizes[] = { 1*sizeof(MPI_T_pvar_session) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+	} scalars = { (session ? *session : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_session_create(MPI_T_pvar_session *session) { return c_MPI_T_pvar_session_create(session); }
 int c_MPI_T_init_thread(int required, int *provided)
 {
 	PILGRIM_TRACING_1(int, MPI_T_init_thread, (required, provided));
-	void **args = assemble_args_list(2, &required, provided);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { required, (provided ? *provided : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_init_thread(int required, int *provided) { return c_MPI_T_init_thread(required, provided); }
 int c_MPI_File_open(MPI_Comm comm, const char *filename, int amode, MPI_Info info, MPI_File *fh)
@@ -8593,9 +10212,16 @@ int c_MPI_File_open(MPI_Comm comm, const char *filename, int amode, MPI_Info inf
 	MPI_Info obj_1 = info;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Info, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_File, fh);
-	void **args = assemble_args_list(5, &obj_id_0, filename, &amode, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), strlen(filename)+1, sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, amode, obj_id_1, obj_id_2 };
+	int tail_size_0 = strlen(filename)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(filename, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_open(MPI_Comm comm, const char *filename, int amode, MPI_Info info, MPI_File *fh) { return c_MPI_File_open(comm, filename, amode, info, fh); }
 extern void f_mpi_file_open(MPI_Fint* comm, const char* filename, int* amode, MPI_Fint* info, MPI_Fint* fh, MPI_Fint *ierr) {
@@ -8634,9 +10260,16 @@ int c_MPI_Bsend(const void *buf, int count, MPI_Datatype datatype, int dest, int
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Bsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) { return c_MPI_Bsend(buf, count, datatype, dest, tag, comm); }
 extern void f_mpi_bsend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -8673,9 +10306,17 @@ int c_MPI_Ireduce_scatter(const void *sendbuf, void *recvbuf, const int recvcoun
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, recvcounts, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_0, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ireduce_scatter(const void *sendbuf, void *recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ireduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm, request); }
 extern void f_mpi_ireduce_scatter(const void* sendbuf, void* recvbuf, const int recvcounts[], MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8719,9 +10360,17 @@ int c_MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source, int tag
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = create_request_id(request, false, ID_MPI_Irecv, source, tag, obj_id_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &count, &obj_id_0, &source_rank, &my_tag, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, count, obj_id_0, source_rank, my_tag, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Irecv(buf, count, datatype, source, tag, comm, request); }
 extern void f_mpi_irecv(void* buf, int* count, MPI_Fint* datatype, int* source, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8760,9 +10409,16 @@ int c_MPI_Issend(const void *buf, int count, MPI_Datatype datatype, int dest, in
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Issend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Issend(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_issend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8797,9 +10453,14 @@ int c_MPI_File_iwrite_at_all(MPI_File fh, MPI_Offset offset, const void *buf, in
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iwrite_at_all(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iwrite_at_all(fh, offset, buf, count, datatype, request); }
 extern void f_mpi_file_iwrite_at_all(MPI_Fint* fh, MPI_Offset offset, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8830,9 +10491,12 @@ int c_MPI_Abort(MPI_Comm comm, int errorcode)
 	PILGRIM_TRACING_1(int, MPI_Abort, (comm, errorcode));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, &errorcode);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, errorcode };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Abort(MPI_Comm comm, int errorcode) { return c_MPI_Abort(comm, errorcode); }
 extern void f_mpi_abort(MPI_Fint* comm, int* errorcode, MPI_Fint *ierr) {
@@ -8863,9 +10527,17 @@ int c_MPI_Pack(const void *inbuf, int incount, MPI_Datatype datatype, void *outb
 	addr2id(outbuf, &mem_attr_1);
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &incount, &obj_id_0, &mem_attr_1, &outsize, position, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), 1*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, incount, obj_id_0, mem_attr_1, outsize, (position ? *position : 0), obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Pack(const void *inbuf, int incount, MPI_Datatype datatype, void *outbuf, int outsize, int *position, MPI_Comm comm) { return c_MPI_Pack(inbuf, incount, datatype, outbuf, outsize, position, comm); }
 extern void f_mpi_pack(const void* inbuf, int* incount, MPI_Fint* datatype, void* outbuf, int* outsize, int* position, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -8896,9 +10568,14 @@ int c_MPI_File_iwrite(MPI_File fh, const void *buf, int count, MPI_Datatype data
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iwrite(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iwrite(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iwrite(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -8939,9 +10616,21 @@ int c_MPI_Gatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, voi
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, recvcounts, displs, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, obj_id_1, root, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(displs, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Gatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm) { return c_MPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm); }
 extern void f_mpi_gatherv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int displs[], MPI_Fint* recvtype, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -8969,6 +10658,11 @@ extern void mpi_gatherv__(const void* sendbuf, int* sendcount, MPI_Fint* sendtyp
 }
 int c_MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_create)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_create, (comm, group, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_create, (comm, group, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
@@ -8976,9 +10670,13 @@ int c_MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm)
 	MPI_Group obj_1 = group;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, &obj_1);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm) { return c_MPI_Comm_create(comm, group, newcomm); }
 extern void f_mpi_comm_create(MPI_Fint* comm, MPI_Fint* group, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -9013,9 +10711,15 @@ int c_MPI_File_write_ordered(MPI_File fh, const void *buf, int count, MPI_Dataty
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_ordered(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_write_ordered(fh, buf, count, datatype, status); }
 extern void f_mpi_file_write_ordered(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -9043,14 +10747,22 @@ extern void mpi_file_write_ordered__(MPI_Fint* fh, const void* buf, int* count,
 }
 int c_MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_dup)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_dup, (comm, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_dup, (comm, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, newcomm);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm) { return c_MPI_Comm_dup(comm, newcomm); }
 extern void f_mpi_comm_dup(MPI_Fint* comm, MPI_Fint* newcomm, MPI_Fint *ierr) {
@@ -9076,9 +10788,9 @@ extern void mpi_comm_dup__(MPI_Fint* comm, MPI_Fint* newcomm, MPI_Fint *ierr) {
 int c_MPI_T_finalize(void)
 {
 	PILGRIM_TRACING_1(int, MPI_T_finalize, ());
-	void **args = NULL;
-	int* sizes = NULL;
-	PILGRIM_TRACING_2(0, sizes, args, -1);
+	char scalars[0];
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_finalize(void) { return c_MPI_T_finalize(); }
 int c_MPI_File_iread_shared(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
@@ -9090,9 +10802,14 @@ int c_MPI_File_iread_shared(MPI_File fh, void *buf, int count, MPI_Datatype data
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_iread_shared(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request) { return c_MPI_File_iread_shared(fh, buf, count, datatype, request); }
 extern void f_mpi_file_iread_shared(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* request, MPI_Fint *ierr) {
@@ -9125,9 +10842,12 @@ int c_MPI_File_set_errhandler(MPI_File file, MPI_Errhandler errhandler)
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	MPI_Errhandler obj_1 = errhandler;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_set_errhandler(MPI_File file, MPI_Errhandler errhandler) { return c_MPI_File_set_errhandler(file, errhandler); }
 extern void f_mpi_file_set_errhandler(MPI_Fint* file, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -9155,9 +10875,13 @@ int c_MPI_Register_datarep(const char *datarep, MPI_Datarep_conversion_function
 	PILGRIM_TRACING_1(int, MPI_Register_datarep, (datarep, read_conversion_fn, write_conversion_fn, dtype_file_extent_fn, extra_state));
 	MemPtrAttr mem_attr_0;
 	addr2id(extra_state, &mem_attr_0);
-	void **args = assemble_args_list(5, datarep, read_conversion_fn, write_conversion_fn, dtype_file_extent_fn, &mem_attr_0);
-	int sizes[] = { strlen(datarep)+1, 1*sizeof(MPI_Datarep_conversion_function), 1*sizeof(MPI_Datarep_conversion_function), 1*sizeof(MPI_Datarep_extent_function), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+	} scalars = { mem_attr_0 };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Register_datarep(const char *datarep, MPI_Datarep_conversion_function *read_conversion_fn, MPI_Datarep_conversion_function *write_conversion_fn, MPI_Datarep_extent_function *dtype_file_extent_fn, void *extra_state) { return c_MPI_Register_datarep(datarep, read_conversion_fn, write_conversion_fn, dtype_file_extent_fn, extra_state); }
 extern void f_mpi_register_datarep(const char* datarep, MPI_Datarep_conversion_function* read_conversion_fn, MPI_Datarep_conversion_function* write_conversion_fn, MPI_Datarep_extent_function* dtype_file_extent_fn, void* extra_state, MPI_Fint *ierr) {
@@ -9190,9 +10914,17 @@ int c_MPI_Reduce_scatter(const void *sendbuf, void *recvbuf, const int recvcount
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, recvcounts, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_0, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, comm_size);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Reduce_scatter(const void *sendbuf, void *recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) { return c_MPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm); }
 extern void f_mpi_reduce_scatter(const void* sendbuf, void* recvbuf, const int recvcounts[], MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -9223,9 +10955,11 @@ int c_MPI_Ibarrier(MPI_Comm comm, MPI_Request *request)
 	PILGRIM_TRACING_1(int, MPI_Ibarrier, (comm, request));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(1, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ibarrier(MPI_Comm comm, MPI_Request *request) { return c_MPI_Ibarrier(comm, request); }
 extern void f_mpi_ibarrier(MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -9252,9 +10986,13 @@ int c_MPI_Type_create_f90_real(int p, int r, MPI_Datatype *newtype)
 {
 	PILGRIM_TRACING_1(int, MPI_Type_create_f90_real, (p, r, newtype));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, newtype);
-	void **args = assemble_args_list(3, &p, &r, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { p, r, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Type_create_f90_real(int p, int r, MPI_Datatype *newtype) { return c_MPI_Type_create_f90_real(p, r, newtype); }
 extern void f_mpi_type_create_f90_real(int* p, int* r, MPI_Fint* newtype, MPI_Fint *ierr) {
@@ -9281,9 +11019,12 @@ int c_MPI_File_seek(MPI_File fh, MPI_Offset offset, int whence)
 	MPI_File obj_0 = fh;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	append_offset(offset);
-	void **args = assemble_args_list(2, &obj_id_0, &whence);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, whence };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_seek(MPI_File fh, MPI_Offset offset, int whence) { return c_MPI_File_seek(fh, offset, whence); }
 extern void f_mpi_file_seek(MPI_Fint* fh, MPI_Offset offset, int* whence, MPI_Fint *ierr) {
@@ -9307,9 +11048,11 @@ extern void mpi_file_seek__(MPI_Fint* fh, MPI_Offset offset, int* whence, MPI_Fi
 int c_MPI_T_cvar_get_num(int *num_cvar)
 {
 	PILGRIM_TRACING_1(int, MPI_T_cvar_get_num, (num_cvar));
-	void **args = assemble_args_list(1, num_cvar);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (num_cvar ? *num_cvar : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_cvar_get_num(int *num_cvar) { return c_MPI_T_cvar_get_num(num_cvar); }
 int c_MPI_Group_incl(MPI_Group group, int n, const int ranks[], MPI_Group *newgroup)
@@ -9318,9 +11061,15 @@ int c_MPI_Group_incl(MPI_Group group, int n, const int ranks[], MPI_Group *newgr
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(4, &obj_id_0, &n, ranks, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), n*sizeof(const int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, n, obj_id_1 };
+	int tail_size_0 = n*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(ranks, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_incl(MPI_Group group, int n, const int ranks[], MPI_Group *newgroup) { return c_MPI_Group_incl(group, n, ranks, newgroup); }
 extern void f_mpi_group_incl(MPI_Fint* group, int* n, const int ranks[], MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -9345,10 +11094,13 @@ extern void mpi_group_incl__(MPI_Fint* group, int* n, const int ranks[], MPI_Fin
 }
 int c_MPI_Get_version(int *version, int *subversion)
 {
-	PILGRIM_TRACING_1(int, MPI_Get_version, (version, subversion));
-	void **args = assemble_args_list(2, version, subversion);
-	int sizes[] = { 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Get_version, (version, subversion));
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { (version ? *version : 0), (subversion ? *subversion : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Get_version(int *version, int *subversion) { return c_MPI_Get_version(version, subversion); }
 extern void f_mpi_get_version(int* version, int* subversion, MPI_Fint *ierr) {
@@ -9375,9 +11127,18 @@ int c_MPI_Pack_external(const char datarep[], const void *inbuf, int incount, MP
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MemPtrAttr mem_attr_1;
 	addr2id(outbuf, &mem_attr_1);
-	void **args = assemble_args_list(7, datarep, &mem_attr_0, &incount, &obj_id_0, &mem_attr_1, &outsize, position);
-	int sizes[] = { strlen(datarep)+1, sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(MPI_Aint), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		MPI_Aint a4;
+		MPI_Aint a5;
+	} scalars = { mem_attr_0, incount, obj_id_0, mem_attr_1, outsize, (position ? *position : 0) };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Pack_external(const char datarep[], const void *inbuf, int incount, MPI_Datatype datatype, void *outbuf, MPI_Aint outsize, MPI_Aint *position) { return c_MPI_Pack_external(datarep, inbuf, incount, datatype, outbuf, outsize, position); }
 extern void f_mpi_pack_external(const char datarep[], const void* inbuf, int* incount, MPI_Fint* datatype, void* outbuf, MPI_Aint outsize, MPI_Aint* position, MPI_Fint *ierr) {
@@ -9407,9 +11168,15 @@ int c_MPI_File_read(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MP
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read(fh, buf, count, datatype, status); }
 extern void f_mpi_file_read(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -9437,12 +11204,16 @@ extern void mpi_file_read__(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datat
 }
 int c_MPI_Type_get_true_extent(MPI_Datatype datatype, MPI_Aint *true_lb, MPI_Aint *true_extent)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_get_true_extent, (datatype, true_lb, true_extent));
+	PILGRIM_QUERY_1(int, MPI_Type_get_true_extent, (datatype, true_lb, true_extent));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, true_lb, true_extent);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Aint), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Aint a1;
+		MPI_Aint a2;
+	} scalars = { obj_id_0, (true_lb ? *true_lb : 0), (true_extent ? *true_extent : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_get_true_extent(MPI_Datatype datatype, MPI_Aint *true_lb, MPI_Aint *true_extent) { return c_MPI_Type_get_true_extent(datatype, true_lb, true_extent); }
 extern void f_mpi_type_get_true_extent(MPI_Fint* datatype, MPI_Aint* true_lb, MPI_Aint* true_extent, MPI_Fint *ierr) {
@@ -9464,14 +11235,28 @@ extern void mpi_type_get_true_extent__(MPI_Fint* datatype, MPI_Aint* true_lb, MP
 }
 int c_MPI_Cart_create(MPI_Comm comm_old, int ndims, const int dims[], const int periods[], int reorder, MPI_Comm *comm_cart)
 {
+	if(logger_paused(ID_MPI_Cart_create)) {
+		PILGRIM_PMPI_CALL(int, MPI_Cart_create, (comm_old, ndims, dims, periods, reorder, comm_cart));
+		generate_intracomm_id(comm_cart);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Cart_create, (comm_old, ndims, dims, periods, reorder, comm_cart));
 	generate_intracomm_id(comm_cart);
 	MPI_Comm obj_0 = comm_old;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, comm_cart);
-	void **args = assemble_args_list(6, &obj_id_0, &ndims, dims, periods, &reorder, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), ndims*sizeof(const int), ndims*sizeof(const int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, ndims, reorder, obj_id_1 };
+	int tail_size_0 = ndims*sizeof(const int);
+	int tail_size_1 = ndims*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(dims, tail_size_0);
+	PILGRIM_ENCODE_TAIL(periods, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Cart_create(MPI_Comm comm_old, int ndims, const int dims[], const int periods[], int reorder, MPI_Comm *comm_cart) { return c_MPI_Cart_create(comm_old, ndims, dims, periods, reorder, comm_cart); }
 extern void f_mpi_cart_create(MPI_Fint* comm_old, int* ndims, const int dims[], const int periods[], int* reorder, MPI_Fint* comm_cart, MPI_Fint *ierr) {
@@ -9516,9 +11301,22 @@ int c_MPI_Sendrecv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, in
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(recvtag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(12, &mem_attr_0, &sendcount, &obj_id_0, &dest_rank, &sendtag, &mem_attr_1, &recvcount, &obj_id_1, &source_rank, &recvtag, &obj_id_2, status_arg);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(12, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		MemPtrAttr a5;
+		int a6;
+		int a7;
+		int a8;
+		int a9;
+		int a10;
+		int a11[2];
+	} scalars = { mem_attr_0, sendcount, obj_id_0, dest_rank, sendtag, mem_attr_1, recvcount, obj_id_1, source_rank, recvtag, obj_id_2, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Sendrecv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, int dest, int sendtag, void *recvbuf, int recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status *status) { return c_MPI_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag, comm, status); }
 extern void f_mpi_sendrecv(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, int* dest, int* sendtag, void* recvbuf, int* recvcount, MPI_Fint* recvtype, int* source, int* recvtag, MPI_Fint* comm, MPI_Fint* status, MPI_Fint *ierr) {
@@ -9552,9 +11350,15 @@ int c_MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint *size, int *disp_unit
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(baseptr, &mem_attr_0);
-	void **args = assemble_args_list(5, &obj_id_0, &rank, size, disp_unit, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(int), 1*sizeof(MPI_Aint), 1*sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MPI_Aint a2;
+		int a3;
+		MemPtrAttr a4;
+	} scalars = { obj_id_0, rank, (size ? *size : 0), (disp_unit ? *disp_unit : 0), mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint *size, int *disp_unit, void *baseptr) { return c_MPI_Win_shared_query(win, rank, size, disp_unit, baseptr); }
 extern void f_mpi_win_shared_query(MPI_Fint* win, int* rank, MPI_Aint* size, int* disp_unit, void* baseptr, MPI_Fint *ierr) {
@@ -9581,9 +11385,13 @@ int c_MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(attribute_val, &mem_attr_0);
-	void **args = assemble_args_list(3, &obj_id_0, &comm_keyval, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MemPtrAttr a2;
+	} scalars = { obj_id_0, comm_keyval, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val) { return c_MPI_Comm_set_attr(comm, comm_keyval, attribute_val); }
 extern void f_mpi_comm_set_attr(MPI_Fint* comm, int* comm_keyval, void* attribute_val, MPI_Fint *ierr) {
@@ -9614,9 +11422,16 @@ int c_MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info, MPI_C
 	MemPtrAttr mem_attr_0;
 	addr2id(baseptr, &mem_attr_0);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, win);
-	void **args = assemble_args_list(6, &size, &disp_unit, &obj_id_0, &obj_id_1, &mem_attr_0, &obj_id_2);
-	int sizes[] = { sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_Aint a0;
+		int a1;
+		int a2;
+		int a3;
+		MemPtrAttr a4;
+		int a5;
+	} scalars = { size, disp_unit, obj_id_0, obj_id_1, mem_attr_0, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win) { return c_MPI_Win_allocate_shared(size, disp_unit, info, comm, baseptr, win); }
 extern void f_mpi_win_allocate_shared(MPI_Aint size, int* disp_unit, MPI_Fint* info, MPI_Fint* comm, void* baseptr, MPI_Fint* win, MPI_Fint *ierr) {
@@ -9643,12 +11458,16 @@ extern void mpi_win_allocate_shared__(MPI_Aint size, int* disp_unit, MPI_Fint* i
 }
 int c_MPI_Type_get_true_extent_x(MPI_Datatype datatype, MPI_Count *true_lb, MPI_Count *true_extent)
 {
-	PILGRIM_TRACING_1(int, MPI_Type_get_true_extent_x, (datatype, true_lb, true_extent));
+	PILGRIM_QUERY_1(int, MPI_Type_get_true_extent_x, (datatype, true_lb, true_extent));
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, true_lb, true_extent);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Count), 1*sizeof(MPI_Count) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Count a1;
+		MPI_Count a2;
+	} scalars = { obj_id_0, (true_lb ? *true_lb : 0), (true_extent ? *true_extent : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Type_get_true_extent_x(MPI_Datatype datatype, MPI_Count *true_lb, MPI_Count *true_extent) { return c_MPI_Type_get_true_extent_x(datatype, true_lb, true_extent); }
 extern void f_mpi_type_get_true_extent_x(MPI_Fint* datatype, MPI_Count* true_lb, MPI_Count* true_extent, MPI_Fint *ierr) {
@@ -9677,9 +11496,15 @@ int c_MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Co
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(5, &mem_attr_0, &count, &obj_id_0, &root, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, count, obj_id_0, root, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) { return c_MPI_Bcast(buffer, count, datatype, root, comm); }
 extern void f_mpi_bcast(void* buffer, int* count, MPI_Fint* datatype, int* root, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -9703,10 +11528,14 @@ extern void mpi_bcast__(void* buffer, int* count, MPI_Fint* datatype, int* root,
 }
 int c_MPI_Get_processor_name(char *name, int *resultlen)
 {
-	PILGRIM_TRACING_1(int, MPI_Get_processor_name, (name, resultlen));
-	void **args = assemble_args_list(2, name, resultlen);
-	int sizes[] = { strlen(name)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Get_processor_name, (name, resultlen));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(name)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Get_processor_name(char *name, int *resultlen) { return c_MPI_Get_processor_name(name, resultlen); }
 extern void f_mpi_get_processor_name(char* name, int* resultlen, MPI_Fint *ierr) {
@@ -9737,9 +11566,17 @@ int c_MPI_Ineighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype s
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &sendcount, &obj_id_0, &mem_attr_1, &recvcount, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, sendcount, obj_id_0, mem_attr_1, recvcount, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ineighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ineighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request); }
 extern void f_mpi_ineighbor_allgather(const void* sendbuf, int* sendcount, MPI_Fint* sendtype, void* recvbuf, int* recvcount, MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -9779,9 +11616,19 @@ int c_MPI_Raccumulate(const void *origin_addr, int origin_count, MPI_Datatype or
 	int obj_id_2 = MPI_OBJ_ID(MPI_Op, &obj_2);
 	MPI_Win obj_3 = win;
 	int obj_id_3 = MPI_OBJ_ID(MPI_Win, &obj_3);
-	void **args = assemble_args_list(9, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2, &obj_id_3);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+		int a8;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2, obj_id_3 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Raccumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request) { return c_MPI_Raccumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request); }
 extern void f_mpi_raccumulate(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* op, MPI_Fint* win, MPI_Fint* request, MPI_Fint *ierr) {
@@ -9817,9 +11664,14 @@ int c_MPI_Pack_size(int incount, MPI_Datatype datatype, MPI_Comm comm, int *size
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(4, &incount, &obj_id_0, &obj_id_1, size);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { incount, obj_id_0, obj_id_1, (size ? *size : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Pack_size(int incount, MPI_Datatype datatype, MPI_Comm comm, int *size) { return c_MPI_Pack_size(incount, datatype, comm, size); }
 extern void f_mpi_pack_size(int* incount, MPI_Fint* datatype, MPI_Fint* comm, int* size, MPI_Fint *ierr) {
@@ -9843,14 +11695,23 @@ extern void mpi_pack_size__(int* incount, MPI_Fint* datatype, MPI_Fint* comm, in
 }
 int c_MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm)
 {
+	if(logger_paused(ID_MPI_Intercomm_merge)) {
+		PILGRIM_PMPI_CALL(int, MPI_Intercomm_merge, (intercomm, high, newintracomm));
+		generate_intracomm_id(newintracomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Intercomm_merge, (intercomm, high, newintracomm));
 	generate_intracomm_id(newintracomm);
 	MPI_Comm obj_0 = intercomm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, newintracomm);
-	void **args = assemble_args_list(3, &obj_id_0, &high, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, high, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm) { return c_MPI_Intercomm_merge(intercomm, high, newintracomm); }
 extern void f_mpi_intercomm_merge(MPI_Fint* intercomm, int* high, MPI_Fint* newintracomm, MPI_Fint *ierr) {
@@ -9880,9 +11741,13 @@ int c_MPI_File_get_type_extent(MPI_File fh, MPI_Datatype datatype, MPI_Aint *ext
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(3, &obj_id_0, &obj_id_1, extent);
-	int sizes[] = { sizeof(int), sizeof(int), 1*sizeof(MPI_Aint) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		MPI_Aint a2;
+	} scalars = { obj_id_0, obj_id_1, (extent ? *extent : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_type_extent(MPI_File fh, MPI_Datatype datatype, MPI_Aint *extent) { return c_MPI_File_get_type_extent(fh, datatype, extent); }
 extern void f_mpi_file_get_type_extent(MPI_Fint* fh, MPI_Fint* datatype, MPI_Aint* extent, MPI_Fint *ierr) {
@@ -9906,10 +11771,14 @@ extern void mpi_file_get_type_extent__(MPI_Fint* fh, MPI_Fint* datatype, MPI_Ain
 }
 int c_MPI_Get_library_version(char *version, int *resultlen)
 {
-	PILGRIM_TRACING_1(int, MPI_Get_library_version, (version, resultlen));
-	void **args = assemble_args_list(2, version, resultlen);
-	int sizes[] = { strlen(version)+1, 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	PILGRIM_QUERY_1(int, MPI_Get_library_version, (version, resultlen));
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (resultlen ? *resultlen : 0) };
+	int tail_size_0 = strlen(version)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(version, tail_size_0);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Get_library_version(char *version, int *resultlen) { return c_MPI_Get_library_version(version, resultlen); }
 extern void f_mpi_get_library_version(char* version, int* resultlen, MPI_Fint *ierr) {
@@ -9942,9 +11811,17 @@ int c_MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
 	int obj_id_2 = create_request_id(request, false, ID_MPI_Isend, dest, tag, obj_id_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Isend(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_isend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -9972,17 +11849,20 @@ extern void mpi_isend__(const void* buf, int* count, MPI_Fint* datatype, int* de
 int c_MPI_T_pvar_reset(MPI_T_pvar_session session, MPI_T_pvar_handle handle)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_reset, (session, handle));
-	void **args = assemble_args_list(2, &session, &handle);
-	int sizes[] = { sizeof(MPI_T_pvar_session), sizeof(MPI_T_pvar_handle) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+		MPI_T_pvar_handle a1;
+	} scalars = { session, handle };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_reset(MPI_T_pvar_session session, MPI_T_pvar_handle handle) { return c_MPI_T_pvar_reset(session, handle); }
 int c_MPI_Start(MPI_Request *request)
 {
 	PILGRIM_TRACING_1(int, MPI_Start, (request));
-	void **args = NULL;
-	int sizes[] = { sizeof(int) };
-	PILGRIM_TRACING_2(0, sizes, args, -1);
+	char scalars[0];
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Start(MPI_Request *request) { return c_MPI_Start(request); }
 extern void f_mpi_start(MPI_Fint* request, MPI_Fint *ierr) {
@@ -10014,9 +11894,17 @@ int c_MPI_Unpack(const void *inbuf, int insize, int *position, void *outbuf, int
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(7, &mem_attr_0, &insize, position, &mem_attr_1, &outcount, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), 1*sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, insize, (position ? *position : 0), mem_attr_1, outcount, obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Unpack(const void *inbuf, int insize, int *position, void *outbuf, int outcount, MPI_Datatype datatype, MPI_Comm comm) { return c_MPI_Unpack(inbuf, insize, position, outbuf, outcount, datatype, comm); }
 extern void f_mpi_unpack(const void* inbuf, int* insize, int* position, void* outbuf, int* outcount, MPI_Fint* datatype, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -10045,9 +11933,16 @@ int c_MPI_File_get_view(MPI_File fh, MPI_Offset *disp, MPI_Datatype *etype, MPI_
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, etype);
 	int obj_id_2 = MPI_OBJ_ID(MPI_Datatype, filetype);
-	void **args = assemble_args_list(5, &obj_id_0, disp, &obj_id_1, &obj_id_2, datarep);
-	int sizes[] = { sizeof(int), 1*sizeof(MPI_Offset), sizeof(int), sizeof(int), strlen(datarep)+1 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MPI_Offset a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, (disp ? *disp : 0), obj_id_1, obj_id_2 };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_view(MPI_File fh, MPI_Offset *disp, MPI_Datatype *etype, MPI_Datatype *filetype, char *datarep) { return c_MPI_File_get_view(fh, disp, etype, filetype, datarep); }
 extern void f_mpi_file_get_view(MPI_Fint* fh, MPI_Offset* disp, MPI_Fint* etype, MPI_Fint* filetype, char* datarep, MPI_Fint *ierr) {
@@ -10076,9 +11971,11 @@ extern void mpi_file_get_view__(MPI_Fint* fh, MPI_Offset* disp, MPI_Fint* etype,
 int c_MPI_T_pvar_session_free(MPI_T_pvar_session *session)
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_session_free, (session));
-	void **args = assemble_args_list(1, session);
-	int sizes[] = { 1*sizeof(MPI_T_pvar_session) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MPI_T_pvar_session a0;
+	} scalars = { (session ? *session : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_session_free(MPI_T_pvar_session *session) { return c_MPI_T_pvar_session_free(session); }
 int c_MPI_Iexscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
@@ -10094,9 +11991,16 @@ int c_MPI_Iexscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype da
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(6, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iexscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request) { return c_MPI_Iexscan(sendbuf, recvbuf, count, datatype, op, comm, request); }
 extern void f_mpi_iexscan(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -10132,9 +12036,18 @@ int c_MPI_Unpack_external(const char datarep[], const void *inbuf, MPI_Aint insi
 	addr2id(outbuf, &mem_attr_1);
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(7, datarep, &mem_attr_0, &insize, position, &mem_attr_1, &outcount, &obj_id_0);
-	int sizes[] = { strlen(datarep)+1, sizeof(MemPtrAttr), sizeof(MPI_Aint), 1*sizeof(MPI_Aint), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MPI_Aint a1;
+		MPI_Aint a2;
+		MemPtrAttr a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, insize, (position ? *position : 0), mem_attr_1, outcount, obj_id_0 };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Unpack_external(const char datarep[], const void *inbuf, MPI_Aint insize, MPI_Aint *position, void *outbuf, int outcount, MPI_Datatype datatype) { return c_MPI_Unpack_external(datarep, inbuf, insize, position, outbuf, outcount, datatype); }
 extern void f_mpi_unpack_external(const char datarep[], const void* inbuf, MPI_Aint insize, MPI_Aint* position, void* outbuf, int* outcount, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -10159,9 +12072,12 @@ int c_MPI_Win_unlock(int rank, MPI_Win win)
 	PILGRIM_TRACING_1(int, MPI_Win_unlock, (rank, win));
 	MPI_Win obj_0 = win;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
-	void **args = assemble_args_list(2, &rank, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { rank, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_unlock(int rank, MPI_Win win) { return c_MPI_Win_unlock(rank, win); }
 extern void f_mpi_win_unlock(int* rank, MPI_Fint* win, MPI_Fint *ierr) {
@@ -10187,9 +12103,13 @@ int c_MPI_Request_get_status(MPI_Request request, int *flag, MPI_Status *status)
 	MPI_Request obj_0 = request;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Request, &obj_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, flag, status_arg);
-	int sizes[] = { sizeof(int), 1*sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2[2];
+	} scalars = { obj_id_0, (flag ? *flag : 0), {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Request_get_status(MPI_Request request, int *flag, MPI_Status *status) { return c_MPI_Request_get_status(request, flag, status); }
 extern void f_mpi_request_get_status(MPI_Fint* request, int* flag, MPI_Fint* status, MPI_Fint *ierr) {
@@ -10220,9 +12140,13 @@ int c_MPI_File_read_at_all_end(MPI_File fh, void *buf, MPI_Status *status)
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_at_all_end(MPI_File fh, void *buf, MPI_Status *status) { return c_MPI_File_read_at_all_end(fh, buf, status); }
 extern void f_mpi_file_read_at_all_end(MPI_Fint* fh, void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -10257,9 +12181,16 @@ int c_MPI_File_set_view(MPI_File fh, MPI_Offset disp, MPI_Datatype etype, MPI_Da
 	int obj_id_2 = MPI_OBJ_ID(MPI_Datatype, &obj_2);
 	MPI_Info obj_3 = info;
 	int obj_id_3 = MPI_OBJ_ID(MPI_Info, &obj_3);
-	void **args = assemble_args_list(5, &obj_id_0, &obj_id_1, &obj_id_2, datarep, &obj_id_3);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), strlen(datarep)+1, sizeof(int) };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, obj_id_1, obj_id_2, obj_id_3 };
+	int tail_size_0 = strlen(datarep)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(datarep, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_set_view(MPI_File fh, MPI_Offset disp, MPI_Datatype etype, MPI_Datatype filetype, const char *datarep, MPI_Info info) { return c_MPI_File_set_view(fh, disp, etype, filetype, datarep, info); }
 extern void f_mpi_file_set_view(MPI_Fint* fh, MPI_Offset disp, MPI_Fint* etype, MPI_Fint* filetype, const char* datarep, MPI_Fint* info, MPI_Fint *ierr) {
@@ -10292,9 +12223,13 @@ int c_MPI_Status_set_elements(MPI_Status *status, MPI_Datatype datatype, int cou
 	int status_arg[2] = {0};
 	MPI_Datatype obj_0 = datatype;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, &obj_0);
-	void **args = assemble_args_list(3, status_arg, &obj_id_0, &count);
-	int sizes[] = { sizeof(int)*2, sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0[2];
+		int a1;
+		int a2;
+	} scalars = { {status_arg[0], status_arg[1]}, obj_id_0, count };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Status_set_elements(MPI_Status *status, MPI_Datatype datatype, int count) { return c_MPI_Status_set_elements(status, datatype, count); }
 extern void f_mpi_status_set_elements(MPI_Fint* status, MPI_Fint* datatype, int* count, MPI_Fint *ierr) {
@@ -10320,9 +12255,14 @@ extern void mpi_status_set_elements__(MPI_Fint* status, MPI_Fint* datatype, int*
 int c_MPI_T_category_get_categories(int cat_index, int len, int indices[])
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_categories, (cat_index, len, indices));
-	void **args = assemble_args_list(3, &cat_index, &len, indices);
-	int sizes[] = { sizeof(int), sizeof(int), len*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { cat_index, len };
+	int tail_size_0 = len*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(indices, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_categories(int cat_index, int len, int indices[]) { return c_MPI_T_category_get_categories(cat_index, len, indices); }
 int c_MPI_Group_range_incl(MPI_Group group, int n, int ranges[][3], MPI_Group *newgroup)
@@ -10331,9 +12271,15 @@ int c_MPI_Group_range_incl(MPI_Group group, int n, int ranges[][3], MPI_Group *n
 	MPI_Group obj_0 = group;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Group, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Group, newgroup);
-	void **args = assemble_args_list(4, &obj_id_0, &n, ranges, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int), n*3*sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, n, obj_id_1 };
+	int tail_size_0 = n*3*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(ranges, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Group_range_incl(MPI_Group group, int n, int ranges[][3], MPI_Group *newgroup) { return c_MPI_Group_range_incl(group, n, ranges, newgroup); }
 extern void f_mpi_group_range_incl(MPI_Fint* group, int* n, int ranges[][3], MPI_Fint* newgroup, MPI_Fint *ierr) {
@@ -10367,9 +12313,18 @@ int c_MPI_Get(void *origin_addr, int origin_count, MPI_Datatype origin_datatype,
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Win obj_2 = win;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Win, &obj_2);
-	void **args = assemble_args_list(8, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(8, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Get(void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win) { return c_MPI_Get(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win); }
 extern void f_mpi_get(void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* win, MPI_Fint *ierr) {
@@ -10406,9 +12361,15 @@ int c_MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *stat
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(tag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(5, &source_rank, &my_tag, &obj_id_0, flag, status_arg);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), 1*sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { source_rank, my_tag, obj_id_0, (flag ? *flag : 0), {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status) { return c_MPI_Iprobe(source, tag, comm, flag, status); }
 extern void f_mpi_iprobe(int* source, int* tag, MPI_Fint* comm, int* flag, MPI_Fint* status, MPI_Fint *ierr) {
@@ -10435,9 +12396,12 @@ int c_MPI_Comm_join(int fd, MPI_Comm *intercomm)
 {
 	PILGRIM_TRACING_1(int, MPI_Comm_join, (fd, intercomm));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, intercomm);
-	void **args = assemble_args_list(2, &fd, &obj_id_0);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { fd, obj_id_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_join(int fd, MPI_Comm *intercomm) { return c_MPI_Comm_join(fd, intercomm); }
 extern void f_mpi_comm_join(int* fd, MPI_Fint* intercomm, MPI_Fint *ierr) {
@@ -10468,9 +12432,15 @@ int c_MPI_File_read_shared(MPI_File fh, void *buf, int count, MPI_Datatype datat
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(5, &obj_id_0, &mem_attr_0, &count, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(5, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4[2];
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_read_shared(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status) { return c_MPI_File_read_shared(fh, buf, count, datatype, status); }
 extern void f_mpi_file_read_shared(MPI_Fint* fh, void* buf, int* count, MPI_Fint* datatype, MPI_Fint* status, MPI_Fint *ierr) {
@@ -10503,9 +12473,12 @@ int c_MPI_Win_detach(MPI_Win win, const void *base)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Win, &obj_0);
 	MemPtrAttr mem_attr_0;
 	addr2id(base, &mem_attr_0);
-	void **args = assemble_args_list(2, &obj_id_0, &mem_attr_0);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+	} scalars = { obj_id_0, mem_attr_0 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Win_detach(MPI_Win win, const void *base) { return c_MPI_Win_detach(win, base); }
 extern void f_mpi_win_detach(MPI_Fint* win, const void* base, MPI_Fint *ierr) {
@@ -10539,9 +12512,16 @@ int c_MPI_Improbe(int source, int tag, MPI_Comm comm, int *flag, MPI_Message *me
 	int status_arg[2] = {0};
 	if(source == MPI_ANY_SOURCE && status && status!=MPI_STATUS_IGNORE) status_arg[0] = status->MPI_SOURCE;
 	if(tag == MPI_ANY_TAG && status && status!=MPI_STATUS_IGNORE) status_arg[1] = status->MPI_TAG;
-	void **args = assemble_args_list(6, &source_rank, &my_tag, &obj_id_0, flag, &obj_id_1, status_arg);
-	int sizes[] = { sizeof(int), sizeof(int), sizeof(int), 1*sizeof(int), sizeof(int), sizeof(int)*2 };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5[2];
+	} scalars = { source_rank, my_tag, obj_id_0, (flag ? *flag : 0), obj_id_1, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Improbe(int source, int tag, MPI_Comm comm, int *flag, MPI_Message *message, MPI_Status *status) { return c_MPI_Improbe(source, tag, comm, flag, message, status); }
 extern void f_mpi_improbe(int* source, int* tag, MPI_Fint* comm, int* flag, MPI_Fint* message, MPI_Fint* status, MPI_Fint *ierr) {
@@ -10581,9 +12561,16 @@ int c_MPI_Ssend(const void *buf, int count, MPI_Datatype datatype, int dest, int
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ssend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) { return c_MPI_Ssend(buf, count, datatype, dest, tag, comm); }
 extern void f_mpi_ssend(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint *ierr) {
@@ -10620,9 +12607,25 @@ int c_MPI_Ineighbor_alltoallw(const void *sendbuf, const int sendcounts[], const
 	for(int i=0; i<comm_size; i++) obj_id_1[i] = (recvtypes==NULL) ? PILGRIM_INVALID_MPI_OBJECT_ID: MPI_OBJ_ID(MPI_Datatype, &recvtypes[i]);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, obj_id_0, &mem_attr_1, recvcounts, rdispls, obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const MPI_Aint), (comm_size)*sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const MPI_Aint), (comm_size)*sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+	} scalars = { mem_attr_0, mem_attr_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const MPI_Aint);
+	int tail_size_2 = (comm_size)*sizeof(int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	int tail_size_4 = comm_size*sizeof(const MPI_Aint);
+	int tail_size_5 = (comm_size)*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3 + tail_size_4 + tail_size_5, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_0, tail_size_2);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_3);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_4);
+	PILGRIM_ENCODE_LOCAL_TAIL(obj_id_1, tail_size_5);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ineighbor_alltoallw(const void *sendbuf, const int sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request) { return c_MPI_Ineighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request); }
 extern void f_mpi_ineighbor_alltoallw(const void* sendbuf, const int sendcounts[], const MPI_Aint sdispls[], MPI_Fint* sendtypes, void* recvbuf, const int recvcounts[], const MPI_Aint rdispls[], MPI_Fint* recvtypes, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -10666,9 +12669,23 @@ int c_MPI_Ineighbor_alltoallv(const void *sendbuf, const int sendcounts[], const
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(9, &mem_attr_0, sendcounts, sdispls, &obj_id_0, &mem_attr_1, recvcounts, rdispls, &obj_id_1, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(MemPtrAttr), comm_size*sizeof(const int), comm_size*sizeof(const int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, comm_size);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		MemPtrAttr a2;
+		int a3;
+		int a4;
+	} scalars = { mem_attr_0, obj_id_0, mem_attr_1, obj_id_1, obj_id_2 };
+	int tail_size_0 = comm_size*sizeof(const int);
+	int tail_size_1 = comm_size*sizeof(const int);
+	int tail_size_2 = comm_size*sizeof(const int);
+	int tail_size_3 = comm_size*sizeof(const int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1 + tail_size_2 + tail_size_3, comm_size);
+	PILGRIM_ENCODE_TAIL(sendcounts, tail_size_0);
+	PILGRIM_ENCODE_TAIL(sdispls, tail_size_1);
+	PILGRIM_ENCODE_TAIL(recvcounts, tail_size_2);
+	PILGRIM_ENCODE_TAIL(rdispls, tail_size_3);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ineighbor_alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request); }
 extern void f_mpi_ineighbor_alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Fint* sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Fint* recvtype, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -10700,19 +12717,31 @@ extern void mpi_ineighbor_alltoallv__(const void* sendbuf, const int sendcounts[
 int c_MPI_T_category_get_cvars(int cat_index, int len, int indices[])
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_cvars, (cat_index, len, indices));
-	void **args = assemble_args_list(3, &cat_index, &len, indices);
-	int sizes[] = { sizeof(int), sizeof(int), len*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { cat_index, len };
+	int tail_size_0 = len*sizeof(int);
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(indices, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_cvars(int cat_index, int len, int indices[]) { return c_MPI_T_category_get_cvars(cat_index, len, indices); }
 int c_MPI_Errhandler_free(MPI_Errhandler *errhandler)
 {
+	if(logger_paused(ID_MPI_Errhandler_free)) {
+		MPI_OBJ_RELEASE(MPI_Errhandler, errhandler);
+		PILGRIM_PMPI_CALL(int, MPI_Errhandler_free, (errhandler));
+		return res;
+	}
 	int obj_id_0 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(1, &obj_id_0);
 	MPI_OBJ_RELEASE(MPI_Errhandler, errhandler);
-	int sizes[] = { sizeof(int) };
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { obj_id_0 };
 	PILGRIM_TRACING_1(int, MPI_Errhandler_free, (errhandler));
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Errhandler_free(MPI_Errhandler *errhandler) { return c_MPI_Errhandler_free(errhandler); }
 extern void f_mpi_errhandler_free(MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -10735,12 +12764,15 @@ extern void mpi_errhandler_free__(MPI_Fint* errhandler, MPI_Fint *ierr) {
 }
 int c_MPI_Topo_test(MPI_Comm comm, int *status)
 {
-	PILGRIM_TRACING_1(int, MPI_Topo_test, (comm, status));
+	PILGRIM_QUERY_1(int, MPI_Topo_test, (comm, status));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(2, &obj_id_0, status);
-	int sizes[] = { sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, (status ? *status : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Topo_test(MPI_Comm comm, int *status) { return c_MPI_Topo_test(comm, status); }
 extern void f_mpi_topo_test(MPI_Fint* comm, int* status, MPI_Fint *ierr) {
@@ -10773,9 +12805,17 @@ int c_MPI_Ireduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype da
 	int obj_id_1 = MPI_OBJ_ID(MPI_Op, &obj_1);
 	MPI_Comm obj_2 = comm;
 	int obj_id_2 = MPI_OBJ_ID(MPI_Comm, &obj_2);
-	void **args = assemble_args_list(7, &mem_attr_0, &mem_attr_1, &count, &obj_id_0, &obj_id_1, &root, &obj_id_2);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(7, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+		int a6;
+	} scalars = { mem_attr_0, mem_attr_1, count, obj_id_0, obj_id_1, root, obj_id_2 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Ireduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm, MPI_Request *request) { return c_MPI_Ireduce(sendbuf, recvbuf, count, datatype, op, root, comm, request); }
 extern void f_mpi_ireduce(const void* sendbuf, void* recvbuf, int* count, MPI_Fint* datatype, MPI_Fint* op, int* root, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -10808,9 +12848,12 @@ int c_MPI_File_get_errhandler(MPI_File file, MPI_Errhandler *errhandler)
 	MPI_File obj_0 = file;
 	int obj_id_0 = MPI_OBJ_ID(MPI_File, &obj_0);
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, errhandler);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_get_errhandler(MPI_File file, MPI_Errhandler *errhandler) { return c_MPI_File_get_errhandler(file, errhandler); }
 extern void f_mpi_file_get_errhandler(MPI_Fint* file, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -10847,9 +12890,16 @@ int c_MPI_Bsend_init(const void *buf, int count, MPI_Datatype datatype, int dest
 	if(my_tag == MPI_ANY_TAG) my_tag = PILGRIM_MPI_ANY_TAG;
 	MPI_Comm obj_1 = comm;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Comm, &obj_1);
-	void **args = assemble_args_list(6, &mem_attr_0, &count, &obj_id_0, &dest_rank, &my_tag, &obj_id_1);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(6, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		int a5;
+	} scalars = { mem_attr_0, count, obj_id_0, dest_rank, my_tag, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Bsend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request) { return c_MPI_Bsend_init(buf, count, datatype, dest, tag, comm, request); }
 extern void f_mpi_bsend_init(const void* buf, int* count, MPI_Fint* datatype, int* dest, int* tag, MPI_Fint* comm, MPI_Fint* request, MPI_Fint *ierr) {
@@ -10877,9 +12927,13 @@ extern void mpi_bsend_init__(const void* buf, int* count, MPI_Fint* datatype, in
 int c_MPI_Add_error_string(int errorcode, const char *string)
 {
 	PILGRIM_TRACING_1(int, MPI_Add_error_string, (errorcode, string));
-	void **args = assemble_args_list(2, &errorcode, string);
-	int sizes[] = { sizeof(int), strlen(string)+1 };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { errorcode };
+	int tail_size_0 = strlen(string)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0, -1);
+	PILGRIM_ENCODE_TAIL(string, tail_size_0);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Add_error_string(int errorcode, const char *string) { return c_MPI_Add_error_string(errorcode, string); }
 extern void f_mpi_add_error_string(int* errorcode, const char* string, MPI_Fint *ierr) {
@@ -10910,9 +12964,19 @@ int c_MPI_Accumulate(const void *origin_addr, int origin_count, MPI_Datatype ori
 	int obj_id_2 = MPI_OBJ_ID(MPI_Op, &obj_2);
 	MPI_Win obj_3 = win;
 	int obj_id_3 = MPI_OBJ_ID(MPI_Win, &obj_3);
-	void **args = assemble_args_list(9, &mem_attr_0, &origin_count, &obj_id_0, &target_rank, &target_disp, &target_count, &obj_id_1, &obj_id_2, &obj_id_3);
-	int sizes[] = { sizeof(MemPtrAttr), sizeof(int), sizeof(int), sizeof(int), sizeof(MPI_Aint), sizeof(int), sizeof(int), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(9, sizes, args, -1);
+	struct __attribute__((packed)) {
+		MemPtrAttr a0;
+		int a1;
+		int a2;
+		int a3;
+		MPI_Aint a4;
+		int a5;
+		int a6;
+		int a7;
+		int a8;
+	} scalars = { mem_attr_0, origin_count, obj_id_0, target_rank, target_disp, target_count, obj_id_1, obj_id_2, obj_id_3 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win) { return c_MPI_Accumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win); }
 extern void f_mpi_accumulate(const void* origin_addr, int* origin_count, MPI_Fint* origin_datatype, int* target_rank, MPI_Aint target_disp, int* target_count, MPI_Fint* target_datatype, MPI_Fint* op, MPI_Fint* win, MPI_Fint *ierr) {
@@ -10941,9 +13005,11 @@ extern void mpi_accumulate__(const void* origin_addr, int* origin_count, MPI_Fin
 int c_MPI_T_category_get_num(int *num_cat)
 {
 	PILGRIM_TRACING_1(int, MPI_T_category_get_num, (num_cat));
-	void **args = assemble_args_list(1, num_cat);
-	int sizes[] = { 1*sizeof(int) };
-	PILGRIM_TRACING_2(1, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+	} scalars = { (num_cat ? *num_cat : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_category_get_num(int *num_cat) { return c_MPI_T_category_get_num(num_cat); }
 int c_MPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler)
@@ -10953,9 +13019,12 @@ int c_MPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler)
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
 	MPI_Errhandler obj_1 = errhandler;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Errhandler, &obj_1);
-	void **args = assemble_args_list(2, &obj_id_0, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(2, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+	} scalars = { obj_id_0, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler) { return c_MPI_Comm_set_errhandler(comm, errhandler); }
 extern void f_mpi_comm_set_errhandler(MPI_Fint* comm, MPI_Fint* errhandler, MPI_Fint *ierr) {
@@ -10987,9 +13056,14 @@ int c_MPI_File_write_ordered_begin(MPI_File fh, const void *buf, int count, MPI_
 	addr2id(buf, &mem_attr_0);
 	MPI_Datatype obj_1 = datatype;
 	int obj_id_1 = MPI_OBJ_ID(MPI_Datatype, &obj_1);
-	void **args = assemble_args_list(4, &obj_id_0, &mem_attr_0, &count, &obj_id_1);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int), sizeof(int) };
-	PILGRIM_TRACING_2(4, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2;
+		int a3;
+	} scalars = { obj_id_0, mem_attr_0, count, obj_id_1 };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_ordered_begin(MPI_File fh, const void *buf, int count, MPI_Datatype datatype) { return c_MPI_File_write_ordered_begin(fh, buf, count, datatype); }
 extern void f_mpi_file_write_ordered_begin(MPI_Fint* fh, const void* buf, int* count, MPI_Fint* datatype, MPI_Fint *ierr) {
@@ -11020,9 +13094,13 @@ int c_MPI_File_write_ordered_end(MPI_File fh, const void *buf, MPI_Status *statu
 	MemPtrAttr mem_attr_0;
 	addr2id(buf, &mem_attr_0);
 	int status_arg[2] = {0};
-	void **args = assemble_args_list(3, &obj_id_0, &mem_attr_0, status_arg);
-	int sizes[] = { sizeof(int), sizeof(MemPtrAttr), sizeof(int)*2 };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		MemPtrAttr a1;
+		int a2[2];
+	} scalars = { obj_id_0, mem_attr_0, {status_arg[0], status_arg[1]} };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_File_write_ordered_end(MPI_File fh, const void *buf, MPI_Status *status) { return c_MPI_File_write_ordered_end(fh, buf, status); }
 extern void f_mpi_file_write_ordered_end(MPI_Fint* fh, const void* buf, MPI_Fint* status, MPI_Fint *ierr) {
@@ -11048,12 +13126,16 @@ extern void mpi_file_write_ordered_end__(MPI_Fint* fh, const void* buf, MPI_Fint
 }
 int c_MPI_Graphdims_get(MPI_Comm comm, int *nnodes, int *nedges)
 {
-	PILGRIM_TRACING_1(int, MPI_Graphdims_get, (comm, nnodes, nedges));
+	PILGRIM_QUERY_1(int, MPI_Graphdims_get, (comm, nnodes, nedges));
 	MPI_Comm obj_0 = comm;
 	int obj_id_0 = MPI_OBJ_ID(MPI_Comm, &obj_0);
-	void **args = assemble_args_list(3, &obj_id_0, nnodes, nedges);
-	int sizes[] = { sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(3, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+	} scalars = { obj_id_0, (nnodes ? *nnodes : 0), (nedges ? *nedges : 0) };
+	PILGRIM_TRACING_2_BEGIN(scalars, 0, -1);
+	PILGRIM_QUERY_2_END();
 }
 int MPI_Graphdims_get(MPI_Comm comm, int *nnodes, int *nedges) { return c_MPI_Graphdims_get(comm, nnodes, nedges); }
 extern void f_mpi_graphdims_get(MPI_Fint* comm, int* nnodes, int* nedges, MPI_Fint *ierr) {
@@ -11077,8 +13159,24 @@ int c_MPI_T_pvar_get_info(int pvar_index, char *name, int *name_len, int *verbos
 {
 	PILGRIM_TRACING_1(int, MPI_T_pvar_get_info, (pvar_index, name, name_len, verbosity, var_class, datatype, enumtype, desc, desc_len, bind, readonly, continuous, atomic));
 	int obj_id_0 = MPI_OBJ_ID(MPI_Datatype, datatype);
-	void **args = assemble_args_list(13, &pvar_index, name, name_len, verbosity, var_class, &obj_id_0, enumtype, desc, desc_len, bind, readonly, continuous, atomic);
-	int sizes[] = { sizeof(int), strlen(name)+1, 1*sizeof(int), 1*sizeof(int), 1*sizeof(int), sizeof(int), 1*sizeof(MPI_T_enum), strlen(desc)+1, 1*sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int), 1*sizeof(int) };
-	PILGRIM_TRACING_2(13, sizes, args, -1);
+	struct __attribute__((packed)) {
+		int a0;
+		int a1;
+		int a2;
+		int a3;
+		int a4;
+		MPI_T_enum a5;
+		int a6;
+		int a7;
+		int a8;
+		int a9;
+		int a10;
+	} scalars = { pvar_index, (name_len ? *name_len : 0), (verbosity ? *verbosity : 0), (var_class ? *var_class : 0), obj_id_0, (enumtype ? *enumtype : 0), (desc_len ? *desc_len : 0), (bind ? *bind : 0), (readonly ? *readonly : 0), (continuous ? *continuous : 0), (atomic ? *atomic : 0) };
+	int tail_size_0 = strlen(name)+1;
+	int tail_size_1 = strlen(desc)+1;
+	PILGRIM_TRACING_2_BEGIN(scalars, tail_size_0 + tail_size_1, -1);
+	PILGRIM_ENCODE_TAIL(name, tail_size_0);
+	PILGRIM_ENCODE_TAIL(desc, tail_size_1);
+	PILGRIM_TRACING_2_END();
 }
 int MPI_T_pvar_get_info(int pvar_index, char *name, int *name_len, int *verbosity, int *var_class, MPI_Datatype *datatype, MPI_T_enum *enumtype, char *desc, int *desc_len, int *bind, int *readonly, int *continuous, int *atomic) { return c_MPI_T_pvar_get_info(pvar_index, name, name_len, verbosity, var_class, datatype, enumtype, desc, desc_len, bind, readonly, continuous, atomic); }
@@ -156,19 +156,45 @@ int get_request_id(MPI_Request* req) {
     return MPI_OBJ_ID(MPI_Request, req);
 }
 
+// Tracing is paused or the function is filtered out,
+// no request ids or signatures are generated.
+// Only release the completed requests, so a reused handle
+// does not pick up a stale id when tracing resumes.
+static void complete_paused_requests(int count, MPI_Request old_reqs[], MPI_Request new_reqs[], bool idup) {
+    int i;
+    for(i = 0; i < count; i++) {
+        if(old_reqs[i] == MPI_REQUEST_NULL || new_reqs[i] != MPI_REQUEST_NULL)
+            continue;
+        if(idup)
+            check_idup_request(&old_reqs[i]);
+        MPI_OBJ_RELEASE(MPI_Request, &old_reqs[i]);
+    }
+}
+
+#define PAUSED_REQUESTS_CALL(count, reqs, func, func_args, idup)                                   \
+    if(logger_paused(ID_##func)) {                                                                  \
+        MPI_Request paused_reqs[count];                                                             \
+        memcpy(paused_reqs, reqs, sizeof(MPI_Request)*(count));                                     \
+        PILGRIM_PMPI_CALL(int, func, func_args);                                                    \
+        complete_paused_requests(count, paused_reqs, reqs, idup);                                   \
+        return res;                                                                                 \
+    }
+
 
 int MPI_Pcontrol(const int level, ...)
 {
-	void **args = assemble_args_list(1, &level);
-	int sizes[] = { sizeof(level) };
 	va_list pcontrol_args;
 	va_start(pcontrol_args, level);
     PILGRIM_TRACING_1(int, MPI_Pcontrol, (level, pcontrol_args));
+	void **args = assemble_args_list(1, &level);
+	int sizes[] = { sizeof(level) };
     PILGRIM_TRACING_2(1, sizes, args, -1);
 }
 
 int imp_MPI_Wait(MPI_Request *request, MPI_Status *status)
 {
+    PAUSED_REQUESTS_CALL(1, request, MPI_Wait, (request, status), true);
+
     MPI_Request old_req;
     memcpy(&old_req, request, sizeof(MPI_Request));
 
@@ -199,6 +225,8 @@ extern void mpi_wait_(MPI_Fint* request, MPI_Fint* status, MPI_Fint* ierr) {
 
 int MPI_Waitany(int count, MPI_Request array_of_requests[], int *index, MPI_Status *status)
 {
+    PAUSED_REQUESTS_CALL(count, array_of_requests, MPI_Waitany, (count, array_of_requests, index, status), true);
+
     COPY_REQUESTS(count);
 
     PILGRIM_TRACING_1(int, MPI_Waitany, (count, array_of_requests, index, status));
@@ -221,6 +249,7 @@ int MPI_Waitany(int count, MPI_Request array_of_requests[], int *index, MPI_Stat
 
 int MPI_Waitsome(int incount, MPI_Request array_of_requests[], int *outcount, int array_of_indices[], MPI_Status array_of_statuses[])
 {
+    PAUSED_REQUESTS_CALL(incount, array_of_requests, MPI_Waitsome, (incount, array_of_requests, outcount, array_of_indices, array_of_statuses), true);
 
     COPY_REQUESTS(incount);
 
@@ -245,6 +274,7 @@ int MPI_Waitsome(int incount, MPI_Request array_of_requests[], int *outcount, in
 
 int imp_MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[])
 {
+    PAUSED_REQUESTS_CALL(count, array_of_requests, MPI_Waitall, (count, array_of_requests, array_of_statuses), true);
 
     COPY_REQUESTS(count);
 
@@ -279,6 +309,8 @@ extern void mpi_waitall_(int *count, MPI_Fint* array_of_requests, MPI_Fint* arra
 
 int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status)
 {
+    PAUSED_REQUESTS_CALL(1, request, MPI_Test, (request, flag, status), false);
+
     MPI_Request old_req;
     memcpy(&old_req, request, sizeof(MPI_Request));
 
@@ -293,6 +325,8 @@ int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status)
 
 int MPI_Testany(int count, MPI_Request array_of_requests[], int *index, int *flag, MPI_Status *status)
 {
+    PAUSED_REQUESTS_CALL(count, array_of_requests, MPI_Testany, (count, array_of_requests, index, flag, status), false);
+
     COPY_REQUESTS(count);
 
     PILGRIM_TRACING_1(int, MPI_Testany, (count, array_of_requests, index, flag, status));
@@ -314,6 +348,8 @@ int MPI_Testany(int count, MPI_Request array_of_requests[], int *index, int *fla
 
 int MPI_Testall(int count, MPI_Request array_of_requests[], int *flag, MPI_Status array_of_statuses[])
 {
+    PAUSED_REQUESTS_CALL(count, array_of_requests, MPI_Testall, (count, array_of_requests, flag, array_of_statuses), false);
+
     COPY_REQUESTS(count);
 
     PILGRIM_TRACING_1(int, MPI_Testall, (count, array_of_requests, flag, array_of_statuses));
@@ -325,7 +361,7 @@ int MPI_Testall(int count, MPI_Request array_of_requests[], int *flag, MPI_Statu
     if(*flag) {
         num_args = 4;
         GET_STATUSES_INFO(count, indices, array_of_statuses);
-        void **args = assemble_args_list(num_args, &count, ids, flag);
+        void **args = assemble_args_list(num_args, &count, ids, flag, statuses_info);
         int sizes[] = { sizeof(count), count*sizeof(int), sizeof(int), sizeof(statuses_info)};
         PILGRIM_TRACING_2(num_args, sizes, args, -1);
     } else {
@@ -340,6 +376,7 @@ int MPI_Testall(int count, MPI_Request array_of_requests[], int *flag, MPI_Statu
 
 int MPI_Testsome(int incount, MPI_Request array_of_requests[], int *outcount, int array_of_indices[], MPI_Status array_of_statuses[])
 {
+    PAUSED_REQUESTS_CALL(incount, array_of_requests, MPI_Testsome, (incount, array_of_requests, outcount, array_of_indices, array_of_statuses), false);
     COPY_REQUESTS(incount);
 
 	PILGRIM_TRACING_1(int, MPI_Testsome, (incount, array_of_requests, outcount, array_of_indices, array_of_statuses));
@@ -361,6 +398,12 @@ int MPI_Testsome(int incount, MPI_Request array_of_requests[], int *outcount, in
 
 int MPI_Request_free(MPI_Request *request)
 {
+    if(logger_paused(ID_MPI_Request_free)) {
+        MPI_OBJ_RELEASE(MPI_Request, request);
+        PILGRIM_PMPI_CALL(int, MPI_Request_free, (request));
+        return res;
+    }
+
     int id = get_request_id(request);
     MPI_OBJ_RELEASE(MPI_Request, request);
 
@@ -373,13 +416,14 @@ int MPI_Request_free(MPI_Request *request)
 
 int MPI_Startall(int count, MPI_Request array_of_requests[])
 {
+    PILGRIM_TRACING_1(int, MPI_Startall, (count, array_of_requests));
+
+    // MPI_Startall() does not change the handles
     int ids[count];
     int idx;
     for (idx = 0; idx < count; idx++)
         ids[idx] = get_request_id(&array_of_requests[idx]);
 
-    PILGRIM_TRACING_1(int, MPI_Startall, (count, array_of_requests));
-
     void **args = assemble_args_list(2, &count, ids);
     int sizes[] = { sizeof(int), count*sizeof(int) };
 
@@ -519,6 +563,11 @@ void check_color_key_pattern(int* recvbuf, int size, int* color_pattern, int* ke
 
 int imp_MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm)
 {
+	if(logger_paused(ID_MPI_Comm_split)) {
+		PILGRIM_PMPI_CALL(int, MPI_Comm_split, (comm, color, key, newcomm));
+		generate_intracomm_id(newcomm);
+		return res;
+	}
 	PILGRIM_TRACING_1(int, MPI_Comm_split, (comm, color, key, newcomm));
 	generate_intracomm_id(newcomm);
 	MPI_Comm obj_0 = comm;
@@ -0,0 +1,32 @@
+##
+## Copyright (C) by Argonne National Laboratory
+##     See COPYRIGHT in top-level directory
+##
+
+## Microbenchmarks, not built by default: make bench_cst bench_slab bench_sequitur
+
+EXTRA_PROGRAMS += bench_cst
+
+bench_cst_SOURCES = test/bench/bench_cst.c src/pilgrim_cst.c src/pilgrim_slab.c src/pilgrim_utils.c src/dlmalloc.c
+bench_cst_CFLAGS = $(AM_CFLAGS) -O2
+bench_cst_LDFLAGS = -lm
+
+EXTRA_PROGRAMS += bench_slab
+
+bench_slab_SOURCES = test/bench/bench_slab.c src/pilgrim_slab.c src/pilgrim_utils.c src/dlmalloc.c \
+	src/pilgrim_sequitur.c src/pilgrim_sequitur_digram.c src/pilgrim_sequitur_symbol.c \
+	src/pilgrim_sequitur_logger.c src/pilgrim_sequitur_spill.c src/pilgrim_sequitur_loops.c src/pilgrim_varint.c
+bench_slab_CFLAGS = $(AM_CFLAGS) -O2
+bench_slab_LDFLAGS = -lm
+
+EXTRA_PROGRAMS += bench_sequitur
+
+# No pilgrim_utils.c, bench_sequitur.c has its own stub pilgrim_malloc(),
+# dlmalloc.c is only for uthash
+bench_sequitur_SOURCES = test/bench/bench_sequitur.c \
+	src/pilgrim_sequitur.c src/pilgrim_sequitur_digram.c src/pilgrim_sequitur_symbol.c \
+	src/pilgrim_sequitur_logger.c src/pilgrim_sequitur_spill.c src/pilgrim_sequitur_loops.c src/pilgrim_sequitur_utils.c \
+	src/decoder/pilgrim_cfg_decoder.c src/decoder/pilgrim_metadata_decoder.c src/decoder/pilgrim_time_decoder.c \
+	src/pilgrim_varint.c src/dlmalloc.c
+bench_sequitur_CFLAGS = $(AM_CFLAGS) -O2
+bench_sequitur_LDFLAGS = -lm
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Microbenchmark: Call Signature Table lookups,
+ * the open-addressing CST (pilgrim_cst.h) vs. uthash.
+ *
+ * Each workload has a fixed set of unique signatures whose key sizes
+ * follow what we see in real traces (func_id + tid + arguments):
+ *   Comm_rank/size       14 bytes
+ *   Wait/Test            22 bytes    (req id + status info)
+ *   Isend/Irecv          62 bytes    (MemPtrAttr + 6 ints)
+ *   Allreduce/Reduce     86 bytes    (2 MemPtrAttrs + 4 ints)
+ *   Waitall(8)          138 bytes    (8 req ids + 8 status infos)
+ *   Alltoallv(P)    ~16*P+86 bytes   (4 arrays of comm_size ints)
+ *
+ * Then a stream of lookups is replayed, a miss inserts the key,
+ * exactly like write_record() does.
+ *
+ * Usage: ./bench_cst [lookups=4000000] [unique=1024]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "uthash.h"
+#include "pilgrim_cst.h"
+
+typedef struct UTEntry_t {
+    void *key;
+    int key_len;
+    unsigned count;
+    UT_hash_handle hh;
+} UTEntry;
+
+typedef struct KeyClass_t {
+    const char *name;
+    int key_len;
+    int weight;             // percentage
+} KeyClass;
+
+typedef struct Workload_t {
+    const char *name;
+    KeyClass classes[6];
+    int num_classes;
+} Workload;
+
+static Workload workloads[] = {
+    { "p2p (stencil-like)", {
+        {"Comm_rank", 14, 5}, {"Wait", 22, 40}, {"Isend/Irecv", 62, 45}, {"Waitall(8)", 138, 10}
+      }, 4 },
+    { "mixed", {
+        {"Comm_rank", 14, 10}, {"Wait", 22, 25}, {"Isend/Irecv", 62, 30},
+        {"Allreduce", 86, 20}, {"Waitall(8)", 138, 10}, {"Alltoallv(64)", 16*64+86, 5}
+      }, 6 },
+    { "collective (Alltoallv P=1024)", {
+        {"Allreduce", 86, 50}, {"Alltoallv(1024)", 16*1024+86, 50}
+      }, 2 },
+};
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Unique keys that only differ in a few bytes, like real signatures do
+static void** make_keys(Workload *w, int unique, int **key_lens) {
+    void **keys = malloc(sizeof(void*) * unique);
+    *key_lens = malloc(sizeof(int) * unique);
+
+    for(int i = 0; i < unique; i++) {
+        int r = rand() % 100, c = 0, acc = w->classes[0].weight;
+        while(r >= acc && c < w->num_classes-1)
+            acc += w->classes[++c].weight;
+
+        int len = w->classes[c].key_len;
+        unsigned char *key = calloc(len, 1);
+        short func_id = c;
+        memcpy(key, &func_id, sizeof(short));
+        for(int j = sizeof(short) + sizeof(int); j + 4 <= len; j += 4) {
+            int v = (j / 4) % 7;
+            memcpy(key+j, &v, sizeof(int));
+        }
+        // make it unique: change one argument (e.g., tag/count) near the end
+        int pos = len - 8 > 6 ? len - 8 : 6;
+        memcpy(key+pos, &i, sizeof(int));
+
+        keys[i] = key;
+        (*key_lens)[i] = len;
+    }
+    return keys;
+}
+
+static double bench_uthash(void **keys, int *key_lens, int *stream, int lookups) {
+    UTEntry *table = NULL, *entry, *tmp;
+    double t = now();
+    for(int i = 0; i < lookups; i++) {
+        void *key = keys[stream[i]];
+        int key_len = key_lens[stream[i]];
+        HASH_FIND(hh, table, key, key_len, entry);
+        if(entry) {
+            entry->count++;
+        } else {
+            entry = malloc(sizeof(UTEntry));
+            entry->key = malloc(key_len);
+            memcpy(entry->key, key, key_len);
+            entry->key_len = key_len;
+            entry->count = 1;
+            HASH_ADD_KEYPTR(hh, table, entry->key, entry->key_len, entry);
+        }
+    }
+    t = now() - t;
+
+    HASH_ITER(hh, table, entry, tmp) {
+        HASH_DEL(table, entry);
+        free(entry->key);
+        free(entry);
+    }
+    return t;
+}
+
+static double bench_cst(void **keys, int *key_lens, int *stream, int lookups) {
+    CallSignatureTable table;
+    cst_init(&table);
+    double t = now();
+    for(int i = 0; i < lookups; i++) {
+        void *key = keys[stream[i]];
+        int key_len = key_lens[stream[i]];
+        uint64_t hash = cst_hash(key, key_len);
+        RecordHash *entry = cst_find(&table, key, key_len, hash);
+        if(entry) {
+            entry->count++;
+        } else {
+            entry = cst_insert(&table, key, key_len, hash);
+            entry->count = 1;
+        }
+    }
+    t = now() - t;
+    cst_cleanup(&table);
+    return t;
+}
+
+int main(int argc, char *argv[]) {
+    int lookups = 4000000, unique = 1024;
+    if(argc > 1) lookups = atoi(argv[1]);
+    if(argc > 2) unique = atoi(argv[2]);
+
+    int *stream = malloc(sizeof(int) * lookups);
+
+    printf("%-32s %10s %14s %14s %8s\n", "workload", "avg key", "uthash ns/op", "cst ns/op", "speedup");
+    for(size_t w = 0; w < sizeof(workloads)/sizeof(Workload); w++) {
+        srand(w + 1);
+        int *key_lens;
+        void **keys = make_keys(&workloads[w], unique, &key_lens);
+
+        // Hot signatures are called much more often
+        double avg_len = 0;
+        for(int i = 0; i < lookups; i++) {
+            int r = rand() % unique;
+            stream[i] = (rand() % 4) ? r % (unique/16 + 1) : r;
+            avg_len += key_lens[stream[i]];
+        }
+        avg_len /= lookups;
+
+        // warm up once, then measure
+        bench_uthash(keys, key_lens, stream, lookups/10);
+        bench_cst(keys, key_lens, stream, lookups/10);
+        double t_ut  = bench_uthash(keys, key_lens, stream, lookups);
+        double t_cst = bench_cst(keys, key_lens, stream, lookups);
+
+        printf("%-32s %10.1f %14.1f %14.1f %7.2fx\n", workloads[w].name, avg_len,
+                t_ut*1e9/lookups, t_cst*1e9/lookups, t_ut/t_cst);
+
+        for(int i = 0; i < unique; i++)
+            free(keys[i]);
+        free(keys);
+        free(key_lens);
+    }
+
+    free(stream);
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Microbenchmark: the Sequitur grammar engine alone, no MPI run needed.
+ *
+ * pilgrim_sequitur*.c are linked against the stub allocator below,
+ * which counts the bytes in use, so the peak memory is exactly what
+ * the grammar arrays and the digram table take.
+ *
+ * Terminal streams, consecutive equal terminals are merged into one
+ * terminal with exp = count, like the logger's PendingRun does:
+ *   nested    nested loops, depth 1 to 4 in turn
+ *   stencil   3D halo exchange: 6 Irecv, 6 Isend, Waitall, Allreduce every 10 steps
+ *   random    uniform noise over 64 terminals
+ *   drift     a loop whose trip count slowly changes (8 to 23)
+ *   replay    the decoded grammars of a trace directory (pilgrim-logs),
+ *             one stream per unique grammar, appended back to back
+ *
+ * For each stream: ns per appended symbol, peak memory while appending,
+ * peak memory of serialize_grammar() (its output included), number of
+ * rules and size of serialize_grammar(). PILGRIM_MAX_GRAMMAR_MB is
+ * honored, the spill file goes to the current directory.
+ *
+ * Usage: ./bench_sequitur [symbols=4000000] [trace dir]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pilgrim_sequitur.h"
+#include "pilgrim_reader.h"
+#include "pilgrim_utils.h"
+
+static size_t bytes_in_use, peak_bytes;
+
+/* Stub allocator, replaces the one in pilgrim_utils.c */
+void* pilgrim_malloc(size_t size) {
+    bytes_in_use += size;
+    if(bytes_in_use > peak_bytes)
+        peak_bytes = bytes_in_use;
+    return malloc(size);
+}
+
+void pilgrim_free(void* ptr, size_t size) {
+    bytes_in_use -= size;
+    free(ptr);
+}
+
+int min_in_array(int* arr, size_t len) {
+    int min = arr[0];
+    for(size_t i = 1; i < len; i++)
+        if(arr[i] < min) min = arr[i];
+    return min;
+}
+
+CFG* read_cfg(GlobalMetadata* gm);
+void free_cfg(CFG* cfg);
+GlobalMetadata* read_metadata(const char* trace_dir);
+void free_metadata(GlobalMetadata* gm);
+
+
+typedef struct Stream_t {
+    const char *name;
+    int *vals, *exps;
+    int len, capacity;
+} Stream;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void stream_init(Stream *s, const char *name, int capacity) {
+    s->name = name;
+    s->len = 0;
+    s->capacity = capacity;
+    s->vals = malloc(sizeof(int) * capacity);
+    s->exps = malloc(sizeof(int) * capacity);
+}
+
+static void stream_free(Stream *s) {
+    free(s->vals);
+    free(s->exps);
+}
+
+static bool stream_full(Stream *s) {
+    return s->len == s->capacity;
+}
+
+static void push_run(Stream *s, int val, int exp) {
+    if(s->len > 0 && s->vals[s->len-1] == val) {
+        s->exps[s->len-1] += exp;
+    } else if(!stream_full(s)) {
+        s->vals[s->len] = val;
+        s->exps[s->len++] = exp;
+    }
+}
+
+static void push(Stream *s, int val) {
+    push_run(s, val, 1);
+}
+
+static unsigned rnd(unsigned *x) {
+    *x = *x * 1103515245 + 12345;
+    return *x >> 16;
+}
+
+static void nest(Stream *s, int level, int depth) {
+    static const int trips[] = {3, 5, 4, 6};
+    for(int i = 0; i < trips[level] && !stream_full(s); i++) {
+        push(s, level*10);
+        if(level + 1 < depth)
+            nest(s, level+1, depth);
+        push(s, level*10 + 1);
+    }
+}
+
+static void make_nested(Stream *s) {
+    for(int iter = 0; !stream_full(s); iter++) {
+        nest(s, 0, 1 + iter % 4);
+        push(s, 100);
+    }
+}
+
+static void make_stencil(Stream *s) {
+    for(int iter = 0; !stream_full(s); iter++) {
+        for(int nb = 0; nb < 6; nb++)
+            push(s, 10 + nb);           // Irecv
+        for(int nb = 0; nb < 6; nb++)
+            push(s, 20 + nb);           // Isend
+        push(s, 30);                    // Waitall
+        if(iter % 10 == 0)
+            push(s, 40);                // Allreduce
+    }
+}
+
+static void make_random(Stream *s) {
+    unsigned x = 1;
+    while(!stream_full(s))
+        push(s, rnd(&x) % 64);
+}
+
+static void make_drift(Stream *s) {
+    for(int iter = 0; !stream_full(s); iter++) {
+        int trips = 8 + (iter / 64) % 16;
+        for(int i = 0; i < trips; i++) {
+            push(s, 1);
+            push(s, 2);
+        }
+        push(s, 3);
+    }
+}
+
+static void make_replay(Stream *s, const char *trace_dir) {
+    GlobalMetadata *gm = read_metadata(trace_dir);
+    CFG *cfg = read_cfg(gm);
+
+    int total = 0;
+    for(int ugi = 0; ugi < cfg->num_grammars; ugi++)
+        total += cfg->num_symbols[ugi] / 2;
+    stream_init(s, "replay", total);
+
+    for(int ugi = 0; ugi < cfg->num_grammars; ugi++)
+        for(int i = 0; i < cfg->num_symbols[ugi]; i += 2)
+            push_run(s, cfg->unique_grammars[ugi][i], cfg->unique_grammars[ugi][i+1]);
+
+    free_cfg(cfg);
+    free_metadata(gm);
+}
+
+static void bench_stream(Stream *s, size_t max_bytes, bool report) {
+    Grammar grammar;
+    size_t base = bytes_in_use;
+    peak_bytes = bytes_in_use;
+
+    sequitur_init(&grammar);
+    if(max_bytes)
+        sequitur_set_limit(&grammar, max_bytes, "bench_sequitur.spill");
+
+    double t0 = now();
+    for(int i = 0; i < s->len; i++) {
+        append_terminal(&grammar, s->vals[i], s->exps[i]);
+        if(grammar.spill && sequitur_should_freeze(&grammar))
+            sequitur_freeze(&grammar);
+    }
+    double t1 = now();
+    size_t peak = peak_bytes - base;
+
+    // The spill file is streamed, never loaded back
+    int segments = grammar.spill ? grammar.spill->segments : 0;
+    int integers;
+    int *serialized = serialize_grammar(&grammar, &integers);
+    int rules = serialized[0];
+    size_t final_peak = peak_bytes - base;
+    pilgrim_free(serialized, sizeof(int) * integers);
+    sequitur_cleanup(&grammar);
+    if(!report) return;
+
+    printf("%-8s %10d %10.1f %10.2f %10.2f %10d %12.1f", s->name, s->len, (t1-t0)*1e9/s->len,
+            peak/1024.0/1024.0, final_peak/1024.0/1024.0, rules, integers*sizeof(int)/1024.0);
+    if(segments)
+        printf("   (%d segments)", segments);
+    printf("\n");
+}
+
+int main(int argc, char *argv[]) {
+    int symbols = 4000000;
+    if(argc > 1) symbols = atoi(argv[1]);
+    const char *trace_dir = argc > 2 ? argv[2] : NULL;
+
+    char *max_grammar = getenv("PILGRIM_MAX_GRAMMAR_MB");
+    size_t max_bytes = max_grammar && atol(max_grammar) > 0 ? atol(max_grammar) * 1024 * 1024 : 0;
+
+    void (*generators[])(Stream*) = {make_nested, make_stencil, make_random, make_drift};
+    const char *names[] = {"nested", "stencil", "random", "drift"};
+    int num_streams = sizeof(generators) / sizeof(generators[0]);
+
+    Stream streams[num_streams + 1];
+    for(int i = 0; i < num_streams; i++) {
+        stream_init(&streams[i], names[i], symbols);
+        generators[i](&streams[i]);
+    }
+    if(trace_dir)
+        make_replay(&streams[num_streams++], trace_dir);
+
+    // Warm up the allocator and the caches once
+    Stream warmup = streams[0];
+    warmup.len = streams[0].len / 10;
+    bench_stream(&warmup, max_bytes, false);
+
+    printf("%-8s %10s %10s %10s %10s %10s %12s\n", "stream", "symbols", "ns/symbol", "peak(MB)", "final(MB)", "rules", "serialized(KB)");
+    for(int i = 0; i < num_streams; i++) {
+        bench_stream(&streams[i], max_bytes, true);
+        stream_free(&streams[i]);
+    }
+
+    return 0;
+}
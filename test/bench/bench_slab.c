@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+
+/*
+ * Microbenchmark: slab allocation (pilgrim_slab.h) vs. one
+ * pilgrim_malloc()/pilgrim_free() per node.
+ *
+ * Part 1 replays the node lifecycle of a call signature table entry:
+ *   alloc     allocate n nodes and link them in allocation order
+ *   churn     free every third node and allocate a replacement
+ *   walk      traverse the list 8 times
+ *   teardown  free every node, or release the slab
+ *
+ * Part 2 builds a Sequitur grammar from a synthetic loop-heavy
+ * trace with append_terminal() and times the build and the
+ * sequitur_cleanup().
+ *
+ * Run with PILGRIM_HUGEPAGES=1 to back the large chunks with THP.
+ *
+ * Usage: ./bench_slab [nodes=2000000] [terminals=4000000]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pilgrim_slab.h"
+#include "pilgrim_sequitur.h"
+#include "pilgrim_logger.h"
+#include "pilgrim_utils.h"
+
+#define WALKS 8
+
+typedef struct Node_t {
+    struct Node_t *next;
+    long val;
+} Node;
+
+typedef struct ObjClass_t {
+    const char *name;
+    size_t size;
+} ObjClass;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Slab is NULL for the pilgrim_malloc() version
+static inline Node* node_alloc(Slab *slab, size_t size) {
+    Node *node = slab ? slab_alloc(slab) : pilgrim_malloc(size);
+    memset(node, 0, size);
+    return node;
+}
+
+static inline void node_free(Slab *slab, Node *node, size_t size) {
+    if(slab)
+        slab_free(slab, node);
+    else
+        pilgrim_free(node, size);
+}
+
+static void bench_nodes(Slab *slab, size_t size, int n, double t[4]) {
+    Node *head = NULL, **tail = &head;
+
+    double t0 = now();
+    for(int i = 0; i < n; i++) {
+        Node *node = node_alloc(slab, size);
+        node->val = i;
+        *tail = node;
+        tail = &node->next;
+    }
+
+    double t1 = now();
+    Node *prev = head;
+    while(prev && prev->next) {
+        Node *victim = prev->next;
+        prev->next = victim->next;
+        long val = victim->val;
+        node_free(slab, victim, size);
+
+        Node *node = node_alloc(slab, size);
+        node->val = val;
+        node->next = prev->next;
+        prev->next = node;
+
+        prev = node->next ? node->next->next : NULL;
+    }
+
+    double t2 = now();
+    volatile long sum = 0;
+    for(int k = 0; k < WALKS; k++)
+        for(Node *node = head; node; node = node->next)
+            sum += node->val;
+
+    double t3 = now();
+    if(slab) {
+        slab_release(slab);
+    } else {
+        Node *node = head, *next;
+        while(node) {
+            next = node->next;
+            pilgrim_free(node, size);
+            node = next;
+        }
+    }
+    double t4 = now();
+
+    t[0] = t1 - t0; t[1] = t2 - t1; t[2] = t3 - t2; t[3] = t4 - t3;
+}
+
+/*
+ * A nested loop trace with a few irregular calls,
+ * roughly what an iterative solver produces.
+ */
+static int* make_trace(int len) {
+    int *trace = malloc(sizeof(int) * len);
+    int i = 0, iter = 0;
+    while(i < len) {
+        int neighbors = 4 + iter % 3;
+        for(int j = 0; j < neighbors && i < len; j++) {
+            trace[i++] = 10 + j;                // Irecv
+            if(i < len) trace[i++] = 20 + j;    // Isend
+        }
+        if(i < len) trace[i++] = 30;            // Waitall
+        if(i < len && iter % 10 == 0) trace[i++] = 40;         // Allreduce
+        if(i < len && rand() % 100 == 0) trace[i++] = 50 + rand() % 200;
+        iter++;
+    }
+    return trace;
+}
+
+static void bench_grammar(int *trace, int len, double *t_build, double *t_cleanup, int *num_symbols) {
+    Grammar grammar;
+    sequitur_init(&grammar);
+
+    double t0 = now();
+    for(int i = 0; i < len; i++)
+        append_terminal(&grammar, trace[i], 1);
+    double t1 = now();
+
+    int n = 0;
+    Rule *rule;
+    Symbol *sym;
+    GRAMMAR_FOREACH_RULE(&grammar, rule) {
+        n++;
+        RULE_FOREACH_SYMBOL(&grammar, rule, sym)
+            n++;
+    }
+
+    double t2 = now();
+    sequitur_cleanup(&grammar);
+    double t3 = now();
+
+    *t_build = t1 - t0;
+    *t_cleanup = t3 - t2;
+    *num_symbols = n;
+}
+
+int main(int argc, char *argv[]) {
+    int nodes = 2000000, terminals = 4000000;
+    if(argc > 1) nodes = atoi(argv[1]);
+    if(argc > 2) terminals = atoi(argv[2]);
+
+    ObjClass classes[] = {
+        {"RecordHash", sizeof(RecordHash)}
+    };
+    const char *phases[] = {"alloc", "churn", "walk", "teardown"};
+
+    printf("%d nodes, ns/node (walk is per pass)\n", nodes);
+    printf("%-12s %-10s %14s %14s %8s\n", "object", "phase", "malloc", "slab", "speedup");
+    for(size_t c = 0; c < sizeof(classes)/sizeof(ObjClass); c++) {
+        double t_malloc[4], t_slab[4];
+        Slab slab;
+        slab_init(&slab, classes[c].size);
+
+        // warm up once, then measure
+        bench_nodes(NULL, classes[c].size, nodes/10, t_malloc);
+        bench_nodes(&slab, classes[c].size, nodes/10, t_slab);
+        bench_nodes(NULL, classes[c].size, nodes, t_malloc);
+        bench_nodes(&slab, classes[c].size, nodes, t_slab);
+
+        t_malloc[2] /= WALKS;
+        t_slab[2] /= WALKS;
+        for(int p = 0; p < 4; p++)
+            printf("%-12s %-10s %14.2f %14.2f %7.2fx\n", p == 0 ? classes[c].name : "", phases[p],
+                    t_malloc[p]*1e9/nodes, t_slab[p]*1e9/nodes, t_malloc[p]/t_slab[p]);
+    }
+
+    srand(1);
+    int *trace = make_trace(terminals);
+    double t_build, t_cleanup;
+    int num_symbols;
+    bench_grammar(trace, terminals/10, &t_build, &t_cleanup, &num_symbols);
+    bench_grammar(trace, terminals, &t_build, &t_cleanup, &num_symbols);
+    printf("\nSequitur, %d terminals, %d symbols in the grammar\n", terminals, num_symbols);
+    printf("build:   %10.2f ns/terminal\n", t_build*1e9/terminals);
+    printf("cleanup: %10.3f ms\n", t_cleanup*1e3);
+
+    free(trace);
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+// Graph topologies, their array arguments have lengths that
+// depend on other array arguments (index and degrees)
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // A ring, every node has two neighbours
+    int *index = malloc(sizeof(int) * size);
+    int *edges = malloc(sizeof(int) * size * 2);
+    for(int i = 0; i < size; i++) {
+        index[i] = 2 * (i+1);
+        edges[2*i] = (i-1+size) % size;
+        edges[2*i+1] = (i+1) % size;
+    }
+    MPI_Comm graph_comm;
+    MPI_Graph_create(MPI_COMM_WORLD, size, index, edges, 0, &graph_comm);
+
+    // Each rank specifies its own edges to both neighbours
+    int sources[1] = {rank};
+    int degrees[1] = {2};
+    int destinations[2] = {(rank-1+size) % size, (rank+1) % size};
+    int weights[2] = {1, 1};
+    MPI_Comm dist_graph_comm;
+    MPI_Dist_graph_create(MPI_COMM_WORLD, 1, sources, degrees, destinations, weights,
+                          MPI_INFO_NULL, 0, &dist_graph_comm);
+
+    MPI_Comm_free(&graph_comm);
+    MPI_Comm_free(&dist_graph_comm);
+    free(index);
+    free(edges);
+
+    MPI_Finalize();
+    return 0;
+}
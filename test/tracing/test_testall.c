@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+// Poll on MPI_Testall until both requests complete, the unsuccessful
+// calls and the final successful one are recorded with different
+// arguments (statuses are only kept once flag is set)
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if(size >= 2 && rank < 2) {
+        int peer = 1 - rank;
+        int sendbuf = rank, recvbuf = -1;
+        MPI_Request reqs[2];
+        MPI_Irecv(&recvbuf, 1, MPI_INT, peer, 123, MPI_COMM_WORLD, &reqs[0]);
+        MPI_Isend(&sendbuf, 1, MPI_INT, peer, 123, MPI_COMM_WORLD, &reqs[1]);
+
+        int flag = 0;
+        while(!flag)
+            MPI_Testall(2, reqs, &flag, MPI_STATUSES_IGNORE);
+
+        if(recvbuf != peer)
+            printf("Rank %d: expected %d, got %d\n", rank, peer, recvbuf);
+    }
+
+    MPI_Finalize();
+    return 0;
+}
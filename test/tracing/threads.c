@@ -1,46 +1,75 @@
+/*
+ * Multi-threaded tracing scalability test
+ *
+ * Every thread issues the same cheap MPI call (MPI_Iprobe on
+ * MPI_COMM_SELF, which never matches) in a tight loop. It is not a
+ * local query, so it takes the normal traced path: timings, grammar
+ * update and overhead profile. We sweep the number of threads from 1
+ * to max_threads (powers of two) and report the per-call cost.
+ * ns/call/thread is the latency seen by one thread, ns/call is the
+ * amortized cost over all calls. With Pilgrim's per-thread recording
+ * contexts, ns/call/thread should stay flat as long as there are
+ * enough cores, and ns/call should stay flat regardless.
+ *
+ * Usage: mpirun -np N ./threads [max_threads=64] [iterations=100000]
+ */
 #include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <mpi.h>
 
+static int iterations = 100000;
+static pthread_barrier_t barrier;
 
 void* func(void* arg) {
-    pthread_t tid = pthread_self();
-    printf("[child] show my tid:%ld\n", tid);
-    int size, rank;
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-    printf("[child] mpi size: %d, mpi rank: %d\n", size, rank);
+    int flag;
+    pthread_barrier_wait(&barrier);
+    for(int i = 0; i < iterations; i++)
+        MPI_Iprobe(MPI_ANY_SOURCE, 0, MPI_COMM_SELF, &flag, MPI_STATUS_IGNORE);
+    return NULL;
+}
 
-    /*
-    pthread_mutex_t mutex;
-    pthread_mutex_init(&mutex, NULL);
-    pthread_mutex_destroy(&mutex);
-    pthread_exit(NULL);
-    */
+double run(int nthreads) {
+    pthread_t *tids = malloc(sizeof(pthread_t) * nthreads);
+    pthread_barrier_init(&barrier, NULL, nthreads + 1);
 
-    return NULL;
+    for(int i = 0; i < nthreads; i++)
+        pthread_create(&tids[i], NULL, func, NULL);
+
+    pthread_barrier_wait(&barrier);
+    double tstart = MPI_Wtime();
+    for(int i = 0; i < nthreads; i++)
+        pthread_join(tids[i], NULL);
+    double elapsed = MPI_Wtime() - tstart;
+
+    pthread_barrier_destroy(&barrier);
+    free(tids);
+    return elapsed;
 }
 
 int main(int argc, char* argv[]) {
-    int provided;
+    int provided, rank;
     MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    /*
-    void* res;
-    pthread_t tid;
+    int max_threads = 64;
+    if(argc > 1) max_threads = atoi(argv[1]);
+    if(argc > 2) iterations = atoi(argv[2]);
 
-    pthread_create(&tid, NULL, func, NULL);
-    printf("[parent] show child tid:%ld\n", tid);
-    pthread_join(tid, &res);
+    if(provided < MPI_THREAD_MULTIPLE && rank == 0)
+        printf("Warning: MPI_THREAD_MULTIPLE is not supported (provided=%d)\n", provided);
 
-    pthread_create(&tid, NULL, func, NULL);
-    printf("[parent] show child tid:%ld\n", tid);
-    pthread_join(tid, &res);
+    if(rank == 0)
+        printf("%8s %14s %12s %14s %12s\n", "threads", "calls/thread", "time(s)", "ns/call/thread", "ns/call");
 
-    pthread_create(&tid, NULL, func, NULL);
-    printf("[parent] show child tid:%ld\n", tid);
-    pthread_join(tid, &res);
-    */
+    for(int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double elapsed = run(nthreads), max_elapsed;
+        MPI_Reduce(&elapsed, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+        if(rank == 0)
+            printf("%8d %14d %12.4f %14.1f %12.1f\n", nthreads, iterations, max_elapsed,
+                    max_elapsed * 1e9 / iterations, max_elapsed * 1e9 / iterations / nthreads);
+    }
 
     MPI_Finalize();
     return 0;
@@ -7,7 +7,8 @@
 # encoding: utf-8
 import pickle, os
 from codegen import MPIFunction, MPIArgument
-from instrument import arg_type_strip, is_mpi_object_arg, filter_with_local_mpi_functions
+import re
+from instrument import arg_type_strip, is_mpi_object_arg, filter_with_local_mpi_functions, encoded_args
 
 
 def handle_special_apis(func):
@@ -26,7 +27,19 @@ def handle_special_apis(func):
 
 unique_types = set([])
 
-def codegen_read_one_arg(func, i):
+# Translate the wrapper side size expression of an encoded argument
+# (see instrument.py codegen_sizeof_args) into the decoder side one.
+def reader_size_expr(func, size):
+    if size.startswith('strlen('):
+        return 'strlen(buff+pos)+1'
+    for idx, arg in enumerate(func.arguments):
+        size = re.sub(r'\b%s\b' %arg.name, '(*((int*) (cs->args[%d])))' %idx, size)
+    return size
+
+# @size: size expression of the encoded argument, None if it is not encoded
+# @deferred: lines that use other array arguments, to be
+# written after all arguments are read
+def codegen_read_one_arg(func, i, size, deferred):
 
     def find_arg_idx(func, arg_name):
         for idx, arg in enumerate(func.arguments):
@@ -56,7 +69,6 @@ def codegen_read_one_arg(func, i):
 
     # 2. Fill in details for each unique type
     if arg_type_strip(arg.type) == "int":
-        lines.append('cs->arg_sizes[%d] = sizeof(int);' %i)
         if "source" in arg.name or "dest" in arg.name:
             lines.append('cs->arg_types[%d] = TYPE_RANK_ENCODED;' %i)
         elif "tag" in arg.name:
@@ -65,51 +77,46 @@ def codegen_read_one_arg(func, i):
             lines.append('cs->arg_types[%d] = TYPE_INT;' %i)
     elif 'void' in arg.type:
         lines.append('cs->arg_types[%d] = TYPE_MEM_PTR;' %i)
-        lines.append('cs->arg_sizes[%d] = sizeof(MemPtrAttr);' %i)
     elif 'MPI_Status' in arg.type:
         lines.append('cs->arg_types[%d] = TYPE_MPI_Status;' %i)
-        lines.append('cs->arg_sizes[%d] = sizeof(int)*2;' %i)
     elif 'MPI_Offset' in arg.type and '*' not in arg.type:  # keep separately
         pass
     elif 'MPI_Aint' in arg.type:
         lines.append('cs->arg_types[%d] = TYPE_MPI_Aint;' %i)
-        lines.append('cs->arg_sizes[%d] = sizeof(%s);' %(i, arg_type_strip(arg.type)) )
     elif 'MPI_Count' in arg.type:
         lines.append('cs->arg_types[%d] = TYPE_MPI_Count;' %i)
-        lines.append('cs->arg_sizes[%d] = sizeof(%s);' %(i, arg_type_strip(arg.type)) )
     elif ('MPI_' in arg.type) and ('function' in arg.type):
         arg_type = arg_type_strip(arg.type)
-        lines.append('cs->arg_sizes[%d] = sizeof(%s);' %(i, arg_type))
         lines.append('cs->arg_types[%d] = TYPE_%s;' %(i, arg_type))
     elif is_mpi_object_arg(arg_type_strip(arg.type)):
-        lines.append('cs->arg_sizes[%d] = sizeof(int);' %i)
         lines.append('cs->arg_types[%d] = TYPE_%s;' %(i, arg_type_strip(arg.type)))
     elif ('char[]' in arg.type or 'char*' in arg.type):
         if '**' not in arg.type and '*[]' not in arg.type:    # only consider one single string for now
-            lines.append('cs->arg_sizes[%d] = strlen(buff+pos)+1;' %i)
             lines.append('cs->arg_types[%d] = TYPE_STRING;' %(i))
         else:
             # MPI_Comm_spawn, MPI_Comm_spawn_multi
             pass
     else:
         # MPI_T_* type parameters
-        lines.append('cs->arg_sizes[%d] = sizeof(%s);' %(i, arg_type_strip(arg.type)) )
+        pass
 
 
     # 3. Set up the length for array arguments of graph realated calls
     # We need to do this because for some of them, we can not directly
-    # parse that info from the MPI Standard latex
+    # parse that info from the MPI Standard latex.
+    # The arrays are read after the scalars, so lengths computed
+    # from another array go to deferred.
     if (func.name == "MPI_Graph_create" or func.name == "MPI_Graph_map") and arg.name == "edges":
         # MPI_Graph_create(MPI_Comm comm_old, int nnodes, const int index[], const int edges[], int reorder, MPI_Comm * comm_graph)
         # MPI_Graph_map(MPI_Comm comm, int nnodes, const int index[], const int edges[], int *newrank)
         # length of edges: index[nnodes-1]
-        lines.append('cs->arg_lengths[%d] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];' %i)
+        deferred.append('cs->arg_lengths[%d] = ((int*)cs->args[2])[*(int*)cs->args[1]-1];' %i)
 
     if func.name == "MPI_Dist_graph_create":
         # MPI_Dist_graph_create(MPI_Comm comm_old, int n, const int sources[], const int degrees[], const int destinations[], const int weights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph)
         # length of destinations/weights: sum(degress)
         if arg.name == "destinations" or arg.name == "weights":
-            lines.append('cs->arg_lengths[%d] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);' %i)
+            deferred.append('cs->arg_lengths[%d] = pilgrim_sum_array((int*) cs->args[3], *(int*)cs->args[1]);' %i)
 
     if func.name == "MPI_Dist_graph_create_adjacent":
         # length of sourceweights = indegree
@@ -120,7 +127,7 @@ def codegen_read_one_arg(func, i):
             lines.append('cs->arg_lengths[%d] = (*(int*) cs->args[4]);' %i)
 
 
-    # 4. Finally, update size for array arguments
+    # 4. Set up the length for array arguments
     if '[' in arg.type and 'char' not in arg.type and 'graph' not in func.name.lower():
         # could be MPI_Aint or int (int for int[], MPI_Datatype[])
         size_type = arg_type_strip(arg.type)
@@ -142,9 +149,12 @@ def codegen_read_one_arg(func, i):
         if 'graph' in func.name.lower():
             print(func.name, arg.type, arg.name, arg.length)
 
-
-        lines.append('cs->arg_sizes[%d] = sizeof(%s) * cs->arg_lengths[%d];' %(i, size_type, i))
-
+    # 5. Finally, read the argument, the size must match
+    # exactly what the wrapper encoded
+    if size is None:
+        lines.append('cs->args[%d] = calloc(cs->arg_sizes[%d], 1);' %(i,i))
+        return lines
+    lines.append('cs->arg_sizes[%d] = %s;' %(i, reader_size_expr(func, size)))
     lines.append('cs->args[%d] = calloc(cs->arg_sizes[%d], 1);' %(i,i))
     lines.append('memcpy(cs->args[%d], buff+pos, cs->arg_sizes[%d]);' %(i,i))
     lines.append('pos += cs->arg_sizes[%d];' %i)
@@ -182,10 +192,19 @@ void read_record_args(int func_id, void* buff, CallSignature* cs) {
                 f.write('\n\t\t\tcomm_size =  *((int*) (buff+pos));')
                 f.write('\n\t\t\tpos += sizeof(int);')
 
-            for i in range(len(func.arguments)):
+            # Same layout as the wrapper: packed scalars first, then the arrays,
+            # arguments that are not encoded are left empty.
+            _, scalars, arrays = encoded_args(func)
+            encoded = [(arg.idx, arg.size) for arg in scalars + arrays]
+            encoded_idx = set([idx for idx, _ in encoded])
+            encoded += [(i, None) for i in range(len(func.arguments)) if i not in encoded_idx]
+            deferred = []
+            for i, size in encoded:
                 f.write('\n\t\t\t')
-                lines = codegen_read_one_arg(func, i)
+                lines = codegen_read_one_arg(func, i, size, deferred)
                 f.write('\n\t\t\t'.join(lines))
+            for line in deferred:
+                f.write('\n\t\t\t' + line)
 
         f.write('\n\t\t\tbreak;\n\t\t}\n')
 
@@ -6,6 +6,7 @@
 #!/usr/bin/env python
 # encoding: utf-8
 import pickle, os
+from StringIO import StringIO
 from codegen import MPIFunction, MPIArgument
 
 def filter_with_local_mpi_functions(funcs):
@@ -30,6 +31,19 @@ def filter_with_local_mpi_functions(funcs):
     return cleaned
 
 
+# Purely local queries, they carry no communication semantics.
+# Their wrappers use PILGRIM_QUERY_1/PILGRIM_QUERY_2_END, which skip
+# the timing capture and only count the call signature.
+query_funcs = set([
+    "MPI_Comm_rank", "MPI_Comm_size", "MPI_Comm_remote_size", "MPI_Comm_test_inter",
+    "MPI_Group_rank", "MPI_Group_size",
+    "MPI_Type_size", "MPI_Type_size_x", "MPI_Type_get_extent", "MPI_Type_get_extent_x",
+    "MPI_Type_get_true_extent", "MPI_Type_get_true_extent_x",
+    "MPI_Get_count", "MPI_Get_elements", "MPI_Get_elements_x",
+    "MPI_Initialized", "MPI_Finalized", "MPI_Query_thread", "MPI_Is_thread_main",
+    "MPI_Get_version", "MPI_Get_library_version", "MPI_Get_processor_name",
+    "MPI_Topo_test", "MPI_Cartdim_get", "MPI_Graphdims_get"])
+
 def generate_function_id_file(funcs):
     function_id_file = open('../include/pilgrim_func_ids.h', 'w')
     function_id_file.write("/*\n * Copyright (C) by Argonne National Laboratory\n *     See COPYRIGHT in top-level directory\n */\n")
@@ -49,6 +63,11 @@ def generate_function_id_file(funcs):
     function_id_file.write('"free", \n')
     function_id_file.write('};\n\n')
 
+    # Defined in pilgrim_wrappers.c, see generate_wrapper_file()
+    num_query_funcs = len([name for name in funcs if name in query_funcs])
+    function_id_file.write('#define NUM_QUERY_FUNCS %d\n' %num_query_funcs)
+    function_id_file.write('extern const short query_func_ids[NUM_QUERY_FUNCS];\n\n')
+
     function_id_file.write('#endif')
     function_id_file.close()
 
@@ -83,9 +102,28 @@ def arg_type_strip(type_str):
     t = type_str.replace('*', '').replace('[', '').replace(']', '').replace(' ', '').replace('const', '')
     return t;
 
+class EncodedArg:
+    def __init__(self, idx, addr, size, ctype):
+        self.idx = idx              # index of the argument in func.arguments
+        self.addr = addr            # address of the (converted) argument in the wrapper
+        self.size = size            # encoded size in bytes, in terms of the wrapper's variables
+        self.ctype = ctype          # field type in the packed scalar struct, None for array arguments
+
+    def is_scalar(self):
+        return self.ctype is not None
+
+    # Initializer of the packed scalar struct field
+    def value(self):
+        if self.addr.startswith('&'):
+            return self.addr[1:]
+        if self.addr == 'status_arg':
+            return '{status_arg[0], status_arg[1]}'
+        return '(%s ? *%s : 0)' %(self.addr, self.addr)   # pointer to a single value
+
+
 def codegen_assemble_args(func):
     line = ""
-    assemble_args = []
+    assemble_args = {}
     args_set = set( [arg.name for arg in func.arguments] )
     obj_count, buffer_count = 0, 0
 
@@ -95,7 +133,7 @@ def codegen_assemble_args(func):
         line += "\tPMPI_Comm_size(comm, &comm_size);\n"
 
     # Now iterate through every argument
-    for arg in func.arguments:
+    for idx, arg in enumerate(func.arguments):
 
         arg_name = None
 
@@ -148,7 +186,7 @@ def codegen_assemble_args(func):
             arg_name = arg.name      # its already the adress
         elif 'int' in arg.type and ('source' in arg.name or 'dest' in arg.name):    # pattern recognization for src or dest ranks
             #line += "\tPMPI_Comm_rank(comm, &g_local_rank);\n"
-            line += "\tint %s_rank = g_mpi_rank - %s;\n" %(arg.name, arg.name)
+            line += "\tint %s_rank = logger_get_mpi_rank() - %s;\n" %(arg.name, arg.name)
             line += "\tif(%s == MPI_ANY_SOURCE) %s_rank = PILGRIM_MPI_ANY_SOURCE;\n" %(arg.name, arg.name)
             line += "\tif(%s == MPI_PROC_NULL) %s_rank = PILGRIM_MPI_PROC_NULL;\n" %(arg.name, arg.name)
             arg_name =  "&%s_rank" %arg.name
@@ -159,69 +197,84 @@ def codegen_assemble_args(func):
         else:
             arg_name = "&"+arg.name
 
-        if arg_name: assemble_args.append(arg_name)
+        if arg_name: assemble_args[idx] = arg_name
 
     if func.name == "MPI_Comm_rank":
         # For MPI_Comm_rank, we always set the last argument(output rank) to 0
         # So every process will have the same function signature.
-        assemble_args[-1] = "&placeholder"
+        assemble_args[len(func.arguments)-1] = "&placeholder"
 
-    if len(assemble_args) > 0:
-        assemble_args_str = ', '.join(assemble_args)
-        line += '\tvoid **args = assemble_args_list(%d, %s);\n' %(len(assemble_args), assemble_args_str)
-
-        # Check if this is a MPI object free function
-        free_mpi_object, arg_idx = is_mpi_object_release(func)
-        if free_mpi_object:
-            obj_type = arg_type_strip(func.arguments[arg_idx].type)
-            obj_name = func.arguments[arg_idx].name
-            line += '\tMPI_OBJ_RELEASE(%s, %s);\n' %(obj_type, obj_name)
-    else:
-        line = '\tvoid **args = NULL;\n'
+    # Check if this is a MPI object free function
+    free_mpi_object, arg_idx = is_mpi_object_release(func)
+    if free_mpi_object:
+        obj_type = arg_type_strip(func.arguments[arg_idx].type)
+        obj_name = func.arguments[arg_idx].name
+        line += '\tMPI_OBJ_RELEASE(%s, %s);\n' %(obj_type, obj_name)
 
+    return line, assemble_args
 
-    return line, len(assemble_args)
-
+# Return the encoded size and the scalar type (None for arrays) of each argument
 def codegen_sizeof_args(func):
-    sizeof_args = []
-    for arg in func.arguments:
+    sizeof_args = {}
+    for idx, arg in enumerate(func.arguments):
         if 'void' in arg.type:
-            sizeof_args.append('sizeof(MemPtrAttr)')                # memory buffer
+            sizeof_args[idx] = ('sizeof(MemPtrAttr)', 'MemPtrAttr')        # memory buffer
         elif ('char[]' in arg.type or 'char*' in arg.type):
             if '**' not in arg.type and '*[]' not in arg.type:        # only consider one single string
-                sizeof_args.append('strlen(%s)+1' %arg.name)
+                sizeof_args[idx] = ('strlen(%s)+1' %arg.name, None)
         elif 'MPI_Request' in arg.type:
-            sizeof_args.append('sizeof(int)')
+            sizeof_args[idx] = ('sizeof(int)', 'int')
         elif 'MPI_Status' in arg.type:
-            sizeof_args.append('sizeof(int)*2')
+            sizeof_args[idx] = ('sizeof(int)*2', 'int' if '*' in arg.type else None)
         elif 'MPI_Offset' in arg.type and '*' not in arg.type:  # keep separately
             continue
+        elif ('MPI_' in arg.type) and ('function' in arg.type):  # function pointers are not kept
+            continue
         elif is_mpi_object_arg(arg_type_strip(arg.type)):
             if '[' in arg.type:
                 if arg.length:
-                    sizeof_args.append('%s*sizeof(int)' %arg.length)
+                    sizeof_args[idx] = ('%s*sizeof(int)' %arg.length, None)
                 else:
-                    sizeof_args.append('(comm_size)*sizeof(int)') # first extra element is used to store this array count
+                    sizeof_args[idx] = ('(comm_size)*sizeof(int)', None)
             else:
-                sizeof_args.append('sizeof(int)')
+                sizeof_args[idx] = ('sizeof(int)', 'int')
         elif '*' in arg.type or '[' in arg.type:
-            n = 1
+            n = "1"
             if not arg.length:
                 if func.need_comm_size:
                     n = "comm_size"
             else:
                 n = arg.length
             fixed_type = arg.type.split('[')[0].replace('*', '')
-            sizeof_args.append("%s*sizeof(%s)" %(n, fixed_type))
+            if n == "1":
+                sizeof_args[idx] = ("sizeof(%s)" %fixed_type, fixed_type.replace('const', '').strip())
+            else:
+                sizeof_args[idx] = ("%s*sizeof(%s)" %(n, fixed_type), None)
         else:
-            sizeof_args.append("sizeof(%s)" %arg.type)
+            sizeof_args[idx] = ("sizeof(%s)" %arg.type, arg.type)
+
+    return sizeof_args
+
+# The arguments that go into the call signature and their layout:
+# | fixed-size scalar arguments (packed struct) | array arguments |
+# Both orders follow the function's argument order.
+# Used by both the wrappers and the decoder (generate_reader.py)
+def encoded_args(func):
+    line, addrs = codegen_assemble_args(func)
+    sizes = codegen_sizeof_args(func)
 
-    line = '\tint* sizes = NULL;\n';
-    if len(sizeof_args) > 0:
-        sizeof_args_str = ', '.join(sizeof_args)
-        line = '\tint sizes[] = { %s };\n' %sizeof_args_str
-    return line
+    scalars, arrays = [], []
+    for idx in range(len(func.arguments)):
+        if idx not in addrs or idx not in sizes:
+            continue
+        size, ctype = sizes[idx]
+        if ctype and ctype == 'int' and size == 'sizeof(int)*2':
+            ctype = 'int[2]'
+        arg = EncodedArg(idx, addrs[idx], size, ctype)
+        if arg.is_scalar(): scalars.append(arg)
+        else: arrays.append(arg)
 
+    return line, scalars, arrays
 
 def handle_special_apis(func):
     # These are handled in pilgrim_init_finalize.c
@@ -271,10 +324,19 @@ def generate_wrapper_file(funcs):
         arg_names = []
         for arg in func.arguments:
             arg_names.append(arg.name)
-        f.write('\tPILGRIM_TRACING_1(%s, %s, (%s));\n' %(func.ret_type, func.name, ', '.join(arg_names)))
+        macro = 'PILGRIM_QUERY_1' if func.name in query_funcs else 'PILGRIM_TRACING_1'
+        f.write('\t%s(%s, %s, (%s));\n' %(macro, func.ret_type, func.name, ', '.join(arg_names)))
 
-    def phase_two(num_args, comm_size, f):
-        f.write('\tPILGRIM_TRACING_2(%d, sizes, args, %s);\n}\n' %(num_args, comm_size))
+    def phase_two(func, arrays, f):
+        comm_size = "comm_size" if func.need_comm_size else "-1"
+        tail_len = ' + '.join(['tail_size_%d' %i for i in range(len(arrays))]) if arrays else '0'
+        f.write('\tPILGRIM_TRACING_2_BEGIN(scalars, %s, %s);\n' %(tail_len, comm_size))
+        for i, arg in enumerate(arrays):
+            # obj_id_N arrays are declared by the wrapper, see codegen_assemble_args()
+            macro = 'PILGRIM_ENCODE_LOCAL_TAIL' if arg.addr.startswith('obj_id_') else 'PILGRIM_ENCODE_TAIL'
+            f.write('\t%s(%s, tail_size_%d);\n' %(macro, arg.addr, i))
+        macro = 'PILGRIM_QUERY_2_END' if func.name in query_funcs else 'PILGRIM_TRACING_2_END'
+        f.write('\t%s();\n}\n' %macro)
 
     def actual_wrapper(func, f):
         arg_names = []
@@ -409,11 +471,46 @@ def generate_wrapper_file(funcs):
         f.write("extern void " + func.name.lower() + "__" + fortran_sig + " {"+f_actual_call+"\n}\n")
 
 
+    # While tracing is paused or the function is filtered out,
+    # PILGRIM_TRACING_1 only makes the PMPI call.
+    # Functions that create or free MPI objects still need to keep their
+    # ids consistent for when tracing resumes, do only that and skip
+    # the call signature.
+    def paused_bookkeeping(func, f):
+        free_mpi_object, arg_idx = is_mpi_object_release(func)
+        comm_creation = StringIO()
+        handle_mpi_comm_creation(func, comm_creation)
+        if not free_mpi_object and not comm_creation.getvalue():
+            return
+
+        arg_names = [arg.name for arg in func.arguments]
+        f.write('\tif(logger_paused(ID_%s)) {\n' %func.name)
+        if free_mpi_object:
+            obj_type = arg_type_strip(func.arguments[arg_idx].type)
+            f.write('\t\tMPI_OBJ_RELEASE(%s, %s);\n' %(obj_type, func.arguments[arg_idx].name))
+        f.write('\t\tPILGRIM_PMPI_CALL(%s, %s, (%s));\n' %(func.ret_type, func.name, ', '.join(arg_names)))
+        f.write(comm_creation.getvalue().replace('\t', '\t\t'))
+        f.write('\t\treturn res;\n\t}\n')
+
+    # Specialized encoder of this function's call signature
     def logging(func, f):
-        line, num_args = codegen_assemble_args(func)
+        line, scalars, arrays = encoded_args(func)
         f.write(line)
-        f.write(codegen_sizeof_args(func))
-        return num_args
+
+        if len(scalars) > 0:
+            f.write('\tstruct __attribute__((packed)) {\n')
+            for i, arg in enumerate(scalars):
+                if arg.ctype == 'int[2]':
+                    f.write('\t\tint a%d[2];\n' %i)
+                else:
+                    f.write('\t\t%s a%d;\n' %(arg.ctype, i))
+            f.write('\t} scalars = { %s };\n' %(', '.join([arg.value() for arg in scalars])))
+        else:
+            f.write('\tchar scalars[0];\n')
+
+        for i, arg in enumerate(arrays):
+            f.write('\tint tail_size_%d = %s;\n' %(i, arg.size))
+        return arrays
 
     f = open('../src/pilgrim_wrappers.c', 'w')
     f.write("/*\n * Copyright (C) by Argonne National Laboratory\n *     See COPYRIGHT in top-level directory\n */\n")
@@ -427,6 +524,12 @@ def generate_wrapper_file(funcs):
     f.write('static int g_local_rank;\n')
     f.write('MPI_Status g_c_status;\n')
 
+    f.write('const short query_func_ids[NUM_QUERY_FUNCS] = {\n')
+    for name in funcs:
+        if name in query_funcs:
+            f.write('\tID_%s,\n' %name)
+    f.write('};\n')
+
     for name in funcs:
         func = funcs[name]
 
@@ -434,17 +537,17 @@ def generate_wrapper_file(funcs):
             continue
 
         signature(func, f)
+        paused_bookkeeping(func, f)
 
         if is_mpi_object_release(func)[0]:
-            num_args = logging(func, f)
+            arrays = logging(func, f)
             phase_one(func, f)
         else:
             phase_one(func, f)
             handle_mpi_comm_creation(func, f)
-            num_args = logging(func, f)
+            arrays = logging(func, f)
 
-        comm_size = "comm_size" if func.need_comm_size else "-1"
-        phase_two(num_args, comm_size, f)
+        phase_two(func, arrays, f)
         actual_wrapper(func, f)
 
     f.close()